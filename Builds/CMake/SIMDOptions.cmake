@@ -0,0 +1,36 @@
+#
+# Setup SIMD build configuration
+#
+
+# Scalar code by default, the SIMD kernels are opt-in
+if(NOT DEFINED CUBBYFLOW_SIMD)
+	set(SIMD_DEFAULT None)
+else()
+	set(SIMD_DEFAULT ${CUBBYFLOW_SIMD})
+endif()
+
+set(CUBBYFLOW_SIMD ${SIMD_DEFAULT} CACHE STRING
+	"SIMD backend for the small vector and matrix kernels [None, SSE2, AVX2]")
+
+set_property(CACHE CUBBYFLOW_SIMD PROPERTY
+	STRINGS None SSE2 AVX2)
+
+# Note - Make the CUBBYFLOW_SIMD build option case-insensitive
+string(TOUPPER ${CUBBYFLOW_SIMD} CUBBYFLOW_SIMD_ID)
+
+if(${CUBBYFLOW_SIMD_ID} STREQUAL "AVX2")
+	add_definitions(-DCUBBYFLOW_SIMD_AVX2)
+	if(CMAKE_CXX_COMPILER_ID MATCHES "MSVC")
+		add_compile_options(/arch:AVX2)
+	else()
+		add_compile_options(-mavx2)
+	endif()
+elseif(${CUBBYFLOW_SIMD_ID} STREQUAL "SSE2")
+	add_definitions(-DCUBBYFLOW_SIMD_SSE2)
+	if(NOT CMAKE_CXX_COMPILER_ID MATCHES "MSVC")
+		add_compile_options(-msse2)
+	endif()
+else()
+	# None
+	# Do nothing, the kernels fall back to scalar code
+endif()
@@ -16,6 +16,7 @@
 #include <Core/Geometry/Plane3.h>
 #include <Core/Geometry/Sphere3.h>
 #include <Core/Particle/ParticleSystemData3.h>
+#include <Core/Solver/Particle/DFSPH/DFSPHSolver3.h>
 #include <Core/Solver/Particle/PCISPH/PCISPHSolver3.h>
 #include <Core/Solver/Particle/SPH/SPHSolver3.h>
 #include <Core/Surface/ImplicitSurfaceSet3.h>
@@ -219,21 +220,12 @@ void RunExample2(const std::string& rootDir, double targetSpacing, int numberOfF
 	RunSimulation(rootDir, solver, numberOfFrames, format, fps);
 }
 
-// Dam-breaking example
-void RunExample3(const std::string& rootDir, double targetSpacing, int numberOfFrames, const std::string& format, double fps)
+// Dam-breaking scene shared by the PCISPH and the DFSPH examples
+void BuildDamBreakingScene(const SPHSolver3Ptr& solver, double targetSpacing)
 {
 	BoundingBox3D domain(Vector3D(), Vector3D(3, 2, 1.5));
 	const double lz = domain.GetDepth();
 
-	// Build solver
-	auto solver = PCISPHSolver3::GetBuilder()
-		.WithTargetDensity(1000.0)
-		.WithTargetSpacing(targetSpacing)
-		.MakeShared();
-
-	solver->SetPseudoViscosityCoefficient(0.0);
-	solver->SetTimeStepLimitScale(10.0);
-
 	// Build emitter
 	BoundingBox3D sourceBound(domain);
 	sourceBound.Expand(-targetSpacing);
@@ -293,6 +285,21 @@ void RunExample3(const std::string& rootDir, double targetSpacing, int numberOfF
 		.MakeShared();
 
 	solver->SetCollider(collider);
+}
+
+// Dam-breaking example (PCISPH)
+void RunExample3(const std::string& rootDir, double targetSpacing, int numberOfFrames, const std::string& format, double fps)
+{
+	// Build solver
+	auto solver = PCISPHSolver3::GetBuilder()
+		.WithTargetDensity(1000.0)
+		.WithTargetSpacing(targetSpacing)
+		.MakeShared();
+
+	solver->SetPseudoViscosityCoefficient(0.0);
+	solver->SetTimeStepLimitScale(10.0);
+
+	BuildDamBreakingScene(solver, targetSpacing);
 
 	// Print simulation info
 	printf("Running example 3 (dam-breaking with PCISPH)\n");
@@ -302,6 +309,27 @@ void RunExample3(const std::string& rootDir, double targetSpacing, int numberOfF
 	RunSimulation(rootDir, solver, numberOfFrames, format, fps);
 }
 
+// Dam-breaking example (DFSPH)
+void RunExample4(const std::string& rootDir, double targetSpacing, int numberOfFrames, const std::string& format, double fps)
+{
+	// Build solver
+	auto solver = DFSPHSolver3::GetBuilder()
+		.WithTargetDensity(1000.0)
+		.WithTargetSpacing(targetSpacing)
+		.MakeShared();
+
+	solver->SetPseudoViscosityCoefficient(0.0);
+
+	BuildDamBreakingScene(solver, targetSpacing);
+
+	// Print simulation info
+	printf("Running example 4 (dam-breaking with DFSPH)\n");
+	PrintInfo(solver);
+
+	// Run simulation
+	RunSimulation(rootDir, solver, numberOfFrames, format, fps);
+}
+
 int main(int argc, char* argv[])
 {
 	bool showHelp = false;
@@ -328,7 +356,7 @@ int main(int argc, char* argv[])
 		("frames per second (default is 60.0)") |
 		clara::Opt(exampleNum, "exampleNum")
 		["-e"]["--example"]
-		("example number (between 1 and 3, default is 1)") |
+		("example number (between 1 and 4, default is 1)") |
 		clara::Opt(logFileName, "logFileName")
 		["-l"]["--log"]
 		("log file name (default is " APP_NAME ".log)") |
@@ -375,6 +403,9 @@ int main(int argc, char* argv[])
 	case 3:
 		RunExample3(outputDir, targetSpacing, numberOfFrames, format, fps);
 		break;
+	case 4:
+		RunExample4(outputDir, targetSpacing, numberOfFrames, format, fps);
+		break;
 	default:
 		std::cout << ToString(parser) << '\n';
 		exit(EXIT_FAILURE);
@@ -0,0 +1,16 @@
+/*************************************************************************
+> File Name: FSMLevelSetSolver.h
+> Project Name: CubbyFlow
+> Author: Chan-Ho Chris Ohk
+> Purpose: FSMLevelSetSolver functions for CubbyFlow Python API.
+> Created Time: 2026/10/19
+> Copyright (c) 2018, Chan-Ho Chris Ohk
+*************************************************************************/
+#ifndef CUBBYFLOW_PYTHON_FSM_LEVEL_SET_SOLVER_H
+#define CUBBYFLOW_PYTHON_FSM_LEVEL_SET_SOLVER_H
+
+#include <pybind11/pybind11.h>
+
+void AddFSMLevelSetSolver3(pybind11::module& m);
+
+#endif
@@ -0,0 +1,17 @@
+/*************************************************************************
+> File Name: DFSPHSolver.h
+> Project Name: CubbyFlow
+> Author: Chan-Ho Chris Ohk
+> Purpose: DFSPHSolver functions for CubbyFlow Python API.
+> Created Time: 2026/10/19
+> Copyright (c) 2018, Chan-Ho Chris Ohk
+*************************************************************************/
+#ifndef CUBBYFLOW_PYTHON_DFSPH_SOLVER_H
+#define CUBBYFLOW_PYTHON_DFSPH_SOLVER_H
+
+#include <pybind11/pybind11.h>
+
+void AddDFSPHSolver2(pybind11::module& m);
+void AddDFSPHSolver3(pybind11::module& m);
+
+#endif
@@ -10,9 +10,41 @@
 #define CUBBYFLOW_PHYSICS_ANIMATION_H
 
 #include <Core/Animation/Animation.h>
+#include <Core/Utils/Parallel.h>
 
 namespace CubbyFlow
 {
+	//!
+	//! \brief Statistics of the sub-timestepping in PhysicsAnimation.
+	//!
+	//! The statistics are accumulated until ResetSubTimeStepStatistics is
+	//! called, and can be used to compare the work done by the adaptive
+	//! scheduler against the fixed sub-timestepping.
+	//!
+	struct SubTimeStepStatistics
+	{
+		//! Number of frames advanced.
+		size_t numberOfFrames = 0;
+
+		//! Total number of sub-timesteps taken.
+		size_t numberOfSubTimeSteps = 0;
+
+		//! Number of sub-timesteps taken in the last frame.
+		unsigned int numberOfSubTimeStepsInLastFrame = 0;
+
+		//! The largest number of sub-timesteps taken in a single frame.
+		unsigned int maxNumberOfSubTimeStepsPerFrame = 0;
+
+		//! Number of times the number of sub-timesteps has been estimated.
+		size_t numberOfEstimations = 0;
+
+		//! Total time spent in OnAdvanceTimeStep in seconds.
+		double stepTimeInSeconds = 0.0;
+
+		//! Total time spent in estimating the number of sub-timesteps in seconds.
+		double estimationTimeInSeconds = 0.0;
+	};
+
 	//!
 	//! \brief Abstract base class for physics-based animation.
 	//!
@@ -76,6 +108,50 @@ namespace CubbyFlow
 		//!
 		void SetNumberOfFixedSubTimeSteps(unsigned int numberOfSteps);
 
+		//!
+		//! \brief Returns the max growth of the adaptive sub-timestep.
+		//!
+		//! The adaptive sub-stepping takes the sub-timestep from the CFL-based
+		//! estimation of GetNumberOfSubTimeSteps, which shrinks it immediately
+		//! when the motion gets faster. The sub-timestep is only allowed to grow
+		//! by this factor over the previous one, including the last one of the
+		//! previous frame, so the number of sub-timesteps decreases over a few
+		//! frames when the motion calms down. The schedule does not depend on
+		//! any timings, so the result is deterministic.
+		//!
+		//! \return The max growth factor of the adaptive sub-timestep.
+		//!
+		double GetMaxSubTimeStepGrowth() const;
+
+		//!
+		//! \brief Sets the max growth of the adaptive sub-timestep.
+		//!
+		//! The factor is clamped to be at least 1. Pass infinity to take the
+		//! estimated sub-timestep as is.
+		//!
+		//! \param[in] factor The max growth factor of the adaptive sub-timestep.
+		//!
+		void SetMaxSubTimeStepGrowth(double factor);
+
+		//! Returns the accumulated sub-timestepping statistics.
+		const SubTimeStepStatistics& GetSubTimeStepStatistics() const;
+
+		//! Resets the accumulated sub-timestepping statistics.
+		void ResetSubTimeStepStatistics();
+
+		//! Returns the executor of the parallel functions in this animation.
+		const ParallelExecutorPtr& GetExecutor() const;
+
+		//!
+		//! \brief Sets the executor of the parallel functions in this animation.
+		//!
+		//! Each update of the animation runs through the given executor, so the
+		//! parallel functions called by the solver use its thread count instead of
+		//! the global one. This is useful for running several animations
+		//! concurrently in one process. Null, the default, uses the global settings.
+		//!
+		void SetExecutor(const ParallelExecutorPtr& executor);
+
 		//! Advances a single frame.
 		void AdvanceSingleFrame();
 
@@ -137,13 +213,21 @@ namespace CubbyFlow
 		Frame m_currentFrame;
 		bool m_isUsingFixedSubTimeSteps = true;
 		unsigned int m_numberOfFixedSubTimeSteps = 1;
+		double m_maxSubTimeStepGrowth = 2.0;
+		double m_lastSubTimeStepInSeconds = 0.0;
 		double m_currentTime = 0.0;
+		SubTimeStepStatistics m_statistics;
+		ParallelExecutorPtr m_executor;
 
 		void OnUpdate(const Frame& frame) final;
 
+		void AdvanceFrames(const Frame& frame);
+
 		void AdvanceTimeStep(double timeIntervalInSeconds);
 
 		void Initialize();
+
+		void TakeSubTimeStep(double timeIntervalInSeconds);
 	};
 
 	using PhysicsAnimationPtr = std::shared_ptr<PhysicsAnimation>;
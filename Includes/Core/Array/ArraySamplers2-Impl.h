@@ -198,6 +198,46 @@ namespace CubbyFlow
 		(*weights)[3] = Vector2<R>(fy * m_invGridSpacing.x, fx * m_invGridSpacing.y);
 	}
 
+	template <typename T, typename R>
+	void LinearArraySampler<T, R, 2>::GetCoordinatesWeightsAndGradientWeights(
+		const Vector2<R>& pt,
+		std::array<Point2UI, 4>* indices,
+		std::array<R, 4>* weights,
+		std::array<Vector2<R>, 4>* gradWeights) const
+	{
+		ssize_t i, j;
+		R fx, fy;
+
+		assert(m_gridSpacing.x > std::numeric_limits<R>::epsilon());
+		assert(m_gridSpacing.y > std::numeric_limits<R>::epsilon());
+
+		const Vector2<R> normalizedX = (pt - m_origin) / m_gridSpacing;
+
+		const ssize_t iSize = static_cast<ssize_t>(m_accessor.size().x);
+		const ssize_t jSize = static_cast<ssize_t>(m_accessor.size().y);
+
+		GetBarycentric(normalizedX.x, 0, iSize - 1, &i, &fx);
+		GetBarycentric(normalizedX.y, 0, jSize - 1, &j, &fy);
+
+		const ssize_t ip1 = std::min(i + 1, iSize - 1);
+		const ssize_t jp1 = std::min(j + 1, jSize - 1);
+
+		(*indices)[0] = Point2UI(i, j);
+		(*indices)[1] = Point2UI(ip1, j);
+		(*indices)[2] = Point2UI(i, jp1);
+		(*indices)[3] = Point2UI(ip1, jp1);
+
+		(*weights)[0] = (1 - fx) * (1 - fy);
+		(*weights)[1] = fx * (1 - fy);
+		(*weights)[2] = (1 - fx) * fy;
+		(*weights)[3] = fx * fy;
+
+		(*gradWeights)[0] = Vector2<R>(fy * m_invGridSpacing.x - m_invGridSpacing.x, fx * m_invGridSpacing.y - m_invGridSpacing.y);
+		(*gradWeights)[1] = Vector2<R>(-fy * m_invGridSpacing.x + m_invGridSpacing.x, -fx * m_invGridSpacing.y);
+		(*gradWeights)[2] = Vector2<R>(-fy * m_invGridSpacing.x, -fx * m_invGridSpacing.y + m_invGridSpacing.y);
+		(*gradWeights)[3] = Vector2<R>(fy * m_invGridSpacing.x, fx * m_invGridSpacing.y);
+	}
+
 	template <typename T, typename R>
 	std::function<T(const Vector2<R>&)> LinearArraySampler<T, R, 2>::Functor() const
 	{
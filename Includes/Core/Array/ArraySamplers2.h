@@ -112,6 +112,20 @@ namespace CubbyFlow
 			std::array<Point2UI, 4>* indices,
 			std::array<Vector2<R>, 4>* weights) const;
 
+		//!
+		//! \brief Returns the indices of points, their sampling weight, and their
+		//! gradient of sampling weight for given point.
+		//!
+		//! This function computes the stencil only once and is equivalent to
+		//! calling GetCoordinatesAndWeights and GetCoordinatesAndGradientWeights
+		//! with the same point. The weights are consistent with operator().
+		//!
+		void GetCoordinatesWeightsAndGradientWeights(
+			const Vector2<R>& pt,
+			std::array<Point2UI, 4>* indices,
+			std::array<R, 4>* weights,
+			std::array<Vector2<R>, 4>* gradWeights) const;
+
 		//! Returns a function object that wraps this instance.
 		std::function<T(const Vector2<R>&)> Functor() const;
 
@@ -236,6 +236,62 @@ namespace CubbyFlow
 		(*weights)[7] = Vector3<R>(m_invGridSpacing.x * fy * fz, fx * m_invGridSpacing.y * fz, fx * fy * m_invGridSpacing.z);
 	}
 
+	template <typename T, typename R>
+	void LinearArraySampler<T, R, 3>::GetCoordinatesWeightsAndGradientWeights(
+		const Vector3<R>& pt,
+		std::array<Point3UI, 8>* indices,
+		std::array<R, 8>* weights,
+		std::array<Vector3<R>, 8>* gradWeights) const
+	{
+		ssize_t i, j, k;
+		R fx, fy, fz;
+
+		assert(m_gridSpacing.x > std::numeric_limits<R>::epsilon());
+		assert(m_gridSpacing.y > std::numeric_limits<R>::epsilon());
+		assert(m_gridSpacing.z > std::numeric_limits<R>::epsilon());
+
+		const Vector3<R> normalizedX = (pt - m_origin) / m_gridSpacing;
+
+		const ssize_t iSize = static_cast<ssize_t>(m_accessor.size().x);
+		const ssize_t jSize = static_cast<ssize_t>(m_accessor.size().y);
+		const ssize_t kSize = static_cast<ssize_t>(m_accessor.size().z);
+
+		GetBarycentric(normalizedX.x, 0, iSize - 1, &i, &fx);
+		GetBarycentric(normalizedX.y, 0, jSize - 1, &j, &fy);
+		GetBarycentric(normalizedX.z, 0, kSize - 1, &k, &fz);
+
+		const ssize_t ip1 = std::min(i + 1, iSize - 1);
+		const ssize_t jp1 = std::min(j + 1, jSize - 1);
+		const ssize_t kp1 = std::min(k + 1, kSize - 1);
+
+		(*indices)[0] = Point3UI(i, j, k);
+		(*indices)[1] = Point3UI(ip1, j, k);
+		(*indices)[2] = Point3UI(i, jp1, k);
+		(*indices)[3] = Point3UI(ip1, jp1, k);
+		(*indices)[4] = Point3UI(i, j, kp1);
+		(*indices)[5] = Point3UI(ip1, j, kp1);
+		(*indices)[6] = Point3UI(i, jp1, kp1);
+		(*indices)[7] = Point3UI(ip1, jp1, kp1);
+
+		(*weights)[0] = (1 - fx) * (1 - fy) * (1 - fz);
+		(*weights)[1] = fx * (1 - fy) * (1 - fz);
+		(*weights)[2] = (1 - fx) * fy * (1 - fz);
+		(*weights)[3] = fx * fy * (1 - fz);
+		(*weights)[4] = (1 - fx) * (1 - fy) * fz;
+		(*weights)[5] = fx * (1 - fy) * fz;
+		(*weights)[6] = (1 - fx) * fy * fz;
+		(*weights)[7] = fx * fy * fz;
+
+		(*gradWeights)[0] = Vector3<R>(-m_invGridSpacing.x * (1 - fy) * (1 - fz), -m_invGridSpacing.y * (1 - fx) * (1 - fz), -m_invGridSpacing.z * (1 - fx) * (1 - fy));
+		(*gradWeights)[1] = Vector3<R>(m_invGridSpacing.x * (1 - fy) * (1 - fz), fx * (-m_invGridSpacing.y) * (1 - fz), fx * (1 - fy) * (-m_invGridSpacing.z));
+		(*gradWeights)[2] = Vector3<R>((-m_invGridSpacing.x) * fy * (1 - fz), (1 - fx) * m_invGridSpacing.y * (1 - fz), (1 - fx) * fy * (-m_invGridSpacing.z));
+		(*gradWeights)[3] = Vector3<R>(m_invGridSpacing.x * fy * (1 - fz), fx * m_invGridSpacing.y * (1 - fz), fx * fy * (-m_invGridSpacing.z));
+		(*gradWeights)[4] = Vector3<R>((-m_invGridSpacing.x) * (1 - fy) * fz, (1 - fx) * (-m_invGridSpacing.y) * fz, (1 - fx) * (1 - fy) * m_invGridSpacing.z);
+		(*gradWeights)[5] = Vector3<R>(m_invGridSpacing.x * (1 - fy) * fz, fx * (-m_invGridSpacing.y) * fz, fx * (1 - fy) * m_invGridSpacing.z);
+		(*gradWeights)[6] = Vector3<R>((-m_invGridSpacing.x) * fy * fz, (1 - fx) * m_invGridSpacing.y * fz, (1 - fx) * fy * m_invGridSpacing.z);
+		(*gradWeights)[7] = Vector3<R>(m_invGridSpacing.x * fy * fz, fx * m_invGridSpacing.y * fz, fx * fy * m_invGridSpacing.z);
+	}
+
 	template <typename T, typename R>
 	std::function<T(const Vector3<R>&)> LinearArraySampler<T, R, 3>::Functor() const
 	{
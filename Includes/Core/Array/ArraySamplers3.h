@@ -112,6 +112,20 @@ namespace CubbyFlow
 			std::array<Point3UI, 8>* indices,
 			std::array<Vector3<R>, 8>* weights) const;
 
+		//!
+		//! \brief Returns the indices of points, their sampling weight, and their
+		//! gradient of sampling weight for given point.
+		//!
+		//! This function computes the stencil only once and is equivalent to
+		//! calling GetCoordinatesAndWeights and GetCoordinatesAndGradientWeights
+		//! with the same point. The weights are consistent with operator().
+		//!
+		void GetCoordinatesWeightsAndGradientWeights(
+			const Vector3<R>& pt,
+			std::array<Point3UI, 8>* indices,
+			std::array<R, 8>* weights,
+			std::array<Vector3<R>, 8>* gradWeights) const;
+
 		//! Returns a function object that wraps this instance.
 		std::function<T(const Vector3<R>&)> Functor() const;
 
@@ -14,6 +14,7 @@
 #include <Core/Utils/Parallel.h>
 #include <Core/Utils/TypeHelpers.h>
 
+#include <functional>
 #include <iostream>
 
 namespace CubbyFlow
@@ -48,6 +49,37 @@ namespace CubbyFlow
 		});
 	}
 
+	template <typename ArrayType>
+	size_t ComputeCompactionIndices1(const ArrayType& shouldRemove, size_t size, Array1<size_t>* newIndices)
+	{
+		newIndices->Resize(size);
+		Array1<size_t>& indices = *newIndices;
+
+		ParallelFor(ZERO_SIZE, size, [&](size_t i)
+		{
+			indices[i] = shouldRemove[i] ? 0 : 1;
+		});
+
+		return ParallelExclusiveScan(indices.begin(), indices.end(), indices.begin(), ZERO_SIZE, std::plus<size_t>());
+	}
+
+	template <typename T, typename ArrayType>
+	void Compact1(const ArrayType& shouldRemove, const Array1<size_t>& newIndices, size_t numberOfKeptElements, Array1<T>* data)
+	{
+		Array1<T> compacted(numberOfKeptElements);
+		Array1<T>& input = *data;
+
+		ParallelFor(ZERO_SIZE, newIndices.size(), [&](size_t i)
+		{
+			if (!shouldRemove[i])
+			{
+				compacted[newIndices[i]] = input[i];
+			}
+		});
+
+		data->Swap(compacted);
+	}
+
 	template <typename ArrayType1, typename ArrayType2>
 	void CopyRange2(const ArrayType1& input, size_t sizeX, size_t sizeY, ArrayType2* output)
 	{
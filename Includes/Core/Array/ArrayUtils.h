@@ -9,6 +9,7 @@
 #ifndef CUBBYFLOW_ARRAY_UTILS_H
 #define CUBBYFLOW_ARRAY_UTILS_H
 
+#include <Core/Array/Array1.h>
 #include <Core/Array/ArrayAccessor2.h>
 #include <Core/Array/ArrayAccessor3.h>
 
@@ -50,6 +51,30 @@ namespace CubbyFlow
 	template <typename ArrayType1, typename ArrayType2>
 	void CopyRange1(const ArrayType1& input, size_t begin, size_t end, ArrayType2* output);
 
+	//!
+	//! \brief Computes the destination indices of a stable compaction.
+	//!
+	//! For each of the first \p size elements, \p newIndices stores the number
+	//! of kept elements before it, where an element is kept if its
+	//! \p shouldRemove flag is zero. The prefix sum runs in parallel with
+	//! ParallelExclusiveScan. The input array must support random access
+	//! operator [].
+	//!
+	//! \return Number of kept elements.
+	//!
+	template <typename ArrayType>
+	size_t ComputeCompactionIndices1(const ArrayType& shouldRemove, size_t size, Array1<size_t>* newIndices);
+
+	//!
+	//! \brief Removes the flagged elements of \p data while keeping the order.
+	//!
+	//! This function scatters the elements whose \p shouldRemove flag is zero
+	//! to the indices from ComputeCompactionIndices1 and shrinks \p data to
+	//! \p numberOfKeptElements.
+	//!
+	template <typename T, typename ArrayType>
+	void Compact1(const ArrayType& shouldRemove, const Array1<size_t>& newIndices, size_t numberOfKeptElements, Array1<T>* data);
+
 	//!
 	//! \brief Copies 2-D \p input array to \p output array with \p sizeX and
 	//! \p sizeY.
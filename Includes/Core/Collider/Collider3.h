@@ -9,6 +9,7 @@
 #ifndef CUBBYFLOW_COLLIDER3_H
 #define CUBBYFLOW_COLLIDER3_H
 
+#include <Core/Grid/CellCenteredScalarGrid3.h>
 #include <Core/Surface/Surface3.h>
 
 #include <functional>
@@ -68,6 +69,41 @@ namespace CubbyFlow
 		//! Returns the surface instance.
 		const Surface3Ptr& GetSurface() const;
 
+		//! Returns true if the collider caches the signed distance field of its surface.
+		bool IsUsingSDFCache() const;
+
+		//!
+		//! \brief Sets whether the collider caches the signed distance field of
+		//!        its surface.
+		//!
+		//! The cached field is sampled in the local frame of the surface, so it
+		//! stays valid while the surface only moves rigidly by changing its
+		//! transform. Call Collider3::InvalidateSDFCache when the shape itself
+		//! changes.
+		//!
+		void SetIsUsingSDFCache(bool isUsingSDFCache);
+
+		//!
+		//! \brief Returns the signed distance field of the surface in its local
+		//!        frame.
+		//!
+		//! The field covers the bounding box of the surface padded by a few
+		//! cells and is built once per \p gridSpacing. Returns nullptr if the
+		//! cache is disabled or the surface is unbounded.
+		//!
+		const CellCenteredScalarGrid3Ptr& GetLocalSDF(const Vector3D& gridSpacing);
+
+		//!
+		//! Returns the signed distance used at \p point outside of the cached
+		//! field. Its magnitude is the padding width, which is a lower bound of
+		//! the distance to the surface, and its sign is the side of the surface
+		//! that \p point is on.
+		//!
+		double GetLocalSDFFarValue(const Vector3D& point) const;
+
+		//! Discards the cached signed distance field.
+		void InvalidateSDFCache();
+
 		//! Updates the collider state.
 		void Update(double currentTimeInSeconds, double timeIntervalInSeconds);
 
@@ -106,6 +142,12 @@ namespace CubbyFlow
 		Surface3Ptr m_surface;
 		double m_frictionCoeffient = 0.0;
 		OnBeginUpdateCallback m_onUpdateCallback;
+
+		bool m_isUsingSDFCache = false;
+		bool m_isLocalSDFBuilt = false;
+		Vector3D m_localSDFGridSpacing;
+		CellCenteredScalarGrid3Ptr m_localSDF;
+		double m_localSDFPadding = 0.0;
 	};
 
 	//! Shared pointer type for the Collider3.
@@ -11,6 +11,7 @@
 
 #include <Core/Emitter/ParticleEmitter3.h>
 #include <Core/PointGenerator/PointGenerator3.h>
+#include <Core/Searcher/PointHashGridSearcher3.h>
 #include <Core/Surface/ImplicitSurface3.h>
 
 #include <random>
@@ -136,6 +137,13 @@ namespace CubbyFlow
 		bool m_isOneShot = true;
 		bool m_allowOverlapping = false;
 
+		// Persistent neighbor searcher which only holds the particles near the
+		// emitter bounds for the continuous, non-overlapping emission, and the
+		// positions it was built from followed by the emitted ones.
+		PointHashGridSearcher3Ptr m_neighborSearcher;
+		double m_neighborSearcherSpacing = 0.0;
+		Array1<Vector3D> m_searchedPositions;
+
 		//!
 		//! \brief      Emits particles to the particle system data.
 		//!
@@ -148,6 +156,8 @@ namespace CubbyFlow
 			Array1<Vector3D>* newPositions, Array1<Vector3D>* newVelocities);
 
 		double Random();
+
+		void BuildNeighborSearcher(const ConstArrayAccessor1<Vector3D>& positions, double maxJitterDist);
 	};
 
 	//! Shared pointer for the VolumeParticleEmitter3 type.
@@ -14,6 +14,8 @@
 #include <Core/Size/Size2.h>
 #include <Core/Vector/VectorN.h>
 
+#include <vector>
+
 namespace CubbyFlow
 {
 	//! The row of FDMMatrix2 where row corresponds to (i, j) grid point.
@@ -66,8 +68,23 @@ namespace CubbyFlow
 		//! RHS vector.
 		VectorND b;
 
+		//!
+		//! Row indices grouped by color. Rows with the same color are not
+		//! coupled with each other, so they can be relaxed in parallel. Empty if
+		//! the ordering has not been built.
+		//!
+		std::vector<std::vector<size_t>> colors;
+
 		//! Clears all the data.
 		void Clear();
+
+		//!
+		//! \brief Builds the multicolor ordering from the sparsity of the matrix.
+		//!
+		//! Rows are colored greedily in the natural order, which gives the
+		//! red-black ordering for the standard finite difference stencil.
+		//!
+		void BuildColors();
 	};
 
 	//! BLAS operator wrapper for 2-D finite differencing.
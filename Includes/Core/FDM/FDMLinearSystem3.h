@@ -14,6 +14,8 @@
 #include <Core/Size/Size3.h>
 #include <Core/Vector/VectorN.h>
 
+#include <vector>
+
 namespace CubbyFlow
 {
 	//! The row of FDMMatrix3 where row corresponds to (i, j, k) grid point.
@@ -69,8 +71,23 @@ namespace CubbyFlow
 		//! RHS vector.
 		VectorND b;
 
+		//!
+		//! Row indices grouped by color. Rows with the same color are not
+		//! coupled with each other, so they can be relaxed in parallel. Empty if
+		//! the ordering has not been built.
+		//!
+		std::vector<std::vector<size_t>> colors;
+
 		//! Clears all the data.
 		void Clear();
+
+		//!
+		//! \brief Builds the multicolor ordering from the sparsity of the matrix.
+		//!
+		//! Rows are colored greedily in the natural order, which gives the
+		//! red-black ordering for the standard finite difference stencil.
+		//!
+		void BuildColors();
 	};
 
 	//! BLAS operator wrapper for 3-D finite differencing.
@@ -9,7 +9,9 @@
 #ifndef CUBBYFLOW_SCALAR_FIELD3_H
 #define CUBBYFLOW_SCALAR_FIELD3_H
 
+#include <Core/Array/ArrayAccessor1.h>
 #include <Core/Field/Field3.h>
+#include <Core/Utils/Parallel.h>
 #include <Core/Vector/Vector3.h>
 
 #include <functional>
@@ -30,6 +32,18 @@ namespace CubbyFlow
 		//! Returns sampled value at given position \p x.
 		virtual double Sample(const Vector3D& x) const = 0;
 
+		//!
+		//! \brief Samples the field at every position in \p x.
+		//!
+		//! This function writes the sampled value at x[i] into result[i]. The
+		//! default implementation calls Sample(x[i]) for each position. Grid
+		//! types override it to skip the per-call sampler indirection.
+		//!
+		virtual void BatchSample(
+			const ConstArrayAccessor1<Vector3D>& x,
+			ArrayAccessor1<double> result,
+			ExecutionPolicy policy = ExecutionPolicy::Parallel) const;
+
 		//! Returns gradient vector at given position \p x.
 		virtual Vector3D Gradient(const Vector3D& x) const;
 
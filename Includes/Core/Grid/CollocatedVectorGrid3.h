@@ -80,6 +80,17 @@ namespace CubbyFlow
 		//! Returns sampled value at given position \p x.
 		Vector3D Sample(const Vector3D& x) const override;
 
+		//!
+		//! \brief Samples the data at every position in \p x.
+		//!
+		//! This function calls the linear sampler directly for each position
+		//! instead of going through the sampler function object.
+		//!
+		void BatchSample(
+			const ConstArrayAccessor1<Vector3D>& x,
+			ArrayAccessor1<Vector3D> result,
+			ExecutionPolicy policy = ExecutionPolicy::Parallel) const override;
+
 		//! Returns divergence at given position \p x.
 		double Divergence(const Vector3D& x) const override;
 
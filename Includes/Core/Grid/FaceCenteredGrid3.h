@@ -226,6 +226,19 @@ namespace CubbyFlow
 		//! Returns sampled value at given position \p x.
 		Vector3D Sample(const Vector3D& x) const override;
 
+		//!
+		//! \brief Samples the field at every position in \p x.
+		//!
+		//! The u, v, and w data points share their grid lines along two of the
+		//! three axes, so this function computes the barycentric coordinates of
+		//! each position only once per axis and data alignment, and reuses them
+		//! for all three components. The results are identical to Sample().
+		//!
+		void BatchSample(
+			const ConstArrayAccessor1<Vector3D>& x,
+			ArrayAccessor1<Vector3D> result,
+			ExecutionPolicy policy = ExecutionPolicy::Parallel) const override;
+
 		//! Returns divergence at given position \p x.
 		double Divergence(const Vector3D& x) const override;
 
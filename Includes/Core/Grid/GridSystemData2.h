@@ -189,6 +189,25 @@ namespace CubbyFlow
 		//! Returns the advectable vector data at given index.
 		const VectorGrid2Ptr& GetAdvectableVectorDataAt(size_t idx) const;
 
+		//!
+		//! \brief      Returns the back buffer of the velocity field.
+		//!
+		//! The back buffer has the same type and shape as the velocity field and
+		//! is kept between time steps. Solvers which overwrite the whole field can
+		//! write the new velocity into the back buffer and swap it with the
+		//! velocity field instead of cloning the field every step. The contents
+		//! of the back buffer are undefined until a solver writes into it.
+		//!
+		//! \return     Pointer to the back buffer of the velocity field.
+		//!
+		FaceCenteredGrid2Ptr GetVelocityBackBuffer();
+
+		//! Returns the back buffer of the advectable scalar data at given index.
+		const ScalarGrid2Ptr& GetAdvectableScalarDataBackBufferAt(size_t idx);
+
+		//! Returns the back buffer of the advectable vector data at given index.
+		const VectorGrid2Ptr& GetAdvectableVectorDataBackBufferAt(size_t idx);
+
 		//! Returns the number of non-advectable scalar data.
 		size_t GetNumberOfScalarData() const;
 
@@ -218,6 +237,10 @@ namespace CubbyFlow
 		std::vector<VectorGrid2Ptr> m_vectorDataList;
 		std::vector<ScalarGrid2Ptr> m_advectableScalarDataList;
 		std::vector<VectorGrid2Ptr> m_advectableVectorDataList;
+
+		// Back buffers of the advectable data, built on first use
+		std::vector<ScalarGrid2Ptr> m_advectableScalarBackBufferList;
+		std::vector<VectorGrid2Ptr> m_advectableVectorBackBufferList;
 	};
 
 	//! Shared pointer type of GridSystemData2.
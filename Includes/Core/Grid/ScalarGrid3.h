@@ -134,6 +134,17 @@ namespace CubbyFlow
 		//!
 		double Sample(const Vector3D& x) const override;
 
+		//!
+		//! \brief Samples the data at every position in \p x.
+		//!
+		//! This function calls the linear sampler directly for each position
+		//! instead of going through the sampler function object.
+		//!
+		void BatchSample(
+			const ConstArrayAccessor1<Vector3D>& x,
+			ArrayAccessor1<double> result,
+			ExecutionPolicy policy = ExecutionPolicy::Parallel) const override;
+
 		//!
 		//! \brief Returns the sampler function.
 		//!
@@ -18,6 +18,7 @@
 #ifndef CUBBYFLOW_LEVEL_SET_UTILS_IMPL_H
 #define CUBBYFLOW_LEVEL_SET_UTILS_IMPL_H
 
+#include <Core/Math/MathUtils.h>
 #include <Core/Utils/Constants.h>
 
 #include <algorithm>
@@ -200,6 +201,54 @@ namespace CubbyFlow
 		
 		return static_cast<T>(0.5);
 	}
+
+	template <typename T>
+	T SolveEikonal(T phiX, T phiY, T phiZ, const Vector3<T>& gridSpacing, const Vector3<T>& invGridSpacingSqr)
+	{
+		T phi[3] = { phiX, phiY, phiZ };
+		T h[3] = { gridSpacing.x, gridSpacing.y, gridSpacing.z };
+		T invHSqr[3] = { invGridSpacingSqr.x, invGridSpacingSqr.y, invGridSpacingSqr.z };
+
+		// Sort by neighbor values
+		for (int a = 0; a < 2; ++a)
+		{
+			for (int b = 0; b < 2 - a; ++b)
+			{
+				if (phi[b] > phi[b + 1])
+				{
+					std::swap(phi[b], phi[b + 1]);
+					std::swap(h[b], h[b + 1]);
+					std::swap(invHSqr[b], invHSqr[b + 1]);
+				}
+			}
+		}
+
+		T solution = phi[0] + h[0];
+
+		T a = invHSqr[0];
+		T b = phi[0] * invHSqr[0];
+		T c = Square(phi[0]) * invHSqr[0] - 1;
+
+		for (int n = 1; n < 3; ++n)
+		{
+			if (solution <= phi[n])
+			{
+				break;
+			}
+
+			a += invHSqr[n];
+			b += phi[n] * invHSqr[n];
+			c += Square(phi[n]) * invHSqr[n];
+
+			const T det = b * b - a * c;
+			if (det > 0)
+			{
+				solution = (b + std::sqrt(det)) / a;
+			}
+		}
+
+		return solution;
+	}
 }
 
 #endif
\ No newline at end of file
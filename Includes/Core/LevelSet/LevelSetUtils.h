@@ -9,6 +9,8 @@
 #ifndef CUBBYFLOW_LEVEL_SET_UTILS_H
 #define CUBBYFLOW_LEVEL_SET_UTILS_H
 
+#include <Core/Vector/Vector3.h>
+
 namespace CubbyFlow
 {
 	//!
@@ -99,6 +101,26 @@ namespace CubbyFlow
 	//!
 	template <typename T>
 	T FractionInside(T phiBottomLeft, T phiBottomRight, T phiTopLeft, T phiTopRight);
+
+	//!
+	//! \brief      Solves the 3-D eikonal equation |grad(phi)| = 1 at a cell.
+	//!
+	//! This function returns the upwind Godunov solution from the smallest
+	//! neighbor value along each axis. Only the axes whose neighbor value is
+	//! smaller than the solution contribute to it.
+	//!
+	//! \param[in]  phiX              The smallest neighbor value along X.
+	//! \param[in]  phiY              The smallest neighbor value along Y.
+	//! \param[in]  phiZ              The smallest neighbor value along Z.
+	//! \param[in]  gridSpacing       The grid spacing.
+	//! \param[in]  invGridSpacingSqr The inverse of the squared grid spacing.
+	//!
+	//! \tparam     T                 Value type.
+	//!
+	//! \return     The distance value at the cell.
+	//!
+	template <typename T>
+	T SolveEikonal(T phiX, T phiY, T phiZ, const Vector3<T>& gridSpacing, const Vector3<T>& invGridSpacingSqr);
 }
 
 #include <Core/LevelSet/LevelSetUtils-Impl.h>
@@ -9,6 +9,10 @@
 #ifndef CUBBYFLOW_QUATERNION_IMPL_H
 #define CUBBYFLOW_QUATERNION_IMPL_H
 
+#include <Core/Math/SIMD.h>
+
+#include <type_traits>
+
 namespace CubbyFlow
 {
 	template <typename T>
@@ -222,6 +226,21 @@ namespace CubbyFlow
 		T _2yw = 2 * y * w;
 		T _2zw = 2 * z * w;
 
+		if constexpr (std::is_same<T, double>::value)
+		{
+			// Rotation matrix times the vector
+			const double m[9] =
+			{
+				1 - _2yy - _2zz, _2xy - _2zw, _2xz + _2yw,
+				_2xy + _2zw, 1 - _2zz - _2xx, _2yz - _2xw,
+				_2xz - _2yw, _2yz + _2xw, 1 - _2yy - _2xx
+			};
+
+			Vector3<T> result;
+			SIMDMatVec3x3(m, &v.x, &result.x);
+			return result;
+		}
+
 		return Vector3<T>(
 			(1 - _2yy - _2zz) * v.x + (_2xy - _2zw) * v.y + (_2xz + _2yw) * v.z,
 			(_2xy + _2zw) * v.x + (1 - _2zz - _2xx) * v.y + (_2yz - _2xw) * v.z,
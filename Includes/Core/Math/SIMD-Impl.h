@@ -0,0 +1,113 @@
+/*************************************************************************
+> File Name: SIMD-Impl.h
+> Project Name: CubbyFlow
+> Author: Chan-Ho Chris Ohk
+> Purpose: SIMD kernels for the small vector and matrix types.
+> Created Time: 2026/10/19
+> Copyright (c) 2018, Chan-Ho Chris Ohk
+*************************************************************************/
+#ifndef CUBBYFLOW_SIMD_IMPL_H
+#define CUBBYFLOW_SIMD_IMPL_H
+
+namespace CubbyFlow
+{
+	inline double SIMDDot3(const double* a, const double* b)
+	{
+#if defined(CUBBYFLOW_SIMD_SSE2)
+		// (a.x * b.x, a.y * b.y), then add the high lane and the z product
+		const __m128d xy = _mm_mul_pd(_mm_loadu_pd(a), _mm_loadu_pd(b));
+		__m128d sum = _mm_add_sd(xy, _mm_unpackhi_pd(xy, xy));
+		sum = _mm_add_sd(sum, _mm_mul_sd(_mm_load_sd(a + 2), _mm_load_sd(b + 2)));
+
+		return _mm_cvtsd_f64(sum);
+#else
+		return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+#endif
+	}
+
+	inline void SIMDMatVec3x3(const double* m, const double* v, double* result)
+	{
+#if defined(CUBBYFLOW_SIMD_AVX2)
+		// Columns of the matrix scaled by the vector components
+		const __m256d c0 = _mm256_set_pd(0.0, m[6], m[3], m[0]);
+		const __m256d c1 = _mm256_set_pd(0.0, m[7], m[4], m[1]);
+		const __m256d c2 = _mm256_set_pd(0.0, m[8], m[5], m[2]);
+
+		__m256d sum = _mm256_add_pd(
+			_mm256_mul_pd(_mm256_set1_pd(v[0]), c0),
+			_mm256_mul_pd(_mm256_set1_pd(v[1]), c1));
+		sum = _mm256_add_pd(sum, _mm256_mul_pd(_mm256_set1_pd(v[2]), c2));
+
+		double out[4];
+		_mm256_storeu_pd(out, sum);
+
+		result[0] = out[0];
+		result[1] = out[1];
+		result[2] = out[2];
+#elif defined(CUBBYFLOW_SIMD_SSE2)
+		// First two rows in the lanes, the last row in scalar
+		__m128d sum = _mm_add_pd(
+			_mm_mul_pd(_mm_set1_pd(v[0]), _mm_set_pd(m[3], m[0])),
+			_mm_mul_pd(_mm_set1_pd(v[1]), _mm_set_pd(m[4], m[1])));
+		sum = _mm_add_pd(sum, _mm_mul_pd(_mm_set1_pd(v[2]), _mm_set_pd(m[5], m[2])));
+		const double z = v[0] * m[6] + v[1] * m[7] + v[2] * m[8];
+
+		_mm_storeu_pd(result, sum);
+		result[2] = z;
+#else
+		const double x = v[0] * m[0] + v[1] * m[1] + v[2] * m[2];
+		const double y = v[0] * m[3] + v[1] * m[4] + v[2] * m[5];
+		const double z = v[0] * m[6] + v[1] * m[7] + v[2] * m[8];
+
+		result[0] = x;
+		result[1] = y;
+		result[2] = z;
+#endif
+	}
+
+	inline void SIMDMatMat3x3(const double* a, const double* b, double* result)
+	{
+#if defined(CUBBYFLOW_SIMD_AVX2)
+		// Each row of the result is a combination of the rows of b
+		const __m256i mask = _mm256_set_epi64x(0, -1, -1, -1);
+		const __m256d b0 = _mm256_maskload_pd(b, mask);
+		const __m256d b1 = _mm256_maskload_pd(b + 3, mask);
+		const __m256d b2 = _mm256_maskload_pd(b + 6, mask);
+
+		for (int i = 0; i < 9; i += 3)
+		{
+			__m256d row = _mm256_add_pd(
+				_mm256_mul_pd(_mm256_set1_pd(a[i]), b0),
+				_mm256_mul_pd(_mm256_set1_pd(a[i + 1]), b1));
+			row = _mm256_add_pd(row, _mm256_mul_pd(_mm256_set1_pd(a[i + 2]), b2));
+
+			_mm256_maskstore_pd(result + i, mask, row);
+		}
+#elif defined(CUBBYFLOW_SIMD_SSE2)
+		// First two columns in the lanes, the last column in scalar
+		const __m128d b0 = _mm_loadu_pd(b);
+		const __m128d b1 = _mm_loadu_pd(b + 3);
+		const __m128d b2 = _mm_loadu_pd(b + 6);
+
+		for (int i = 0; i < 9; i += 3)
+		{
+			__m128d row = _mm_add_pd(
+				_mm_mul_pd(_mm_set1_pd(a[i]), b0),
+				_mm_mul_pd(_mm_set1_pd(a[i + 1]), b1));
+			row = _mm_add_pd(row, _mm_mul_pd(_mm_set1_pd(a[i + 2]), b2));
+
+			_mm_storeu_pd(result + i, row);
+			result[i + 2] = a[i] * b[2] + a[i + 1] * b[5] + a[i + 2] * b[8];
+		}
+#else
+		for (int i = 0; i < 9; i += 3)
+		{
+			result[i] = a[i] * b[0] + a[i + 1] * b[3] + a[i + 2] * b[6];
+			result[i + 1] = a[i] * b[1] + a[i + 1] * b[4] + a[i + 2] * b[7];
+			result[i + 2] = a[i] * b[2] + a[i + 1] * b[5] + a[i + 2] * b[8];
+		}
+#endif
+	}
+}
+
+#endif
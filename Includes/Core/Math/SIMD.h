@@ -0,0 +1,62 @@
+/*************************************************************************
+> File Name: SIMD.h
+> Project Name: CubbyFlow
+> Author: Chan-Ho Chris Ohk
+> Purpose: SIMD kernels for the small vector and matrix types.
+> Created Time: 2026/10/19
+> Copyright (c) 2018, Chan-Ho Chris Ohk
+*************************************************************************/
+#ifndef CUBBYFLOW_SIMD_H
+#define CUBBYFLOW_SIMD_H
+
+//
+// The backend is chosen at compile time with the CUBBYFLOW_SIMD build option,
+// which defines CUBBYFLOW_SIMD_SSE2 or CUBBYFLOW_SIMD_AVX2. Without either of
+// them the kernels fall back to scalar code.
+//
+#if defined(CUBBYFLOW_SIMD_AVX2) && !defined(CUBBYFLOW_SIMD_SSE2)
+#	define CUBBYFLOW_SIMD_SSE2
+#endif
+
+#if defined(CUBBYFLOW_SIMD_AVX2)
+#	include <immintrin.h>
+#elif defined(CUBBYFLOW_SIMD_SSE2)
+#	include <emmintrin.h>
+#endif
+
+namespace CubbyFlow
+{
+	//!
+	//! \brief Returns the dot product of two 3-D vectors.
+	//!
+	//! The kernels in this file add the products in the same order as the
+	//! scalar code of Vector3, Matrix3x3 and Quaternion and do not fuse
+	//! multiplies and adds, so every backend gives bit-identical results.
+	//!
+	//! \param a First vector (three doubles).
+	//! \param b Second vector (three doubles).
+	//!
+	inline double SIMDDot3(const double* a, const double* b);
+
+	//!
+	//! \brief Computes the product of a row-major 3x3 matrix and a 3-D vector.
+	//!
+	//! \param m Row-major matrix (nine doubles).
+	//! \param v Input vector (three doubles).
+	//! \param result Output vector (three doubles).
+	//!
+	inline void SIMDMatVec3x3(const double* m, const double* v, double* result);
+
+	//!
+	//! \brief Computes the product of two row-major 3x3 matrices.
+	//!
+	//! \param a Left matrix (nine doubles).
+	//! \param b Right matrix (nine doubles).
+	//! \param result Output matrix (nine doubles) which may not alias the inputs.
+	//!
+	inline void SIMDMatMat3x3(const double* a, const double* b, double* result);
+}
+
+#include <Core/Math/SIMD-Impl.h>
+
+#endif
@@ -9,6 +9,9 @@
 #ifndef CUBBYFLOW_SVD_IMPL_H
 #define CUBBYFLOW_SVD_IMPL_H
 
+#include <cmath>
+#include <limits>
+
 namespace CubbyFlow
 {
 	namespace Internal
@@ -770,6 +773,76 @@ namespace CubbyFlow
 			}
 		}
 	}
+
+	template <typename T>
+	void SymmetricEigenDecomposition(const Matrix3x3<T>& a, Vector3<T>& d, Matrix3x3<T>& v)
+	{
+		// Diagonal and upper off-diagonal elements of the working matrix, and
+		// the accumulated rotations
+		T app[3] = { a(0, 0), a(1, 1), a(2, 2) };
+		T apq[3] = { a(0, 1), a(0, 2), a(1, 2) };
+		T rot[3][3] = { { 1, 0, 0 }, { 0, 1, 0 }, { 0, 0, 1 } };
+
+		// Row and column of each off-diagonal element
+		constexpr int P[3] = { 0, 0, 1 };
+		constexpr int Q[3] = { 1, 2, 2 };
+		// Off-diagonal elements (p, r) and (q, r) touched by the rotation of (p, q)
+		constexpr int PR[3] = { 1, 0, 0 };
+		constexpr int QR[3] = { 2, 2, 1 };
+
+		// Converges quadratically, a few sweeps reach machine precision
+		constexpr int maxNumberOfSweeps = 5;
+		const T tolerance = std::numeric_limits<T>::epsilon() * std::numeric_limits<T>::epsilon();
+
+		for (int sweep = 0; sweep < maxNumberOfSweeps; ++sweep)
+		{
+			const T offDiagonal = apq[0] * apq[0] + apq[1] * apq[1] + apq[2] * apq[2];
+			const T diagonal = app[0] * app[0] + app[1] * app[1] + app[2] * app[2];
+
+			if (offDiagonal <= tolerance * diagonal)
+			{
+				break;
+			}
+
+			for (int k = 0; k < 3; ++k)
+			{
+				const int p = P[k];
+				const int q = Q[k];
+				const T x = apq[k];
+				const T tau = app[q] - app[p];
+
+				// Tangent of the rotation angle, which also handles x = 0
+				const T numerator = (tau >= 0 ? 2 : -2) * x;
+				const T denominator = std::fabs(tau) + std::sqrt(tau * tau + 4 * x * x);
+				const T t = (denominator > 0) ? numerator / denominator : 0;
+				const T c = 1 / std::sqrt(1 + t * t);
+				const T s = t * c;
+
+				app[p] -= t * x;
+				app[q] += t * x;
+				apq[k] = 0;
+
+				const T arp = apq[PR[k]];
+				const T arq = apq[QR[k]];
+				apq[PR[k]] = c * arp - s * arq;
+				apq[QR[k]] = s * arp + c * arq;
+
+				for (int i = 0; i < 3; ++i)
+				{
+					const T vip = rot[i][p];
+					const T viq = rot[i][q];
+					rot[i][p] = c * vip - s * viq;
+					rot[i][q] = s * vip + c * viq;
+				}
+			}
+		}
+
+		d = Vector3<T>(app[0], app[1], app[2]);
+		v = Matrix3x3<T>(
+			rot[0][0], rot[0][1], rot[0][2],
+			rot[1][0], rot[1][1], rot[1][2],
+			rot[2][0], rot[2][1], rot[2][2]);
+	}
 }
 
 #endif
\ No newline at end of file
@@ -46,6 +46,24 @@ namespace CubbyFlow
 	//!
 	template <typename T, size_t M, size_t N>
 	void SVD(const Matrix<T, M, N>& a, Matrix<T, M, N>& u, Vector<T, N>& w, Matrix<T, N, N>& v);
+
+	//!
+	//! \brief Eigendecomposition of a symmetric 3x3 matrix.
+	//!
+	//! This function decomposes the symmetric input matrix \p a to
+	//! \p v * diag(\p d) * \p v^T using cyclic Jacobi rotations. For symmetric
+	//! positive semi-definite matrices such as covariance matrices, this is
+	//! the same as the SVD with u = v and w = d, but much cheaper than the
+	//! generic Golub-Kahan path. Only the upper triangle of \p a is read.
+	//!
+	//! \tparam T Real-value type.
+	//!
+	//! \param a The symmetric input matrix to decompose.
+	//! \param d The vector of eigenvalues.
+	//! \param v The orthogonal matrix whose columns are the eigenvectors.
+	//!
+	template <typename T>
+	void SymmetricEigenDecomposition(const Matrix3x3<T>& a, Vector3<T>& d, Matrix3x3<T>& v);
 }
 
 #include <Core/Math/SVD-Impl.h>
@@ -9,7 +9,10 @@
 #ifndef CUBBYFLOW_MATRIX3X3_IMPL_H
 #define CUBBYFLOW_MATRIX3X3_IMPL_H
 
+#include <Core/Math/SIMD.h>
+
 #include <cassert>
+#include <type_traits>
 
 namespace CubbyFlow
 {
@@ -258,6 +261,13 @@ namespace CubbyFlow
 	template <typename T>
 	Vector3<T> Matrix<T, 3, 3>::Mul(const Vector3<T> & v) const
 	{
+		if constexpr (std::is_same<T, double>::value)
+		{
+			Vector<T, 3> result;
+			SIMDMatVec3x3(m_elements.data(), &v.x, &result.x);
+			return result;
+		}
+
 		return Vector<T, 3>(
 			v.x * m_elements[0] + v.y * m_elements[1] + v.z * m_elements[2],
 			v.x * m_elements[3] + v.y * m_elements[4] + v.z * m_elements[5],
@@ -267,6 +277,13 @@ namespace CubbyFlow
 	template <typename T>
 	Matrix<T, 3, 3> Matrix<T, 3, 3>::Mul(const Matrix& m) const
 	{
+		if constexpr (std::is_same<T, double>::value)
+		{
+			Matrix result;
+			SIMDMatMat3x3(m_elements.data(), m.m_elements.data(), result.m_elements.data());
+			return result;
+		}
+
 		return Matrix(
 			m_elements[0] * m.m_elements[0] + m_elements[1] * m.m_elements[3] + m_elements[2] * m.m_elements[6],
 			m_elements[0] * m.m_elements[1] + m_elements[1] * m.m_elements[4] + m_elements[2] * m.m_elements[7],
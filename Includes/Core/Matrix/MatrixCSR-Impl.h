@@ -12,6 +12,7 @@
 #include <Core/Utils/CppUtils.h>
 #include <Core/Utils/Parallel.h>
 
+#include <functional>
 #include <numeric>
 
 namespace CubbyFlow
@@ -126,6 +127,13 @@ namespace CubbyFlow
 		Compress(other, epsilon);
 	}
 
+	template <typename T>
+	template <typename RowSizeFunc, typename RowFillFunc>
+	MatrixCSR<T>::MatrixCSR(size_t rows, size_t cols, const RowSizeFunc& rowSize, const RowFillFunc& rowFill)
+	{
+		Build(rows, cols, rowSize, rowFill);
+	}
+
 	template <typename T>
 	MatrixCSR<T>::MatrixCSR(const MatrixCSR& other)
 	{
@@ -274,6 +282,59 @@ namespace CubbyFlow
 		}
 	}
 
+	template <typename T>
+	template <typename RowSizeFunc, typename RowFillFunc>
+	void MatrixCSR<T>::Build(size_t rows, size_t cols, const RowSizeFunc& rowSize, const RowFillFunc& rowFill)
+	{
+		m_size = Size2(rows, cols);
+		m_rowPointers.resize(rows + 1);
+
+		ParallelFor(ZERO_SIZE, rows, [&](size_t i)
+		{
+			m_rowPointers[i] = rowSize(i);
+		});
+
+		// The row sizes turn into the row pointers in place
+		m_rowPointers[rows] = ParallelExclusiveScan(m_rowPointers.begin(), m_rowPointers.begin() + rows,
+			m_rowPointers.begin(), ZERO_SIZE, std::plus<size_t>());
+
+		m_nonZeros.assign(m_rowPointers[rows], T());
+		m_columnIndices.assign(m_rowPointers[rows], 0);
+
+		ParallelFor(ZERO_SIZE, rows, [&](size_t i)
+		{
+			const size_t rowBegin = m_rowPointers[i];
+			const size_t rowEnd = m_rowPointers[i + 1];
+
+			const auto colBegin = m_columnIndices.begin() + rowBegin;
+			const auto colEnd = m_columnIndices.begin() + rowEnd;
+
+			rowFill(i, m_nonZeros.begin() + rowBegin, colBegin);
+
+			if (std::is_sorted(colBegin, colEnd))
+			{
+				return;
+			}
+
+			std::vector<std::pair<T, size_t>> zipped;
+			for (size_t jj = rowBegin; jj < rowEnd; ++jj)
+			{
+				zipped.emplace_back(m_nonZeros[jj], m_columnIndices[jj]);
+			}
+
+			std::sort(zipped.begin(), zipped.end(), [](const std::pair<T, size_t>& a, const std::pair<T, size_t>& b)
+			{
+				return a.second < b.second;
+			});
+
+			for (size_t jj = rowBegin; jj < rowEnd; ++jj)
+			{
+				m_nonZeros[jj] = zipped[jj - rowBegin].first;
+				m_columnIndices[jj] = zipped[jj - rowBegin].second;
+			}
+		});
+	}
+
 	template <typename T>
 	void MatrixCSR<T>::AddRow(const NonZeroContainerType& nonZeros, const IndexContainerType& columnIndices)
 	{
@@ -548,6 +609,55 @@ namespace CubbyFlow
 		return m_columnIndices.cend();
 	}
 
+	template <typename T>
+	template <typename Callback>
+	void MatrixCSR<T>::ParallelForEachRowBlock(const Callback& func) const
+	{
+		const size_t rows = m_size.x;
+		if (rows == 0)
+		{
+			return;
+		}
+
+		// Each row costs its non-zeros plus one for writing the row result, so
+		// the cost of the first i rows is rowPointers[i] + i which is strictly
+		// increasing in i
+		const size_t totalCost = m_rowPointers[rows] + rows;
+		const size_t numBlocks = std::min(rows, 4 * static_cast<size_t>(GetMaxNumberOfThreads()));
+
+		auto blockBegin = [&](size_t block) -> size_t
+		{
+			const size_t targetCost = block * totalCost / numBlocks;
+
+			size_t lo = 0, hi = rows;
+			while (lo < hi)
+			{
+				const size_t mid = lo + (hi - lo) / 2;
+				if (m_rowPointers[mid] + mid < targetCost)
+				{
+					lo = mid + 1;
+				}
+				else
+				{
+					hi = mid;
+				}
+			}
+
+			return lo;
+		};
+
+		ParallelFor(ZERO_SIZE, numBlocks, [&](size_t block)
+		{
+			const size_t rowBegin = blockBegin(block);
+			const size_t rowEnd = (block + 1 == numBlocks) ? rows : blockBegin(block + 1);
+
+			if (rowBegin < rowEnd)
+			{
+				func(rowBegin, rowEnd);
+			}
+		});
+	}
+
 	template <typename T>
 	MatrixCSR<T> MatrixCSR<T>::Add(const T& s) const
 	{
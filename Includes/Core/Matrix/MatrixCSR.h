@@ -154,6 +154,14 @@ namespace CubbyFlow
 		template <typename E>
 		MatrixCSR(const MatrixExpression<T, E>& other, T epsilon = std::numeric_limits<T>::epsilon());
 
+		//!
+		//! \brief Constructs a matrix row by row in parallel.
+		//!
+		//! \see Build
+		//!
+		template <typename RowSizeFunc, typename RowFillFunc>
+		MatrixCSR(size_t rows, size_t cols, const RowSizeFunc& rowSize, const RowFillFunc& rowFill);
+
 		//! Copy constructor.
 		MatrixCSR(const MatrixCSR& other);
 
@@ -221,6 +229,24 @@ namespace CubbyFlow
 		//!
 		void AddRow(const NonZeroContainerType& nonZeros, const IndexContainerType& columnIndices);
 
+		//!
+		//! \brief Builds the whole matrix row by row in parallel.
+		//!
+		//! The matrix is built in three passes instead of appending the rows one
+		//! after another: \p rowSize(i) returns the number of non-zero elements of
+		//! row i for every row in parallel, the row pointers are computed from the
+		//! prefix sum of the sizes, and \p rowFill(i, nonZeros, columnIndices)
+		//! writes the elements of row i to the given iterators in parallel. The
+		//! filled rows are sorted by their column indices afterwards if needed.
+		//!
+		//! \param rows - Number of rows.
+		//! \param cols - Number of columns.
+		//! \param rowSize - Function that returns the number of non-zeros of a row.
+		//! \param rowFill - Function that writes the non-zeros of a row.
+		//!
+		template <typename RowSizeFunc, typename RowFillFunc>
+		void Build(size_t rows, size_t cols, const RowSizeFunc& rowSize, const RowFillFunc& rowFill);
+
 		//! Sets non-zero element to (i, j).
 		void SetElement(size_t i, size_t j, const T& value);
 
@@ -308,6 +334,17 @@ namespace CubbyFlow
 		//! Returns the end const iterator of the column indices.
 		ConstIndexIterator ColumnIndicesEnd() const;
 
+		//!
+		//! \brief Invokes \p func(rowBegin, rowEnd) for blocks of rows in parallel.
+		//!
+		//! The rows are split into contiguous blocks which hold about the same
+		//! number of non-zero elements, so matrices with uneven row lengths keep
+		//! every thread equally busy. This is the scheduling used by the sparse
+		//! matrix-vector products of the solvers.
+		//!
+		template <typename Callback>
+		void ParallelForEachRowBlock(const Callback& func) const;
+
 		// MARK: Binary operator methods - new instance = this instance (+) input
 		//! Returns this matrix + input scalar.
 		MatrixCSR Add(const T& s) const;
@@ -14,6 +14,7 @@
 #include <Core/Utils/Serialization.h>
 #include <Core/Vector/Vector3.h>
 
+#include <functional>
 #include <memory>
 #include <vector>
 
@@ -180,6 +181,29 @@ namespace CubbyFlow
 			const ConstArrayAccessor1<Vector3D>& newVelocities = ConstArrayAccessor1<Vector3D>(),
 			const ConstArrayAccessor1<Vector3D>& newForces = ConstArrayAccessor1<Vector3D>());
 
+		//!
+		//! \brief      Removes the particles whose \p shouldRemove flag is set.
+		//!
+		//! This function compacts every scalar and vector data layer in parallel
+		//! while the remaining particles keep their order. The neighbor lists
+		//! are remapped to the new indices and the neighbor searcher is rebuilt
+		//! with the remaining positions.
+		//!
+		//! \param[in]  shouldRemove    Nonzero for the particles to remove.
+		//!
+		//! \return     Number of removed particles.
+		//!
+		size_t RemoveParticles(const ConstArrayAccessor1<char>& shouldRemove);
+
+		//!
+		//! \brief      Removes the particles for which \p predicate returns true.
+		//!
+		//! The predicate takes the particle index and is evaluated in parallel.
+		//!
+		//! \return     Number of removed particles.
+		//!
+		size_t RemoveParticles(const std::function<bool(size_t)>& predicate);
+
 		//!
 		//! \brief      Returns neighbor searcher.
 		//!
@@ -153,6 +153,29 @@ namespace CubbyFlow
 		//! Builds neighbor lists with kernel radius.
 		void BuildNeighborLists();
 
+		//! Returns the neighbor list skin relative to the kernel radius.
+		double GetNeighborListSkin() const;
+
+		//!
+		//! \brief Sets the neighbor list skin relative to the kernel radius.
+		//!
+		//! With a positive skin, UpdateNeighborLists builds the lists with the
+		//! kernel radius times (1 + skin) and reuses them until a particle has
+		//! moved more than half the skin. The lists may then hold particles
+		//! outside the kernel radius, which every SPH kernel weighs zero. The
+		//! neighbor searcher is only refreshed together with the lists, so
+		//! UpdateDensities sums over the lists instead. Default is 0, which
+		//! rebuilds the lists on every update.
+		//!
+		void SetNeighborListSkin(double skin);
+
+		//!
+		//! \brief Builds the neighbor searcher and lists if they are out of date.
+		//!
+		//! \return True if the searcher and the lists were rebuilt.
+		//!
+		bool UpdateNeighborLists();
+
 		//! Serializes this SPH system data to the buffer.
 		void Serialize(std::vector<uint8_t>* buffer) const override;
 
@@ -183,6 +206,15 @@ namespace CubbyFlow
 
 		size_t m_densityIdx;
 
+		//! Skin of the neighbor lists relative to the kernel radius.
+		double m_neighborListSkin = 0.0;
+
+		//! Search radius of the last UpdateNeighborLists build.
+		double m_neighborListRadius = 0.0;
+
+		//! Particle positions at the last UpdateNeighborLists build.
+		Array1<Vector3D> m_neighborListPositions;
+
 		//! Computes the mass based on the target density and spacing.
 		void ComputeMass();
 	};
@@ -21,7 +21,9 @@ namespace CubbyFlow
 	//!
 	//! This class implements 3-D point searcher by using hash grid for its internal
 	//! acceleration data structure. Each point is recorded to its corresponding
-	//! bucket where the hashing function is 3-D grid mapping.
+	//! bucket where the hashing function is 3-D grid mapping. The buckets are
+	//! stored flat: the points are sorted by their hash keys with a counting sort,
+	//! so that the points of a bucket are contiguous in memory.
 	//!
 	class PointHashGridSearcher3 final : public PointNeighborSearcher3
 	{
@@ -91,21 +93,48 @@ namespace CubbyFlow
 		//!
 		//! This function adds a single point to the hash grid for future queries.
 		//! It can be used for a hash grid that is already built by calling function
-		//! PointHashGridSearcher3::build.
+		//! PointHashGridSearcher3::build. Points added after the build are
+		//! chained to their buckets instead of being inserted to the sorted list.
 		//!
 		//! \param[in]  point The point to be added.
 		//!
 		void Add(const Vector3D& point);
 
 		//!
-		//! \brief      Returns the internal bucket.
+		//! \brief      Returns the buckets.
 		//!
-		//! A bucket is a list of point indices that has same hash value. This
-		//! function returns the (immutable) internal bucket structure.
+		//! A bucket is a list of point indices that has same hash value. The
+		//! buckets are stored flat, so this function allocates and fills a new
+		//! list of buckets which costs O(N) per call.
+		//!
+		//! \deprecated Use GetBucketStarts and GetSortedIndices instead.
 		//!
 		//! \return     List of buckets.
 		//!
-		const std::vector<std::vector<size_t>>& GetBuckets() const;
+		std::vector<std::vector<size_t>> GetBuckets() const;
+
+		//!
+		//! \brief      Returns the start of each bucket in the sorted index list.
+		//!
+		//! The points of bucket \p key are GetSortedIndices()[i] for i in
+		//! [GetBucketStarts()[key], GetBucketStarts()[key + 1]). The list has one
+		//! more entry than the number of buckets, and is empty before the first
+		//! build. Points added after the build are not part of these ranges.
+		//!
+		//! \return     The bucket start offsets.
+		//!
+		const std::vector<size_t>& GetBucketStarts() const;
+
+		//!
+		//! \brief      Returns the point indices sorted by bucket.
+		//!
+		//! The indices of the built points come first, grouped by bucket as
+		//! described in GetBucketStarts. The indices of the points added after
+		//! the build follow in the order they were added.
+		//!
+		//! \return     The sorted point indices.
+		//!
+		const std::vector<size_t>& GetSortedIndices() const;
 
 		//!
 		//! Returns the hash value for given 3-D bucket index.
@@ -152,10 +181,15 @@ namespace CubbyFlow
 		double m_gridSpacing = 1.0;
 		Point3I m_resolution = Point3I(1, 1, 1);
 		std::vector<Vector3D> m_points;
-		std::vector<std::vector<size_t>> m_buckets;
+		std::vector<size_t> m_sortedIndices;
+		std::vector<size_t> m_bucketStarts;
+		std::vector<size_t> m_addedHeads;
+		std::vector<size_t> m_addedNexts;
 
 		size_t GetHashKeyFromPosition(const Vector3D& position) const;
 
+		void GetBucket(size_t key, std::vector<size_t>* bucket) const;
+
 		void GetNearbyKeys(const Vector3D& position, size_t* nearbyKeys) const;
 	};
 
@@ -56,6 +56,30 @@ namespace CubbyFlow
 			ScalarGrid3* output,
 			const ScalarField3& boundarySDF = ConstantScalarField3(std::numeric_limits<double>::max())) final;
 
+		//!
+		//! \brief Computes semi-Lagrangian for given scalar grid at the listed
+		//!        data points only.
+		//!
+		//! This function back-traces only the data points \p dataPoints of
+		//! \p input and stores the solution at dataPoints[n] in output[n]. The
+		//! points inside the boundary keep their input values.
+		//!
+		//! \param input Input scalar grid.
+		//! \param flow Vector field that advects the input field.
+		//! \param dt Time-step for the advection.
+		//! \param dataPoints Data point indices to compute the solution.
+		//! \param output Output values for each data point.
+		//! \param boundarySDF Boundary interface defined by signed-distance
+		//!     field.
+		//!
+		void Advect(
+			const ScalarGrid3& input,
+			const VectorField3& flow,
+			double dt,
+			const ConstArrayAccessor1<Point3UI>& dataPoints,
+			ArrayAccessor1<double> output,
+			const ScalarField3& boundarySDF = ConstantScalarField3(std::numeric_limits<double>::max())) final;
+
 		//!
 		//! \brief Computes semi-Lagrangian for given collocated vector grid.
 		//!
@@ -107,6 +131,50 @@ namespace CubbyFlow
 			FaceCenteredGrid3* output,
 			const ScalarField3& boundarySDF = ConstantScalarField3(std::numeric_limits<double>::max())) final;
 
+		//!
+		//! \brief Computes semi-Lagrangian for several scalar grids carried by
+		//!        the same flow.
+		//!
+		//! The grids are grouped by their data layout, and each group is
+		//! advected in a single pass: every data point is traced back once and
+		//! all the grids in the group are sampled at the departure point. The
+		//! solution of inputs[n] is stored in outputs[n].
+		//!
+		//! \param inputs Input scalar grids.
+		//! \param flow Vector field that advects the input fields.
+		//! \param dt Time-step for the advection.
+		//! \param outputs Output scalar grids.
+		//! \param boundarySDF Boundary interface defined by signed-distance
+		//!     field.
+		//!
+		void Advect(
+			const std::vector<const ScalarGrid3*>& inputs,
+			const VectorField3& flow,
+			double dt,
+			const std::vector<ScalarGrid3*>& outputs,
+			const ScalarField3& boundarySDF = ConstantScalarField3(std::numeric_limits<double>::max())) final;
+
+		//!
+		//! \brief Computes semi-Lagrangian for several collocated vector grids
+		//!        carried by the same flow.
+		//!
+		//! Same as the scalar version, the grids sharing the same data layout
+		//! are advected in a single pass with one back-trace per data point.
+		//!
+		//! \param inputs Input vector grids.
+		//! \param flow Vector field that advects the input fields.
+		//! \param dt Time-step for the advection.
+		//! \param outputs Output vector grids.
+		//! \param boundarySDF Boundary interface defined by signed-distance
+		//!     field.
+		//!
+		void Advect(
+			const std::vector<const CollocatedVectorGrid3*>& inputs,
+			const VectorField3& flow,
+			double dt,
+			const std::vector<CollocatedVectorGrid3*>& outputs,
+			const ScalarField3& boundarySDF = ConstantScalarField3(std::numeric_limits<double>::max())) final;
+
 	protected:
 		//!
 		//! \brief Returns spatial interpolation function object for given scalar grid.
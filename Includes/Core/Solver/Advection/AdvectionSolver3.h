@@ -9,11 +9,15 @@
 #ifndef CUBBYFLOW_ADVECTION_SOLVER3_H
 #define CUBBYFLOW_ADVECTION_SOLVER3_H
 
+#include <Core/Array/ArrayAccessor1.h>
 #include <Core/Field/ConstantScalarField3.h>
 #include <Core/Field/VectorField3.h>
 #include <Core/Grid/CollocatedVectorGrid3.h>
 #include <Core/Grid/FaceCenteredGrid3.h>
 #include <Core/Grid/ScalarGrid3.h>
+#include <Core/Point/Point3.h>
+
+#include <vector>
 
 namespace CubbyFlow
 {
@@ -56,6 +60,34 @@ namespace CubbyFlow
 			ScalarGrid3* output,
 			const ScalarField3& boundarySDF = ConstantScalarField3(std::numeric_limits<double>::max())) = 0;
 
+		//!
+		//! \brief Solves advection equation for given scalar grid at the listed
+		//!        data points only.
+		//!
+		//! This function computes the same solution as the full-grid version, but
+		//! only at the data points \p dataPoints of \p input. The solution at
+		//! dataPoints[n] is stored in output[n], so the input grid stays intact and
+		//! can be updated in-place afterward. The points inside the boundary keep
+		//! their input values. By default, the whole grid is advected and the
+		//! listed points are gathered from it, so the implementations which can
+		//! evaluate each point independently should override this function.
+		//!
+		//! \param input Input scalar grid.
+		//! \param flow Vector field that advects the input field.
+		//! \param dt Time-step for the advection.
+		//! \param dataPoints Data point indices to compute the solution.
+		//! \param output Output values for each data point.
+		//! \param boundarySDF Boundary interface defined by signed-distance
+		//!     field.
+		//!
+		virtual void Advect(
+			const ScalarGrid3& input,
+			const VectorField3& flow,
+			double dt,
+			const ConstArrayAccessor1<Point3UI>& dataPoints,
+			ArrayAccessor1<double> output,
+			const ScalarField3& boundarySDF = ConstantScalarField3(std::numeric_limits<double>::max()));
+
 		//!
 		//! \brief Solves advection equation for given collocated vector grid.
 		//!
@@ -107,6 +139,52 @@ namespace CubbyFlow
 			double dt,
 			FaceCenteredGrid3* output,
 			const ScalarField3& boundarySDF = ConstantScalarField3(std::numeric_limits<double>::max()));
+
+		//!
+		//! \brief Solves advection equation for several scalar grids carried by
+		//!        the same flow.
+		//!
+		//! The solution of inputs[n] is stored in outputs[n]. The grids that
+		//! share the same data layout can be advected in a single pass which
+		//! traces each data point back only once. By default, this function
+		//! advects each grid separately.
+		//!
+		//! \param inputs Input scalar grids.
+		//! \param flow Vector field that advects the input fields.
+		//! \param dt Time-step for the advection.
+		//! \param outputs Output scalar grids.
+		//! \param boundarySDF Boundary interface defined by signed-distance
+		//!     field.
+		//!
+		virtual void Advect(
+			const std::vector<const ScalarGrid3*>& inputs,
+			const VectorField3& flow,
+			double dt,
+			const std::vector<ScalarGrid3*>& outputs,
+			const ScalarField3& boundarySDF = ConstantScalarField3(std::numeric_limits<double>::max()));
+
+		//!
+		//! \brief Solves advection equation for several collocated vector grids
+		//!        carried by the same flow.
+		//!
+		//! The solution of inputs[n] is stored in outputs[n]. The grids that
+		//! share the same data layout can be advected in a single pass which
+		//! traces each data point back only once. By default, this function
+		//! advects each grid separately.
+		//!
+		//! \param inputs Input vector grids.
+		//! \param flow Vector field that advects the input fields.
+		//! \param dt Time-step for the advection.
+		//! \param outputs Output vector grids.
+		//! \param boundarySDF Boundary interface defined by signed-distance
+		//!     field.
+		//!
+		virtual void Advect(
+			const std::vector<const CollocatedVectorGrid3*>& inputs,
+			const VectorField3& flow,
+			double dt,
+			const std::vector<CollocatedVectorGrid3*>& outputs,
+			const ScalarField3& boundarySDF = ConstantScalarField3(std::numeric_limits<double>::max()));
 	};
 
 	//! Shared pointer type for the 3-D advection solver.
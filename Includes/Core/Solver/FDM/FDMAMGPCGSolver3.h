@@ -0,0 +1,128 @@
+/*************************************************************************
+> File Name: FDMAMGPCGSolver3.h
+> Project Name: CubbyFlow
+> Author: Chan-Ho Chris Ohk
+> Purpose: 3-D finite difference-type linear system solver using algebraic
+>          multigrid preconditioned conjugate gradient (AMGPCG).
+> Created Time: 2026/10/19
+> Copyright (c) 2018, Chan-Ho Chris Ohk
+*************************************************************************/
+#ifndef CUBBYFLOW_FDM_AMGPCG_SOLVER3_H
+#define CUBBYFLOW_FDM_AMGPCG_SOLVER3_H
+
+#include <Core/Solver/FDM/FDMLinearSystemSolver3.h>
+
+#include <vector>
+
+namespace CubbyFlow
+{
+	//!
+	//! \brief 3-D finite difference-type linear system solver using algebraic
+	//!        multigrid preconditioned conjugate gradient (AMGPCG).
+	//!
+	//! The preconditioner is a smoothed aggregation multigrid V-cycle which is
+	//! built directly from the compressed matrix. Unlike FDMMGSolver3, the
+	//! hierarchy only contains the active rows of the system, so irregular fluid
+	//! regions do not pay for the empty cells of the bounding grid. Uncompressed
+	//! systems are solved by compressing the coupled rows internally.
+	//!
+	//! \see Vanek, Petr, Jan Mandel, and Marian Brezina. "Algebraic multigrid by
+	//!      smoothed aggregation for second and fourth order elliptic problems."
+	//!      Computing 56.3 (1996): 179-196.
+	//!
+	class FDMAMGPCGSolver3 final : public FDMLinearSystemSolver3
+	{
+	public:
+		//!
+		//! Constructs the solver with given parameters.
+		//!
+		//! \param maxNumberOfIterations - Number of max CG iterations.
+		//! \param tolerance - Number of max residual tolerance.
+		//! \param maxNumberOfLevels - Number of maximum AMG levels.
+		//! \param numberOfSmoothingIter - Number of pre- and post-smoothing iterations.
+		//! \param maxCoarsestSize - Number of max rows at the coarsest level.
+		//!
+		FDMAMGPCGSolver3(
+			unsigned int maxNumberOfIterations,
+			double tolerance,
+			size_t maxNumberOfLevels = 10,
+			unsigned int numberOfSmoothingIter = 2,
+			size_t maxCoarsestSize = 256);
+
+		//! Solves the given linear system.
+		bool Solve(FDMLinearSystem3* system) override;
+
+		//! Solves the given compressed linear system.
+		bool SolveCompressed(FDMCompressedLinearSystem3* system) override;
+
+		//! Returns the max number of CG iterations.
+		unsigned int GetMaxNumberOfIterations() const;
+
+		//! Returns the last number of CG iterations the solver made.
+		unsigned int GetLastNumberOfIterations() const;
+
+		//! Returns the max residual tolerance for the CG method.
+		double GetTolerance() const;
+
+		//! Returns the last residual after the CG iterations.
+		double GetLastResidual() const;
+
+		//! Returns the number of AMG levels built for the last solve.
+		size_t GetLastNumberOfLevels() const;
+
+	private:
+		struct Level final
+		{
+			MatrixCSRD A;
+			MatrixCSRD P;
+			MatrixCSRD R;
+			VectorND invDiag;
+			double smoothingFactor = 1.0;
+			VectorND x;
+			VectorND b;
+			VectorND r;
+		};
+
+		struct Preconditioner final
+		{
+			size_t maxNumberOfLevels;
+			unsigned int numberOfSmoothingIter;
+			size_t maxCoarsestSize;
+
+			std::vector<Level> levels;
+			std::vector<double> coarsestFactor;
+			size_t coarsestSize = 0;
+
+			void Build(const MatrixCSRD& matrix);
+
+			void Solve(const VectorND& b, VectorND* x);
+
+			void Cycle(size_t level, const VectorND& b, VectorND* x);
+
+			void Smooth(const Level& level, unsigned int numberOfIter, const VectorND& b, VectorND* x, VectorND* r) const;
+
+			void BuildCoarsestSolver(const MatrixCSRD& matrix);
+
+			void SolveCoarsest(const VectorND& b, VectorND* x) const;
+		};
+
+		unsigned int m_maxNumberOfIterations;
+		unsigned int m_lastNumberOfIterations;
+		double m_tolerance;
+		double m_lastResidualNorm;
+
+		VectorND m_r;
+		VectorND m_d;
+		VectorND m_q;
+		VectorND m_s;
+		Preconditioner m_precond;
+
+		// Compressed copy of the uncompressed system
+		FDMCompressedLinearSystem3 m_compSystem;
+	};
+
+	//! Shared pointer type for the FDMAMGPCGSolver3.
+	using FDMAMGPCGSolver3Ptr = std::shared_ptr<FDMAMGPCGSolver3>;
+}
+
+#endif
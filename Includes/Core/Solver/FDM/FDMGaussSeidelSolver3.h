@@ -55,6 +55,15 @@ namespace CubbyFlow
 		//! Performs single natural Gauss-Seidel relaxation step for compressed sys.
 		static void Relax(const MatrixCSRD& A, const VectorND& b, double sorFactor, VectorND* x);
 
+		//!
+		//! \brief Performs single multicolor Gauss-Seidel relaxation step for compressed sys.
+		//!
+		//! The colors are relaxed one after another, and the rows of each color
+		//! are relaxed in parallel.
+		//!
+		static void RelaxMultiColor(const MatrixCSRD& A, const VectorND& b,
+			const std::vector<std::vector<size_t>>& colors, double sorFactor, VectorND* x);
+
 		//! Performs single Red-Black Gauss-Seidel relaxation step.
 		static void RelaxRedBlack(const FDMMatrix3& A, const FDMVector3& b, double sorFactor, FDMVector3* x);
 
@@ -30,6 +30,18 @@ namespace CubbyFlow
 		//! Solves the given compressed linear system.
 		bool SolveCompressed(FDMCompressedLinearSystem3* system) override;
 
+		//!
+		//! \brief Solves the linear systems which share the matrix of \p system.
+		//!
+		//! The preconditioner is built once for all systems, and the systems
+		//! are solved concurrently. The last number of iterations and residual
+		//! are the largest ones among the systems.
+		//!
+		bool SolveMultiple(
+			FDMLinearSystem3* system,
+			const std::vector<const FDMVector3*>& rhs,
+			const std::vector<FDMVector3*>& solutions) override;
+
 		//! Returns the max number of Jacobi iterations.
 		unsigned int GetMaxNumberOfIterations() const;
 
@@ -52,6 +64,26 @@ namespace CubbyFlow
 			void Build(const FDMMatrix3& matrix);
 
 			void Solve(const FDMVector3& b, FDMVector3* x);
+
+			void Solve(const FDMVector3& b, FDMVector3* x, FDMVector3* temp) const;
+		};
+
+		// Preconditioner built by another solve with its own temporary vector
+		struct SharedPreconditioner final
+		{
+			const Preconditioner* precond = nullptr;
+			FDMVector3 y;
+
+			void Solve(const FDMVector3& b, FDMVector3* x);
+		};
+
+		struct MultipleSolveVectors final
+		{
+			FDMVector3 r;
+			FDMVector3 d;
+			FDMVector3 q;
+			FDMVector3 s;
+			SharedPreconditioner precond;
 		};
 
 		struct PreconditionerCompressed final
@@ -77,6 +109,9 @@ namespace CubbyFlow
 		FDMVector3 m_s;
 		Preconditioner m_precond;
 
+		// Vectors for each system of SolveMultiple
+		std::vector<MultipleSolveVectors> m_multipleSolveVectors;
+
 		// Compressed vectors and preconditioner
 		VectorND m_rComp;
 		VectorND m_dComp;
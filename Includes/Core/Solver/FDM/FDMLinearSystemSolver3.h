@@ -11,6 +11,8 @@
 
 #include <Core/FDM/FDMLinearSystem3.h>
 
+#include <vector>
+
 namespace CubbyFlow
 {
 	//! Abstract base class for 3-D finite difference-type linear system solver.
@@ -27,6 +29,58 @@ namespace CubbyFlow
 		{
 			return false;
 		}
+
+		//!
+		//! \brief Solves the linear systems which share the matrix of \p system.
+		//!
+		//! The n-th system has the right-hand side \p rhs[n] and its solution
+		//! is stored in \p solutions[n], which must have the same size as the
+		//! matrix. The vectors of \p system itself are used as temporary storage.
+		//! By default, the systems are solved one after another with Solve().
+		//! Override this function to reuse the work that only depends on the
+		//! matrix, such as a preconditioner.
+		//!
+		virtual bool SolveMultiple(
+			FDMLinearSystem3* system,
+			const std::vector<const FDMVector3*>& rhs,
+			const std::vector<FDMVector3*>& solutions)
+		{
+			bool result = true;
+
+			for (size_t n = 0; n < rhs.size(); ++n)
+			{
+				system->b.Set(*rhs[n]);
+				system->x.Swap(*solutions[n]);
+				result = Solve(system) && result;
+				system->x.Swap(*solutions[n]);
+			}
+
+			return result;
+		}
+
+		//! Returns true if the solver starts from the solution vector of the system.
+		bool GetUseInitialGuess() const
+		{
+			return m_useInitialGuess;
+		}
+
+		//!
+		//! \brief Sets true if the solver should start from the solution vector of
+		//!        the system.
+		//!
+		//! By default, the Krylov solvers reset the solution vector to zero before
+		//! iterating. When this flag is set, the current content of the solution
+		//! vector is used as the initial guess instead, which saves iterations if
+		//! it is already close to the solution (e.g. the pressure from the previous
+		//! time-step). The solution vector must have the same size as the system.
+		//!
+		void SetUseInitialGuess(bool useInitialGuess)
+		{
+			m_useInitialGuess = useInitialGuess;
+		}
+
+	private:
+		bool m_useInitialGuess = false;
 	};
 
 	//! Shared pointer type for the FDMLinearSystemSolver3.
@@ -91,6 +91,26 @@ namespace CubbyFlow
 			const ScalarField3& boundarySDF = ConstantScalarField3(std::numeric_limits<double>::max()),
 			const ScalarField3& fluidSDF = ConstantScalarField3(-std::numeric_limits<double>::max())) override;
 
+		//!
+		//! Solves diffusion equation for several scalar fields with the same
+		//! diffusion coefficient. If the fields share the same data layout, the
+		//! linear system is built once and solved for all the fields together.
+		//!
+		//! \param sources Input scalar fields.
+		//! \param diffusionCoefficient Amount of diffusion.
+		//! \param timeIntervalInSeconds Small time-interval that diffusion occur.
+		//! \param dests Output scalar fields.
+		//! \param boundarySDF Shape of the solid boundary that is empty by default.
+		//! \param fluidSDF Shape of the fluid boundary that is full by default.
+		//!
+		void Solve(
+			const std::vector<const ScalarGrid3*>& sources,
+			double diffusionCoefficient,
+			double timeIntervalInSeconds,
+			const std::vector<ScalarGrid3*>& dests,
+			const ScalarField3& boundarySDF = ConstantScalarField3(std::numeric_limits<double>::max()),
+			const ScalarField3& fluidSDF = ConstantScalarField3(-std::numeric_limits<double>::max())) override;
+
 		//! Sets the linear system solver for this diffusion solver.
 		void SetLinearSystemSolver(const FDMLinearSystemSolver3Ptr& solver);
 
@@ -100,6 +120,10 @@ namespace CubbyFlow
 		FDMLinearSystemSolver3Ptr m_systemSolver;
 		Array3<char> m_markers;
 
+		// Right-hand sides and solutions of the systems sharing the matrix
+		std::vector<FDMVector3> m_multipleRHS;
+		std::vector<FDMVector3> m_multipleSolutions;
+
 		void BuildMarkers(
 			const Size3& size,
 			const std::function<Vector3D(size_t, size_t, size_t)>& pos,
@@ -112,12 +136,18 @@ namespace CubbyFlow
 
 		void BuildVectors(
 			const ConstArrayAccessor3<double>& f,
-			const Vector3D& c);
+			const Vector3D& c,
+			FDMVector3* x,
+			FDMVector3* b);
 
 		void BuildVectors(
 			const ConstArrayAccessor3<Vector3D>& f,
 			const Vector3D& c,
-			size_t component);
+			size_t component,
+			FDMVector3* x,
+			FDMVector3* b);
+
+		void SolveMultipleSystems(size_t numberOfSystems);
 	};
 
 	//! Shared pointer type for the GridBackwardEulerDiffusionSolver3.
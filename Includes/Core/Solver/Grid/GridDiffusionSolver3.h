@@ -14,6 +14,8 @@
 #include <Core/Grid/FaceCenteredGrid3.h>
 #include <Core/Grid/ScalarGrid3.h>
 
+#include <vector>
+
 namespace CubbyFlow
 {
 	//!
@@ -87,6 +89,26 @@ namespace CubbyFlow
 			FaceCenteredGrid3* dest,
 			const ScalarField3& boundarySDF = ConstantScalarField3(std::numeric_limits<double>::max()),
 			const ScalarField3& fluidSDF = ConstantScalarField3(-std::numeric_limits<double>::max())) = 0;
+
+		//!
+		//! Solves diffusion equation for several scalar fields with the same
+		//! diffusion coefficient. The solution of sources[n] is stored in
+		//! dests[n]. By default, each field is solved separately.
+		//!
+		//! \param sources Input scalar fields.
+		//! \param diffusionCoefficient Amount of diffusion.
+		//! \param timeIntervalInSeconds Small time-interval that diffusion occur.
+		//! \param dests Output scalar fields.
+		//! \param boundarySDF Shape of the solid boundary that is empty by default.
+		//! \param fluidSDF Shape of the fluid boundary that is full by default.
+		//!
+		virtual void Solve(
+			const std::vector<const ScalarGrid3*>& sources,
+			double diffusionCoefficient,
+			double timeIntervalInSeconds,
+			const std::vector<ScalarGrid3*>& dests,
+			const ScalarField3& boundarySDF = ConstantScalarField3(std::numeric_limits<double>::max()),
+			const ScalarField3& fluidSDF = ConstantScalarField3(-std::numeric_limits<double>::max()));
 	};
 
 	//! Shared pointer type for the GridDiffusionSolver3.
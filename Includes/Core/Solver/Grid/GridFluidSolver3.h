@@ -231,6 +231,19 @@ namespace CubbyFlow
 		//! Computes the advection term using the advection solver.
 		virtual void ComputeAdvection(double timeIntervalInSeconds);
 
+		//!
+		//! \brief Computes the advection of the advectable scalar data at given
+		//!        indices.
+		//!
+		//! This function is called by GridFluidSolver3::ComputeAdvection with
+		//! the indices of all advectable scalar data. By default, the grids are
+		//! advected together with the advection solver, so that the grids with
+		//! the same data layout share the departure points, and then
+		//! extrapolated into the collider. Override this function to customize
+		//! the advection of a particular field.
+		//!
+		virtual void ComputeScalarDataAdvection(const std::vector<size_t>& indices, double timeIntervalInSeconds);
+
 		//!
 		//! \brief Returns the signed-distance representation of the fluid.
 		//!
@@ -13,6 +13,8 @@
 #include <Core/Grid/CellCenteredScalarGrid3.h>
 #include <Core/Solver/Grid/GridBoundaryConditionSolver3.h>
 
+#include <vector>
+
 namespace CubbyFlow
 {
 	//!
@@ -23,6 +25,11 @@ namespace CubbyFlow
 	//! should pair up with GridFractionalSinglePhasePressureSolver3 to provide
 	//! sub-grid resolution velocity projection.
 	//!
+	//! Colliders which use the SDF cache (see Collider3::SetIsUsingSDFCache)
+	//! are rasterized by transforming and sampling their cached local field
+	//! inside their bounding boxes only. When such colliders move, only the
+	//! cells covered by their previous and current bounding boxes are updated.
+	//!
 	class GridFractionalBoundaryConditionSolver3 : public GridBoundaryConditionSolver3
 	{
 	public:
@@ -57,8 +64,22 @@ namespace CubbyFlow
 			const Vector3D& gridOrigin) override;
 
 	private:
+		struct CachedColliderState final
+		{
+			Collider3Ptr collider;
+			CellCenteredScalarGrid3Ptr localSDF;
+			Transform3 transform;
+			Size3 lowerIndex;
+			Size3 upperIndex;
+		};
+
 		CellCenteredScalarGrid3Ptr m_colliderSDF;
 		CustomVectorField3Ptr m_colliderVel;
+		std::vector<CachedColliderState> m_cachedColliderStates;
+
+		bool UpdateColliderSDFFromCache(bool isResized);
+
+		void UpdateColliderSDFRegion(const Size3& lowerIndex, const Size3& upperIndex);
 	};
 
 	//! Shared pointer type for the GridFractionalBoundaryConditionSolver3.
@@ -10,10 +10,13 @@
 #define CUBBYFLOW_SINGLE_PHASE_PRESSURE_SOLVER3_H
 
 #include <Core/FDM/FDMMGLinearSystem3.h>
+#include <Core/Point/Point3.h>
 #include <Core/Solver/FDM/FDMLinearSystemSolver3.h>
 #include <Core/Solver/FDM/FDMMGSolver3.h>
 #include <Core/Solver/Grid/GridPressureSolver3.h>
 
+#include <vector>
+
 namespace CubbyFlow
 {
 	//!
@@ -91,6 +94,24 @@ namespace CubbyFlow
 		//! Returns the pressure field.
 		const FDMVector3& GetPressure() const;
 
+		//! Returns true if the solve starts from the previous pressure.
+		bool GetUseWarmStart() const;
+
+		//!
+		//! \brief Sets true if the solve should start from the previous pressure.
+		//!
+		//! When enabled, the pressure of the last solve is kept and used as the
+		//! initial guess of the linear system solver at the next solve, which
+		//! saves iterations when the flow changes little between the time-steps.
+		//! The pressure is scaled by the ratio of the time intervals, and the
+		//! cells which are not fluid anymore, or newly became fluid, start from
+		//! zero. The compressed system is seeded in its row order. While enabled,
+		//! the linear system solver starts from this guess, and its own
+		//! FDMLinearSystemSolver3::SetUseInitialGuess flag is restored after
+		//! each solve.
+		//!
+		void SetUseWarmStart(bool useWarmStart);
+
 	private:
 		FDMLinearSystem3 m_system;
 		FDMCompressedLinearSystem3 m_compSystem;
@@ -100,6 +121,7 @@ namespace CubbyFlow
 		FDMMGSolver3Ptr m_mgSystemSolver;
 
 		std::vector<Array3<char>> m_markers;
+		std::vector<Point3UI> m_rowToCoord;
 
 		void BuildMarkers(
 			const Size3& size,
@@ -107,8 +129,14 @@ namespace CubbyFlow
 			const ScalarField3& boundarySDF,
 			const ScalarField3& fluidSDF);
 
+		bool m_useWarmStart = false;
+		FDMVector3 m_lastPressure;
+		double m_lastTimeIntervalInSeconds = 0.0;
+
 		void DecompressSolution();
 
+		void BuildInitialGuess(double timeIntervalInSeconds, bool useCompressed);
+
 		virtual void BuildSystem(const FaceCenteredGrid3& input, bool useCompressed);
 
 		virtual void ApplyPressureGradient(const FaceCenteredGrid3& input, FaceCenteredGrid3* output);
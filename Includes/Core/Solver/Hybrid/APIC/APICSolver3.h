@@ -50,9 +50,11 @@ namespace CubbyFlow
 		void TransferFromGridsToParticles() override;
 
 	private:
-		Array1<Vector3D> m_cX;
-		Array1<Vector3D> m_cY;
-		Array1<Vector3D> m_cZ;
+		// Affine velocity terms are stored as particle data layers so that they
+		// follow the particles when the particles are added or removed.
+		size_t m_cXIdx;
+		size_t m_cYIdx;
+		size_t m_cZIdx;
 	};
 
 	//! Shared pointer type for the APICSolver3.
@@ -12,6 +12,7 @@
 #include <Core/Emitter/ParticleEmitter3.h>
 #include <Core/Particle/ParticleSystemData3.h>
 #include <Core/Solver/Grid/GridFluidSolver3.h>
+#include <Core/Surface/ImplicitSurface3.h>
 
 namespace CubbyFlow
 {
@@ -54,6 +55,28 @@ namespace CubbyFlow
 		//! Sets the particle emitter.
 		void SetParticleEmitter(const ParticleEmitter3Ptr& newEmitter);
 
+		//! Returns the kill volume.
+		const ImplicitSurface3Ptr& GetKillVolume() const;
+
+		//!
+		//! \brief Sets the kill volume.
+		//!
+		//! Particles inside the kill volume are removed after they are moved.
+		//! Set nullptr to disable culling.
+		//!
+		void SetKillVolume(const ImplicitSurface3Ptr& newKillVolume);
+
+		//! Returns true if particles leaving the grid domain are removed.
+		bool GetIsRemovingParticlesOutOfDomain() const;
+
+		//!
+		//! \brief Sets whether particles leaving the grid domain are removed.
+		//!
+		//! Only the particles which leave through the open sides of the domain
+		//! are affected, since closed sides keep the particles inside.
+		//!
+		void SetIsRemovingParticlesOutOfDomain(bool isRemoving);
+
 		//! Returns builder fox PICSolver3.
 		static Builder GetBuilder();
 
@@ -87,12 +110,16 @@ namespace CubbyFlow
 		size_t m_signedDistanceFieldID;
 		ParticleSystemData3Ptr m_particles;
 		ParticleEmitter3Ptr m_particleEmitter;
+		ImplicitSurface3Ptr m_killVolume;
+		bool m_isRemovingParticlesOutOfDomain = false;
 
 		void ExtrapolateVelocityToAir() const;
 
 		void BuildSignedDistanceField();
 
 		void UpdateParticleEmitter(double timeIntervalInSeconds) const;
+
+		void RemoveParticles();
 	};
 
 	//! Shared pointer type for the PICSolver3.
@@ -9,6 +9,9 @@
 #ifndef CUBBYFLOW_LEVEL_SET_LIQUID_SOLVER3_H
 #define CUBBYFLOW_LEVEL_SET_LIQUID_SOLVER3_H
 
+#include <Core/Array/Array1.h>
+#include <Core/Array/Array3.h>
+#include <Core/Point/Point3.h>
 #include <Core/Solver/Grid/GridFluidSolver3.h>
 #include <Core/Solver/LevelSet/LevelSetSolver3.h>
 
@@ -68,6 +71,33 @@ namespace CubbyFlow
 		//!
 		void SetIsGlobalCompensationEnabled(bool isEnabled);
 
+		//! Returns the width of the narrow band in number of cells.
+		size_t GetNarrowBandWidth() const;
+
+		//!
+		//! \brief Sets the width of the narrow band in number of cells.
+		//!
+		//! When the width is greater than zero, the signed-distance field is only
+		//! maintained within the given number of cells from the surface. The
+		//! field is advected and reinitialized, and the velocity is extrapolated
+		//! to the air, only at the cells in the band. The values outside of the
+		//! band are clamped to +/- the band width. After each time-step the band
+		//! is rebuilt incrementally from the previous one, so the cost of the
+		//! level set operations scales with the surface area rather than the
+		//! volume. In this mode, the reinitialization uses a band-local upwind
+		//! update instead of the level set solver, and the volume measurement,
+		//! the global compensation and the extrapolation into the collider only
+		//! visit the band as well.
+		//!
+		//! The band should be wider than the max CFL number so that the surface
+		//! cannot escape the band within a single time-step. Zero (the default)
+		//! disables the narrow band and the full grid is processed.
+		//!
+		void SetNarrowBandWidth(size_t numberOfCells);
+
+		//! Returns the number of cells in the current narrow band.
+		size_t GetNumberOfNarrowBandCells() const;
+
 		//!
 		//! \brief Returns liquid volume measured by smeared Heaviside function.
 		//!
@@ -90,6 +120,9 @@ namespace CubbyFlow
 		//! Customizes advection step.
 		void ComputeAdvection(double timeIntervalInSeconds) override;
 
+		//! Customizes advection of the signed-distance field.
+		void ComputeScalarDataAdvection(const std::vector<size_t>& indices, double timeIntervalInSeconds) override;
+
 		//!
 		//! \brief Returns fluid region as a signed-distance field.
 		//!
@@ -106,10 +139,28 @@ namespace CubbyFlow
 		bool m_isGlobalCompensationEnabled = false;
 		double m_lastKnownVolume = 0.0;
 
+		size_t m_narrowBandWidth = 0;
+		Array1<Point3UI> m_narrowBand;
+		Array3<char> m_narrowBandMarker;
+		size_t m_numberOfInsideOuterCells = 0;
+		Array3<char> m_uMarker;
+		Array3<char> m_vMarker;
+		Array3<char> m_wMarker;
+
 		void Reinitialize(double currentCFL);
 
 		void ExtrapolateVelocityToAir(double currentCFL);
 
+		bool IsNarrowBandBuilt() const;
+
+		void BuildNarrowBand();
+
+		void ReinitializeNarrowBand(double currentCFL);
+
+		void ExtrapolateVelocityToAirInNarrowBand();
+
+		void ExtrapolateIntoColliderInNarrowBand();
+
 		void AddVolume(double volDiff);
 	};
 
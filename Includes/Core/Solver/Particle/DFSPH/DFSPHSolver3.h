@@ -0,0 +1,132 @@
+/*************************************************************************
+> File Name: DFSPHSolver3.h
+> Project Name: CubbyFlow
+> Author: Chan-Ho Chris Ohk
+> Purpose: 3-D DFSPH solver.
+> Created Time: 2026/10/19
+> Copyright (c) 2018, Chan-Ho Chris Ohk
+*************************************************************************/
+#ifndef CUBBYFLOW_DFSPH_SOLVER3_H
+#define CUBBYFLOW_DFSPH_SOLVER3_H
+
+#include <Core/Solver/Particle/SPH/SPHSolver3.h>
+
+namespace CubbyFlow
+{
+	//!
+	//! \brief 3-D DFSPH solver.
+	//!
+	//! This class implements 3-D divergence-free SPH solver. Each time step
+	//! first makes the velocity field divergence-free and then corrects the
+	//! predicted density error, both with a per-particle stiffness factor that
+	//! only depends on the particle positions. The time step is chosen from
+	//! the CFL condition instead of the speed of sound, so the solver takes
+	//! much larger steps than the EOS-based solvers.
+	//!
+	//! \see Bender and Koschier, Divergence-free smoothed particle
+	//!      hydrodynamics, Proceedings of the 14th ACM SIGGRAPH/Eurographics
+	//!      Symposium on Computer Animation. ACM, 2015.
+	//!
+	class DFSPHSolver3 : public SPHSolver3
+	{
+	public:
+		class Builder;
+
+		//! Constructs a solver with empty particle set.
+		DFSPHSolver3();
+
+		//! Constructs a solver with target density, spacing, and relative kernel radius.
+		DFSPHSolver3(double targetDensity, double targetSpacing, double relativeKernelRadius);
+
+		virtual ~DFSPHSolver3();
+
+		//! Returns max allowed average density error ratio.
+		double GetMaxDensityErrorRatio() const;
+
+		//!
+		//! \brief Sets max allowed average density error ratio.
+		//!
+		//! This function sets the max allowed average density error ratio during
+		//! the density solve. Default is 0.001 (0.1%). The input value should be
+		//! positive. The error is averaged over the particles, so the default is
+		//! tighter than the max error ratio of PCISPHSolver3.
+		//!
+		void SetMaxDensityErrorRatio(double ratio);
+
+		//! Returns max allowed average divergence error ratio.
+		double GetMaxDivergenceErrorRatio() const;
+
+		//!
+		//! \brief Sets max allowed average divergence error ratio.
+		//!
+		//! This function sets the max allowed average density change per time
+		//! step during the divergence solve. Default is 0.1 (10%). The input
+		//! value should be positive.
+		//!
+		void SetMaxDivergenceErrorRatio(double ratio);
+
+		//! Returns max number of iterations.
+		unsigned int GetMaxNumberOfIterations() const;
+
+		//!
+		//! \brief Sets max number of iterations.
+		//!
+		//! This function sets the max number of iterations of the divergence
+		//! and the density solve. Default is 100.
+		//!
+		void SetMaxNumberOfIterations(unsigned int n);
+
+		//! Returns builder fox DFSPHSolver3.
+		static Builder GetBuilder();
+
+	protected:
+		//! Returns the number of sub-time-steps from the CFL condition.
+		unsigned int GetNumberOfSubTimeSteps(double timeIntervalInSeconds) const override;
+
+		//! Accumulates the pressure force to the forces array in the particle system.
+		void AccumulatePressureForce(double timeIntervalInSeconds) override;
+
+		//! Performs pre-processing step before the simulation.
+		void OnBeginAdvanceTimeStep(double timeStepInSeconds) override;
+
+	private:
+		double m_maxDensityErrorRatio = 0.001;
+		double m_maxDivergenceErrorRatio = 0.1;
+		unsigned int m_maxNumberOfIterations = 100;
+
+		ParticleSystemData3::VectorData m_tempPositions;
+		ParticleSystemData3::VectorData m_tempVelocities;
+		ParticleSystemData3::ScalarData m_alphas;
+		ParticleSystemData3::ScalarData m_kappas;
+
+		void ComputeAlphas();
+
+		unsigned int CorrectDivergenceError(double timeIntervalInSeconds);
+
+		unsigned int CorrectDensityError(double timeIntervalInSeconds);
+
+		void ResolvePredictedCollision(double timeIntervalInSeconds);
+
+		double ComputeDensityChangeRate(const SPHSystemData3& particles, size_t i) const;
+
+		void ApplyKappas(double timeIntervalInSeconds);
+	};
+
+	//! Shared pointer type for the DFSPHSolver3.
+	using DFSPHSolver3Ptr = std::shared_ptr<DFSPHSolver3>;
+
+	//!
+	//! \brief Front-end to create DFSPHSolver3 objects step by step.
+	//!
+	class DFSPHSolver3::Builder final : public SPHSolverBuilderBase3<DFSPHSolver3::Builder>
+	{
+	public:
+		//! Builds DFSPHSolver3.
+		DFSPHSolver3 Build() const;
+
+		//! Builds shared pointer of DFSPHSolver3 instance.
+		DFSPHSolver3Ptr MakeShared() const;
+	};
+}
+
+#endif
@@ -14,6 +14,7 @@
 #include <Core/Emitter/ParticleEmitter3.h>
 #include <Core/Field/VectorField3.h>
 #include <Core/Particle/ParticleSystemData3.h>
+#include <Core/Surface/ImplicitSurface3.h>
 #include <Core/Utils/Constants.h>
 #include <Core/Vector/Vector3.h>
 
@@ -113,6 +114,20 @@ namespace CubbyFlow
 		//!
 		void SetWind(const VectorField3Ptr& newWind);
 
+		//! Returns the kill volume.
+		const ImplicitSurface3Ptr& GetKillVolume() const;
+
+		//!
+		//! \brief      Sets the kill volume.
+		//!
+		//! Particles inside the kill volume are removed at the end of each
+		//! time-step. Use a box with flipped normal to remove the particles
+		//! which left the region of interest. Set nullptr to disable culling.
+		//!
+		//! \param[in]  newKillVolume The new kill volume.
+		//!
+		void SetKillVolume(const ImplicitSurface3Ptr& newKillVolume);
+
 		//! Returns builder fox ParticleSystemSolver3.
 		static Builder GetBuilder();
 
@@ -153,6 +168,7 @@ namespace CubbyFlow
 		Collider3Ptr m_collider;
 		ParticleEmitter3Ptr m_emitter;
 		VectorField3Ptr m_wind;
+		ImplicitSurface3Ptr m_killVolume;
 
 		void BeginAdvanceTimeStep(double timeStepInSeconds);
 
@@ -165,6 +181,8 @@ namespace CubbyFlow
 		void UpdateCollider(double timeStepInSeconds) const;
 
 		void UpdateEmitter(double timeStepInSeconds) const;
+
+		void RemoveParticlesInKillVolume();
 	};
 
 	//! Shared pointer type for the ParticleSystemSolver3.
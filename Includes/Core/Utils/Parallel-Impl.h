@@ -32,7 +32,11 @@
 
 #include <algorithm>
 #include <cmath>
+#include <functional>
 #include <future>
+#include <iterator>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #undef max
@@ -56,15 +60,25 @@ namespace CubbyFlow
         template <typename TASK>
         inline auto Async(TASK&& fn) -> future<operator_return_t<TASK>>
         {
+#if defined(CUBBYFLOW_TASKING_HPX) || defined(CUBBYFLOW_TASKING_TBB) || defined(CUBBYFLOW_TASKING_CPP11THREAD)
+            // The task inherits the executor of the calling thread
+            ParallelExecutor* executor = ParallelExecutor::GetCurrent();
+            auto scopedFn = [executor, fn]()
+            {
+                ParallelExecutor::Scope scope(executor);
+                return fn();
+            };
+#endif
+
 #if defined(CUBBYFLOW_TASKING_HPX)
-            return hpx::async(std::forward<TASK>(fn));
+            return hpx::async(std::move(scopedFn));
 
 #elif defined(CUBBYFLOW_TASKING_TBB)
             struct LocalTBBTask : public tbb::task
             {
-                TASK func;
+                std::function<void()> func;
 
-                LocalTBBTask(TASK&& f) : func(std::forward<TASK>(f))
+                LocalTBBTask(std::function<void()>&& f) : func(std::move(f))
                 {
                     // Do nothing
                 }
@@ -78,7 +92,8 @@ namespace CubbyFlow
 
             using package_t = std::packaged_task<operator_return_t<TASK>()>;
 
-            auto task = new package_t(std::forward<TASK>(fn));
+            auto task = new package_t(std::move(scopedFn));
+            auto result = task->get_future();
             auto* tbbNode = new (tbb::task::allocate_root()) LocalTBBTask([=]()
             {
                 (*task)();
@@ -86,11 +101,16 @@ namespace CubbyFlow
             });
 
             tbb::task::enqueue(*tbbNode);
+            return result;
 
 #elif defined(CUBBYFLOW_TASKING_CPP11THREAD)
-            return std::async(std::launch::async, fn);
+            return std::async(std::launch::async, std::move(scopedFn));
 #else
-            fn();
+            // Runs the task right away and returns a ready future
+            std::packaged_task<operator_return_t<TASK>()> task(std::forward<TASK>(fn));
+            auto result = task.get_future();
+            task();
+            return result;
 #endif
         }
 
@@ -183,6 +203,225 @@ namespace CubbyFlow
                 Merge(a, size, temp, compareFunction);
             }
         }
+
+        // One pass of the radix sort, which is a stable counting sort of the
+        // byte at the given shift
+        template <bool HasValues, typename KeyInIterator, typename ValueInIterator,
+            typename KeyOutIterator, typename ValueOutIterator>
+        void RadixSortPass(KeyInIterator keysIn, ValueInIterator valuesIn,
+            KeyOutIterator keysOut, ValueOutIterator valuesOut,
+            size_t n, unsigned int shift, size_t numberOfSlices,
+            std::vector<size_t>& counts, ExecutionPolicy policy)
+        {
+            const size_t numberOfDigits = 256;
+            const size_t sliceSize = (n + numberOfSlices - 1) / numberOfSlices;
+
+            std::fill(counts.begin(), counts.end(), 0);
+
+            // Histogram of each slice, stored as [slice][digit]
+            ParallelFor(ZERO_SIZE, numberOfSlices, [&](size_t s)
+            {
+                size_t* sliceCounts = counts.data() + s * numberOfDigits;
+                const size_t end = std::min(n, (s + 1) * sliceSize);
+
+                for (size_t i = s * sliceSize; i < end; ++i)
+                {
+                    ++sliceCounts[(keysIn[i] >> shift) & 0xff];
+                }
+            }, policy);
+
+            // Exclusive scan over the digits, then over the slices of each digit
+            size_t offset = 0;
+            for (size_t d = 0; d < numberOfDigits; ++d)
+            {
+                for (size_t s = 0; s < numberOfSlices; ++s)
+                {
+                    const size_t count = counts[s * numberOfDigits + d];
+                    counts[s * numberOfDigits + d] = offset;
+                    offset += count;
+                }
+            }
+
+            // Scatter each slice in order, which keeps the sort stable
+            ParallelFor(ZERO_SIZE, numberOfSlices, [&](size_t s)
+            {
+                size_t* sliceOffsets = counts.data() + s * numberOfDigits;
+                const size_t end = std::min(n, (s + 1) * sliceSize);
+
+                for (size_t i = s * sliceSize; i < end; ++i)
+                {
+                    const size_t j = sliceOffsets[(keysIn[i] >> shift) & 0xff]++;
+                    keysOut[j] = keysIn[i];
+
+                    if constexpr (HasValues)
+                    {
+                        valuesOut[j] = valuesIn[i];
+                    }
+                }
+            }, policy);
+        }
+
+        template <bool HasValues, typename KeyIterator, typename ValueIterator>
+        void RadixSortByKey(KeyIterator keysBegin, KeyIterator keysEnd, ValueIterator valuesBegin, ExecutionPolicy policy)
+        {
+            using KeyType = typename std::iterator_traits<KeyIterator>::value_type;
+            using ValueType = typename std::iterator_traits<ValueIterator>::value_type;
+
+            static_assert(std::is_integral<KeyType>::value && std::is_unsigned<KeyType>::value,
+                "Radix sort requires unsigned integer keys.");
+
+            const size_t n = (keysEnd > keysBegin) ? static_cast<size_t>(keysEnd - keysBegin) : 0;
+
+            if (n < 2)
+            {
+                return;
+            }
+
+            // Skip the bytes above the largest key
+            const KeyType maxKey = ParallelReduce(ZERO_SIZE, n, KeyType(0),
+                [&](size_t start, size_t end, KeyType init)
+            {
+                KeyType result = init;
+
+                for (size_t i = start; i < end; ++i)
+                {
+                    result = std::max(result, static_cast<KeyType>(keysBegin[i]));
+                }
+
+                return result;
+            }, [](KeyType a, KeyType b)
+            {
+                return std::max(a, b);
+            }, policy);
+
+            unsigned int numberOfPasses = 0;
+            for (KeyType key = maxKey; key != 0; key = static_cast<KeyType>(key >> 8))
+            {
+                ++numberOfPasses;
+            }
+
+            // Each slice has its own histogram of 256 digits
+            size_t numberOfSlices = 1;
+            if (policy == ExecutionPolicy::Parallel)
+            {
+                const unsigned int numThreadsHint = GetMaxNumberOfThreads();
+                const size_t numThreads = (numThreadsHint == 0u) ? 8u : numThreadsHint;
+
+                numberOfSlices = std::max(std::min(numThreads, n / 256), static_cast<size_t>(1));
+            }
+
+            std::vector<size_t> counts(numberOfSlices * 256);
+            std::vector<KeyType> tempKeys(n);
+            std::vector<ValueType> tempValues(HasValues ? n : 0);
+
+            // Ping-pong between the input and the temporary buffers
+            for (unsigned int pass = 0; pass < numberOfPasses; ++pass)
+            {
+                if (pass % 2 == 0)
+                {
+                    RadixSortPass<HasValues>(keysBegin, valuesBegin, tempKeys.begin(), tempValues.begin(),
+                        n, 8 * pass, numberOfSlices, counts, policy);
+                }
+                else
+                {
+                    RadixSortPass<HasValues>(tempKeys.begin(), tempValues.begin(), keysBegin, valuesBegin,
+                        n, 8 * pass, numberOfSlices, counts, policy);
+                }
+            }
+
+            if (numberOfPasses % 2 == 1)
+            {
+                ParallelFor(ZERO_SIZE, n, [&](size_t i)
+                {
+                    keysBegin[i] = tempKeys[i];
+
+                    if constexpr (HasValues)
+                    {
+                        valuesBegin[i] = tempValues[i];
+                    }
+                }, policy);
+            }
+        }
+
+        // Number of slices of the scan-based functions, at most one per thread
+        inline size_t GetNumberOfScanSlices(size_t n, ExecutionPolicy policy)
+        {
+            if (policy != ExecutionPolicy::Parallel)
+            {
+                return 1;
+            }
+
+            const unsigned int numThreadsHint = GetMaxNumberOfThreads();
+            const size_t numThreads = (numThreadsHint == 0u) ? 8u : numThreadsHint;
+
+            // Short ranges are not worth splitting
+            return std::max(std::min(numThreads, n / 1024), static_cast<size_t>(1));
+        }
+
+        // Calls the function for each 3D tile of the index space in parallel
+        template <typename IndexType, typename Function>
+        void ParallelForTiles(
+            IndexType beginIndexX, IndexType endIndexX,
+            IndexType beginIndexY, IndexType endIndexY,
+            IndexType beginIndexZ, IndexType endIndexZ,
+            const Function& function, ExecutionPolicy policy)
+        {
+            if (beginIndexX >= endIndexX || beginIndexY >= endIndexY || beginIndexZ >= endIndexZ)
+            {
+                return;
+            }
+
+            size_t tileSizeX, tileSizeY, tileSizeZ;
+            GetParallelForTileSize(&tileSizeX, &tileSizeY, &tileSizeZ);
+
+            const size_t sizeX = static_cast<size_t>(endIndexX - beginIndexX);
+            const size_t sizeY = static_cast<size_t>(endIndexY - beginIndexY);
+            const size_t sizeZ = static_cast<size_t>(endIndexZ - beginIndexZ);
+            const size_t numTilesX = (sizeX - 1) / tileSizeX + 1;
+            const size_t numTilesY = (sizeY - 1) / tileSizeY + 1;
+            const size_t numTilesZ = (sizeZ - 1) / tileSizeZ + 1;
+
+            // Tiles are numbered with X first, so the consecutive tiles that a
+            // thread picks up are also close in memory
+            ParallelFor(ZERO_SIZE, numTilesX * numTilesY * numTilesZ, [&](size_t tile)
+            {
+                const size_t tileX = tile % numTilesX;
+                const size_t tileY = (tile / numTilesX) % numTilesY;
+                const size_t tileZ = tile / (numTilesX * numTilesY);
+
+                const size_t iOffset = tileX * tileSizeX;
+                const size_t jOffset = tileY * tileSizeY;
+                const size_t kOffset = tileZ * tileSizeZ;
+
+                function(
+                    beginIndexX + static_cast<IndexType>(iOffset),
+                    beginIndexX + static_cast<IndexType>(std::min(iOffset + tileSizeX, sizeX)),
+                    beginIndexY + static_cast<IndexType>(jOffset),
+                    beginIndexY + static_cast<IndexType>(std::min(jOffset + tileSizeY, sizeY)),
+                    beginIndexZ + static_cast<IndexType>(kOffset),
+                    beginIndexZ + static_cast<IndexType>(std::min(kOffset + tileSizeZ, sizeZ)));
+            }, policy);
+        }
+
+        template <typename RandomIterator>
+        void DefaultSort(RandomIterator begin, RandomIterator end, ExecutionPolicy policy, std::true_type)
+        {
+            // Unsigned integers are sorted by the radix sort in parallel
+            if (policy == ExecutionPolicy::Parallel)
+            {
+                RadixSortByKey<false>(begin, end, begin, policy);
+            }
+            else
+            {
+                std::sort(begin, end);
+            }
+        }
+
+        template <typename RandomIterator>
+        void DefaultSort(RandomIterator begin, RandomIterator end, ExecutionPolicy policy, std::false_type)
+        {
+            ParallelSort(begin, end, std::less<typename std::iterator_traits<RandomIterator>::value_type>(), policy);
+        }
     }  // namespace Internal
 
     template <typename RandomIterator, typename T>
@@ -218,10 +457,30 @@ namespace CubbyFlow
         {
 #if defined(CUBBYFLOW_TASKING_TBB)
             (void)policy;
-            tbb::parallel_for(beginIndex, endIndex, function);
+
+            // The worker threads inherit the executor of the calling thread
+            ParallelExecutor* executor = ParallelExecutor::GetCurrent();
+            tbb::parallel_for(tbb::blocked_range<IndexType>(beginIndex, endIndex),
+                [&function, executor](const tbb::blocked_range<IndexType>& range)
+            {
+                ParallelExecutor::Scope scope(executor);
+
+                for (IndexType i = range.begin(); i < range.end(); ++i)
+                {
+                    function(i);
+                }
+            });
 #elif defined(CUBBYFLOW_TASKING_HPX)
             (void)policy;
-            hpx::parallel::for_loop(hpx::parallel::execution::par, beginIndex, endIndex, function);
+
+            // The worker threads inherit the executor of the calling thread
+            ParallelExecutor* executor = ParallelExecutor::GetCurrent();
+            hpx::parallel::for_loop(hpx::parallel::execution::par, beginIndex, endIndex,
+                [&function, executor](IndexType i)
+            {
+                ParallelExecutor::Scope scope(executor);
+                function(i);
+            });
 #elif defined(CUBBYFLOW_TASKING_CPP11THREAD)         
             // Estimate number of threads in the pool
             const unsigned int numThreadsHint = GetMaxNumberOfThreads();
@@ -233,8 +492,11 @@ namespace CubbyFlow
             slice = std::max(slice, IndexType(1));
 
             // [Helper] Inner loop
-            auto launchRange = [&function](IndexType k1, IndexType k2)
+            ParallelExecutor* executor = ParallelExecutor::GetCurrent();
+            auto launchRange = [&function, executor](IndexType k1, IndexType k2)
             {
+                ParallelExecutor::Scope scope(executor);
+
                 for (IndexType k = k1; k < k2; ++k)
                 {
                     function(k);
@@ -271,15 +533,23 @@ namespace CubbyFlow
             (void)policy;
 
 #if defined(CUBBYFLOW_TASKING_OPENMP)
-#pragma omp parallel for
-#if defined(_MSC_VER) && !defined(__INTEL_COMPILER)
-            for (ssize_t i = beginIndex; i < static_cast<ssize_t>(endIndex); ++i)
+            // The team threads inherit the executor of the calling thread
+            ParallelExecutor* executor = ParallelExecutor::GetCurrent();
+
+#pragma omp parallel
             {
+                ParallelExecutor::Scope scope(executor);
+
+#pragma omp for
+#if defined(_MSC_VER) && !defined(__INTEL_COMPILER)
+                for (ssize_t i = beginIndex; i < static_cast<ssize_t>(endIndex); ++i)
+                {
 #else   // !MSVC || Intel
-            for (auto i = beginIndex; i < endIndex; ++i)
-            {
+                for (auto i = beginIndex; i < endIndex; ++i)
+                {
 #endif  // MSVC && !Intel
-                function(i);
+                    function(i);
+                }
             }
 #else   // CUBBYFLOW_TASKING_SERIAL
             for (auto i = beginIndex; i < endIndex; ++i)
@@ -307,9 +577,11 @@ namespace CubbyFlow
 
         if (policy == ExecutionPolicy::Parallel) {
 #if defined(CUBBYFLOW_TASKING_TBB)
+            ParallelExecutor* executor = ParallelExecutor::GetCurrent();
             tbb::parallel_for(
                 tbb::blocked_range<IndexType>(beginIndex, endIndex),
-                [&function](const tbb::blocked_range<IndexType>& range) {
+                [&function, executor](const tbb::blocked_range<IndexType>& range) {
+                ParallelExecutor::Scope scope(executor);
                 function(range.begin(), range.end());
             });
 #else
@@ -388,13 +660,33 @@ namespace CubbyFlow
         IndexType beginIndexZ, IndexType endIndexZ,
         const Function& function, ExecutionPolicy policy)
     {
-        ParallelFor(beginIndexZ, endIndexZ, [&](IndexType k)
+        if (policy != ExecutionPolicy::Parallel)
+        {
+            for (IndexType k = beginIndexZ; k < endIndexZ; ++k)
+            {
+                for (IndexType j = beginIndexY; j < endIndexY; ++j)
+                {
+                    for (IndexType i = beginIndexX; i < endIndexX; ++i)
+                    {
+                        function(i, j, k);
+                    }
+                }
+            }
+
+            return;
+        }
+
+        Internal::ParallelForTiles(beginIndexX, endIndexX, beginIndexY, endIndexY, beginIndexZ, endIndexZ,
+            [&function](IndexType iBegin, IndexType iEnd, IndexType jBegin, IndexType jEnd, IndexType kBegin, IndexType kEnd)
         {
-            for (IndexType j = beginIndexY; j < endIndexY; ++j)
+            for (IndexType k = kBegin; k < kEnd; ++k)
             {
-                for (IndexType i = beginIndexX; i < endIndexX; ++i)
+                for (IndexType j = jBegin; j < jEnd; ++j)
                 {
-                    function(i, j, k);
+                    for (IndexType i = iBegin; i < iEnd; ++i)
+                    {
+                        function(i, j, k);
+                    }
                 }
             }
         }, policy);
@@ -407,10 +699,14 @@ namespace CubbyFlow
         IndexType beginIndexZ, IndexType endIndexZ,
         const Function& function, ExecutionPolicy policy)
     {
-        ParallelRangeFor(beginIndexZ, endIndexZ, [&](IndexType kBegin, IndexType kEnd)
+        if (policy != ExecutionPolicy::Parallel)
         {
-            function(beginIndexX, endIndexX, beginIndexY, endIndexY, kBegin, kEnd);
-        }, policy);
+            function(beginIndexX, endIndexX, beginIndexY, endIndexY, beginIndexZ, endIndexZ);
+            return;
+        }
+
+        Internal::ParallelForTiles(beginIndexX, endIndexX, beginIndexY, endIndexY, beginIndexZ, endIndexZ,
+            function, policy);
     }
 
     template <typename IndexType, typename Value, typename Function, typename Reduce>
@@ -425,10 +721,12 @@ namespace CubbyFlow
         if (policy == ExecutionPolicy::Parallel)
         {
 #if defined(CUBBYFLOW_TASKING_TBB)
+            ParallelExecutor* executor = ParallelExecutor::GetCurrent();
             return tbb::parallel_reduce(
                 tbb::blocked_range<IndexType>(beginIndex, endIndex), identity,
-                [&function](const tbb::blocked_range<IndexType>& range, const Value& init)
+                [&function, executor](const tbb::blocked_range<IndexType>& range, const Value& init)
             {
+                ParallelExecutor::Scope scope(executor);
                 return function(range.begin(), range.end(), init);
             }, reduce);
 #else
@@ -501,10 +799,228 @@ namespace CubbyFlow
         return function(beginIndex, endIndex, identity);
     }
 
+    template <typename InputIterator, typename OutputIterator, typename Value, typename Operator>
+    Value ParallelInclusiveScan(InputIterator begin, InputIterator end, OutputIterator output,
+        const Value& identity, const Operator& op, ExecutionPolicy policy)
+    {
+        const size_t n = (end > begin) ? static_cast<size_t>(end - begin) : 0;
+
+        if (n == 0)
+        {
+            return identity;
+        }
+
+        const size_t numberOfSlices = Internal::GetNumberOfScanSlices(n, policy);
+        const size_t sliceSize = (n + numberOfSlices - 1) / numberOfSlices;
+
+        // offsets[s] is the reduction of the slices before s
+        std::vector<Value> offsets(numberOfSlices + 1, identity);
+
+        ParallelFor(ZERO_SIZE, numberOfSlices - 1, [&](size_t s)
+        {
+            Value sum = identity;
+
+            for (size_t i = s * sliceSize; i < std::min(n, (s + 1) * sliceSize); ++i)
+            {
+                sum = op(sum, begin[i]);
+            }
+
+            offsets[s + 1] = sum;
+        }, policy);
+
+        for (size_t s = 1; s < numberOfSlices; ++s)
+        {
+            offsets[s] = op(offsets[s - 1], offsets[s]);
+        }
+
+        ParallelFor(ZERO_SIZE, numberOfSlices, [&](size_t s)
+        {
+            Value sum = offsets[s];
+
+            for (size_t i = std::min(n, s * sliceSize); i < std::min(n, (s + 1) * sliceSize); ++i)
+            {
+                sum = op(sum, begin[i]);
+                output[i] = sum;
+            }
+
+            if (s + 1 == numberOfSlices)
+            {
+                offsets[numberOfSlices] = sum;
+            }
+        }, policy);
+
+        return offsets[numberOfSlices];
+    }
+
+    template <typename InputIterator, typename OutputIterator, typename Value, typename Operator>
+    Value ParallelExclusiveScan(InputIterator begin, InputIterator end, OutputIterator output,
+        const Value& identity, const Operator& op, ExecutionPolicy policy)
+    {
+        const size_t n = (end > begin) ? static_cast<size_t>(end - begin) : 0;
+
+        if (n == 0)
+        {
+            return identity;
+        }
+
+        const size_t numberOfSlices = Internal::GetNumberOfScanSlices(n, policy);
+        const size_t sliceSize = (n + numberOfSlices - 1) / numberOfSlices;
+
+        // offsets[s] is the reduction of the slices before s
+        std::vector<Value> offsets(numberOfSlices + 1, identity);
+
+        ParallelFor(ZERO_SIZE, numberOfSlices - 1, [&](size_t s)
+        {
+            Value sum = identity;
+
+            for (size_t i = s * sliceSize; i < std::min(n, (s + 1) * sliceSize); ++i)
+            {
+                sum = op(sum, begin[i]);
+            }
+
+            offsets[s + 1] = sum;
+        }, policy);
+
+        for (size_t s = 1; s < numberOfSlices; ++s)
+        {
+            offsets[s] = op(offsets[s - 1], offsets[s]);
+        }
+
+        ParallelFor(ZERO_SIZE, numberOfSlices, [&](size_t s)
+        {
+            Value sum = offsets[s];
+
+            for (size_t i = std::min(n, s * sliceSize); i < std::min(n, (s + 1) * sliceSize); ++i)
+            {
+                // Read before writing, so that the output can be the input
+                Value value = begin[i];
+                output[i] = sum;
+                sum = op(sum, value);
+            }
+
+            if (s + 1 == numberOfSlices)
+            {
+                offsets[numberOfSlices] = sum;
+            }
+        }, policy);
+
+        return offsets[numberOfSlices];
+    }
+
+    template <typename InputIterator, typename OutputIterator, typename Predicate>
+    size_t ParallelCompact(InputIterator begin, InputIterator end, OutputIterator output,
+        const Predicate& predicate, ExecutionPolicy policy)
+    {
+        const size_t n = (end > begin) ? static_cast<size_t>(end - begin) : 0;
+        const size_t numberOfSlices = Internal::GetNumberOfScanSlices(n, policy);
+        const size_t sliceSize = (n + numberOfSlices - 1) / numberOfSlices;
+
+        // Count the selected elements of each slice, then scan the counts
+        std::vector<size_t> offsets(numberOfSlices + 1, 0);
+
+        ParallelFor(ZERO_SIZE, numberOfSlices, [&](size_t s)
+        {
+            size_t count = 0;
+
+            for (size_t i = std::min(n, s * sliceSize); i < std::min(n, (s + 1) * sliceSize); ++i)
+            {
+                count += predicate(begin[i]) ? 1 : 0;
+            }
+
+            offsets[s + 1] = count;
+        }, policy);
+
+        for (size_t s = 0; s < numberOfSlices; ++s)
+        {
+            offsets[s + 1] += offsets[s];
+        }
+
+        ParallelFor(ZERO_SIZE, numberOfSlices, [&](size_t s)
+        {
+            size_t j = offsets[s];
+
+            for (size_t i = std::min(n, s * sliceSize); i < std::min(n, (s + 1) * sliceSize); ++i)
+            {
+                if (predicate(begin[i]))
+                {
+                    output[j++] = begin[i];
+                }
+            }
+        }, policy);
+
+        return offsets[numberOfSlices];
+    }
+
+    template <typename RandomIterator, typename Predicate>
+    size_t ParallelPartition(RandomIterator begin, RandomIterator end,
+        const Predicate& predicate, ExecutionPolicy policy)
+    {
+        using value_type = typename std::iterator_traits<RandomIterator>::value_type;
+
+        const size_t n = (end > begin) ? static_cast<size_t>(end - begin) : 0;
+        const size_t numberOfSlices = Internal::GetNumberOfScanSlices(n, policy);
+        const size_t sliceSize = (n + numberOfSlices - 1) / numberOfSlices;
+
+        // Count the selected elements of each slice, then scan the counts
+        std::vector<size_t> offsets(numberOfSlices + 1, 0);
+
+        ParallelFor(ZERO_SIZE, numberOfSlices, [&](size_t s)
+        {
+            size_t count = 0;
+
+            for (size_t i = std::min(n, s * sliceSize); i < std::min(n, (s + 1) * sliceSize); ++i)
+            {
+                count += predicate(begin[i]) ? 1 : 0;
+            }
+
+            offsets[s + 1] = count;
+        }, policy);
+
+        for (size_t s = 0; s < numberOfSlices; ++s)
+        {
+            offsets[s + 1] += offsets[s];
+        }
+
+        const size_t numberOfSelected = offsets[numberOfSlices];
+
+        // The selected elements go to the front and the others after them
+        std::vector<value_type> temp(n);
+
+        ParallelFor(ZERO_SIZE, numberOfSlices, [&](size_t s)
+        {
+            const size_t sliceBegin = std::min(n, s * sliceSize);
+            size_t selected = offsets[s];
+            size_t others = numberOfSelected + sliceBegin - offsets[s];
+
+            for (size_t i = sliceBegin; i < std::min(n, (s + 1) * sliceSize); ++i)
+            {
+                if (predicate(begin[i]))
+                {
+                    temp[selected++] = std::move(begin[i]);
+                }
+                else
+                {
+                    temp[others++] = std::move(begin[i]);
+                }
+            }
+        }, policy);
+
+        ParallelFor(ZERO_SIZE, n, [&](size_t i)
+        {
+            begin[i] = std::move(temp[i]);
+        }, policy);
+
+        return numberOfSelected;
+    }
+
     template <typename RandomIterator>
     void ParallelSort(RandomIterator begin, RandomIterator end, ExecutionPolicy policy)
     {
-        ParallelSort(begin, end, std::less<typename std::iterator_traits<RandomIterator>::value_type>(), policy);
+        using value_type = typename std::iterator_traits<RandomIterator>::value_type;
+
+        Internal::DefaultSort(begin, end, policy, std::integral_constant<bool,
+            std::is_integral<value_type>::value && std::is_unsigned<value_type>::value &&
+            !std::is_same<value_type, bool>::value>());
     }
 
     template <typename RandomIterator, typename CompareFunction>
@@ -540,6 +1056,101 @@ namespace CubbyFlow
             std::sort(begin, end, compareFunction);
         }
     }
+
+    template <typename KeyIterator, typename IndexIterator>
+    void ParallelCountingSort(KeyIterator keysBegin, KeyIterator keysEnd, size_t numberOfKeys,
+        IndexIterator offsets, IndexIterator sortedIndices, ExecutionPolicy policy)
+    {
+        const size_t n = (keysEnd > keysBegin) ? static_cast<size_t>(keysEnd - keysBegin) : 0;
+
+        std::fill(offsets, offsets + numberOfKeys + 1, 0);
+
+        if (n == 0 || numberOfKeys == 0)
+        {
+            return;
+        }
+
+        // Each slice has its own histogram, so the histograms and the scan cost
+        // O(numberOfSlices * numberOfKeys). Don't use more slices than that pays off.
+        size_t numberOfSlices = 1;
+        if (policy == ExecutionPolicy::Parallel)
+        {
+            const unsigned int numThreadsHint = GetMaxNumberOfThreads();
+            const size_t numThreads = (numThreadsHint == 0u) ? 8u : numThreadsHint;
+
+            numberOfSlices = std::max(std::min(numThreads, n / numberOfKeys), static_cast<size_t>(1));
+        }
+
+        const size_t sliceSize = (n + numberOfSlices - 1) / numberOfSlices;
+
+        // Histogram of each slice, stored as [slice][key]
+        std::vector<size_t> counts(numberOfSlices * numberOfKeys, 0);
+
+        ParallelFor(ZERO_SIZE, numberOfSlices, [&](size_t s)
+        {
+            size_t* sliceCounts = counts.data() + s * numberOfKeys;
+            const size_t end = std::min(n, (s + 1) * sliceSize);
+
+            for (size_t i = s * sliceSize; i < end; ++i)
+            {
+                ++sliceCounts[keysBegin[i]];
+            }
+        }, policy);
+
+        // Exclusive scan over the keys, then over the slices of each key
+        ParallelFor(ZERO_SIZE, numberOfKeys, [&](size_t k)
+        {
+            size_t sum = 0;
+
+            for (size_t s = 0; s < numberOfSlices; ++s)
+            {
+                sum += counts[s * numberOfKeys + k];
+            }
+
+            offsets[k + 1] = sum;
+        }, policy);
+
+        for (size_t k = 0; k < numberOfKeys; ++k)
+        {
+            offsets[k + 1] += offsets[k];
+        }
+
+        ParallelFor(ZERO_SIZE, numberOfKeys, [&](size_t k)
+        {
+            size_t offset = offsets[k];
+
+            for (size_t s = 0; s < numberOfSlices; ++s)
+            {
+                const size_t count = counts[s * numberOfKeys + k];
+                counts[s * numberOfKeys + k] = offset;
+                offset += count;
+            }
+        }, policy);
+
+        // Scatter each slice in order, which keeps the sort stable
+        ParallelFor(ZERO_SIZE, numberOfSlices, [&](size_t s)
+        {
+            size_t* sliceOffsets = counts.data() + s * numberOfKeys;
+            const size_t end = std::min(n, (s + 1) * sliceSize);
+
+            for (size_t i = s * sliceSize; i < end; ++i)
+            {
+                sortedIndices[sliceOffsets[keysBegin[i]]++] = i;
+            }
+        }, policy);
+    }
+
+    template <typename RandomIterator>
+    void ParallelRadixSort(RandomIterator begin, RandomIterator end, ExecutionPolicy policy)
+    {
+        Internal::RadixSortByKey<false>(begin, end, begin, policy);
+    }
+
+    template <typename KeyIterator, typename ValueIterator>
+    void ParallelSortByKey(KeyIterator keysBegin, KeyIterator keysEnd, ValueIterator valuesBegin, ExecutionPolicy policy)
+    {
+        Internal::RadixSortByKey<true>(keysBegin, keysEnd, valuesBegin, policy);
+    }
 }  // namespace CubbyFlow
 
 #endif
\ No newline at end of file
@@ -9,6 +9,10 @@
 #ifndef CUBBYFLOW_PARALLEL_H
 #define CUBBYFLOW_PARALLEL_H
 
+#include <cstddef>
+#include <functional>
+#include <memory>
+
 namespace CubbyFlow
 {
 	//! Execution policy tag.
@@ -135,8 +139,10 @@ namespace CubbyFlow
 	//!
 	//! This function makes a 3D nested for-loop specified by begin and end indices
 	//! for each dimension. X will be the inner-most loop while Z is the outer-most.
-	//! The order of the visit is not guaranteed due to the nature of parallel
-	//! execution.
+	//! In parallel, the index space is split into 3D tiles (see
+	//! SetParallelForTileSize) that are distributed over the threads, so flat
+	//! or thin domains are balanced as well as cubic ones. The order of the
+	//! visit is not guaranteed due to the nature of parallel execution.
 	//!
 	//! \param[in]  beginIndexX The begin index in X dimension.
 	//! \param[in]  endIndexX   The end index in X dimension.
@@ -164,8 +170,10 @@ namespace CubbyFlow
 	//! This function makes a 3D nested for-loop specified by begin and end indices
 	//! for each dimension. X will be the inner-most loop while Z is the outer-most.
 	//! Unlike parallelFor function, the input function object takes range instead
-	//! of single index. The order of the visit is not guaranteed due to the nature
-	//! of parallel execution.
+	//! of single index. In parallel, the function is called once per 3D tile (see
+	//! SetParallelForTileSize), so the ranges of every dimension can be partial.
+	//! The order of the visit is not guaranteed due to the nature of parallel
+	//! execution.
 	//!
 	//! \param[in]  beginIndexX The begin index in X dimension.
 	//! \param[in]  endIndexX   The end index in X dimension.
@@ -211,6 +219,112 @@ namespace CubbyFlow
 		const Reduce& reduce,
 		ExecutionPolicy policy = ExecutionPolicy::Parallel);
 
+	//!
+	//! \brief      Computes the inclusive prefix sum of a range in parallel.
+	//!
+	//! This function writes op(input[0], ..., input[i]) to output[i]. The range
+	//! is split into one slice per thread: the slices are reduced first, the
+	//! partial results are scanned, and then each slice is scanned from its
+	//! offset. The operator must be associative. The output may be the input.
+	//!
+	//! \param[in]  begin          The begin random access iterator of the input.
+	//! \param[in]  end            The end random access iterator of the input.
+	//! \param[out] output         The begin random access iterator of the output.
+	//! \param[in]  identity       Identity value for the operator.
+	//! \param[in]  op             The associative binary operator.
+	//! \param[in]  policy         The execution policy (parallel or serial).
+	//!
+	//! \tparam     InputIterator  Input iterator type.
+	//! \tparam     OutputIterator Output iterator type.
+	//! \tparam     Value          Value type.
+	//! \tparam     Operator       Operator type.
+	//!
+	//! \return     The reduction of the whole range.
+	//!
+	template <typename InputIterator, typename OutputIterator, typename Value, typename Operator>
+	Value ParallelInclusiveScan(
+		InputIterator begin, InputIterator end,
+		OutputIterator output,
+		const Value& identity, const Operator& op,
+		ExecutionPolicy policy = ExecutionPolicy::Parallel);
+
+	//!
+	//! \brief      Computes the exclusive prefix sum of a range in parallel.
+	//!
+	//! This function writes op(input[0], ..., input[i - 1]) to output[i], and
+	//! \p identity to output[0]. The operator must be associative. The output
+	//! may be the input.
+	//!
+	//! \param[in]  begin          The begin random access iterator of the input.
+	//! \param[in]  end            The end random access iterator of the input.
+	//! \param[out] output         The begin random access iterator of the output.
+	//! \param[in]  identity       Identity value for the operator.
+	//! \param[in]  op             The associative binary operator.
+	//! \param[in]  policy         The execution policy (parallel or serial).
+	//!
+	//! \tparam     InputIterator  Input iterator type.
+	//! \tparam     OutputIterator Output iterator type.
+	//! \tparam     Value          Value type.
+	//! \tparam     Operator       Operator type.
+	//!
+	//! \return     The reduction of the whole range.
+	//!
+	template <typename InputIterator, typename OutputIterator, typename Value, typename Operator>
+	Value ParallelExclusiveScan(
+		InputIterator begin, InputIterator end,
+		OutputIterator output,
+		const Value& identity, const Operator& op,
+		ExecutionPolicy policy = ExecutionPolicy::Parallel);
+
+	//!
+	//! \brief      Copies the elements that satisfy a predicate in parallel.
+	//!
+	//! This function copies the elements for which \p predicate returns true to
+	//! \p output in their original order, like std::copy_if. The predicate is
+	//! called twice for each element, once to count and once to copy.
+	//!
+	//! \param[in]  begin          The begin random access iterator of the input.
+	//! \param[in]  end            The end random access iterator of the input.
+	//! \param[out] output         The begin random access iterator of the output.
+	//! \param[in]  predicate      The predicate function.
+	//! \param[in]  policy         The execution policy (parallel or serial).
+	//!
+	//! \tparam     InputIterator  Input iterator type.
+	//! \tparam     OutputIterator Output iterator type.
+	//! \tparam     Predicate      Predicate function type.
+	//!
+	//! \return     The number of copied elements.
+	//!
+	template <typename InputIterator, typename OutputIterator, typename Predicate>
+	size_t ParallelCompact(
+		InputIterator begin, InputIterator end,
+		OutputIterator output,
+		const Predicate& predicate,
+		ExecutionPolicy policy = ExecutionPolicy::Parallel);
+
+	//!
+	//! \brief      Partitions a container in parallel.
+	//!
+	//! This function moves the elements for which \p predicate returns true to
+	//! the front of the range, like std::stable_partition. Both parts keep
+	//! their original order. The predicate is called twice for each element.
+	//!
+	//! \param[in]  begin          The begin random access iterator.
+	//! \param[in]  end            The end random access iterator.
+	//! \param[in]  predicate      The predicate function.
+	//! \param[in]  policy         The execution policy (parallel or serial).
+	//!
+	//! \tparam     RandomIterator Iterator type.
+	//! \tparam     Predicate      Predicate function type.
+	//!
+	//! \return     The number of elements for which the predicate is true.
+	//!
+	template <typename RandomIterator, typename Predicate>
+	size_t ParallelPartition(
+		RandomIterator begin, RandomIterator end,
+		const Predicate& predicate,
+		ExecutionPolicy policy = ExecutionPolicy::Parallel);
+
 	//!
 	//! \brief      Sorts a container in parallel.
 	//!
@@ -248,11 +362,167 @@ namespace CubbyFlow
 		CompareFunction compare,
 		ExecutionPolicy policy = ExecutionPolicy::Parallel);
 
+	//!
+	//! \brief      Sorts indices by integer keys with a stable counting sort.
+	//!
+	//! This function groups the indices [0, n) of the keys by their values,
+	//! which must be less than \p numberOfKeys. Each thread builds a histogram
+	//! of its own slice of the keys, the histograms are turned into offsets by
+	//! an exclusive scan, and each thread scatters its slice to the offsets.
+	//! Indices with the same key keep their original order.
+	//!
+	//! After the call, the indices with key k are stored in
+	//! sortedIndices[offsets[k]] to sortedIndices[offsets[k + 1] - 1].
+	//!
+	//! \param[in]  keysBegin       The begin random access iterator of the keys.
+	//! \param[in]  keysEnd         The end random access iterator of the keys.
+	//! \param[in]  numberOfKeys    The number of distinct key values.
+	//! \param[out] offsets         The offsets (numberOfKeys + 1 entries).
+	//! \param[out] sortedIndices   The sorted indices (n entries).
+	//! \param[in]  policy          The execution policy (parallel or serial).
+	//!
+	//! \tparam     KeyIterator     Key iterator type.
+	//! \tparam     IndexIterator   Index iterator type.
+	//!
+	template <typename KeyIterator, typename IndexIterator>
+	void ParallelCountingSort(
+		KeyIterator keysBegin, KeyIterator keysEnd,
+		size_t numberOfKeys,
+		IndexIterator offsets, IndexIterator sortedIndices,
+		ExecutionPolicy policy = ExecutionPolicy::Parallel);
+
+	//!
+	//! \brief      Sorts unsigned integers in parallel with a radix sort.
+	//!
+	//! This function sorts a container of unsigned integers specified by begin
+	//! and end iterators with a least significant digit radix sort. Each pass
+	//! sorts one byte of the keys with a stable parallel counting sort, and the
+	//! bytes above the largest key are skipped.
+	//!
+	//! \param[in]  begin          The begin random access iterator.
+	//! \param[in]  end            The end random access iterator.
+	//! \param[in]  policy         The execution policy (parallel or serial).
+	//!
+	//! \tparam     RandomIterator Iterator type.
+	//!
+	template <typename RandomIterator>
+	void ParallelRadixSort(
+		RandomIterator begin, RandomIterator end,
+		ExecutionPolicy policy = ExecutionPolicy::Parallel);
+
+	//!
+	//! \brief      Sorts unsigned integer keys and their values in parallel.
+	//!
+	//! This function sorts the keys specified by begin and end iterators with
+	//! the radix sort of ParallelRadixSort and applies the same permutation to
+	//! the values. The sort is stable, so the values with the same key keep
+	//! their order.
+	//!
+	//! \param[in]  keysBegin       The begin random access iterator of the keys.
+	//! \param[in]  keysEnd         The end random access iterator of the keys.
+	//! \param[in]  valuesBegin     The begin random access iterator of the values.
+	//! \param[in]  policy          The execution policy (parallel or serial).
+	//!
+	//! \tparam     KeyIterator     Key iterator type.
+	//! \tparam     ValueIterator   Value iterator type.
+	//!
+	template <typename KeyIterator, typename ValueIterator>
+	void ParallelSortByKey(
+		KeyIterator keysBegin, KeyIterator keysEnd,
+		ValueIterator valuesBegin,
+		ExecutionPolicy policy = ExecutionPolicy::Parallel);
+
+	//!
+	//! \brief Thread budget for the parallel functions of one simulation.
+	//!
+	//! While a function runs through Execute, every parallel function called
+	//! from it uses the thread count of this executor instead of the global
+	//! one set by SetMaxNumberOfThreads. This lets several simulations run
+	//! side by side in one process, each with its own share of the cores. The
+	//! worker threads of every tasking backend inherit the executor, so nested
+	//! parallel calls inside a loop body stay within the same budget. With
+	//! TBB the executor owns a task arena of that size, and with OpenMP it sets
+	//! the number of threads of the calling thread for the duration of the call.
+	//!
+	class ParallelExecutor
+	{
+	public:
+		class Scope;
+
+		//! Constructs an executor with given number of threads.
+		explicit ParallelExecutor(unsigned int numThreads);
+
+		~ParallelExecutor();
+
+		ParallelExecutor(const ParallelExecutor&) = delete;
+
+		ParallelExecutor& operator=(const ParallelExecutor&) = delete;
+
+		//! Returns the number of threads of this executor.
+		unsigned int GetNumberOfThreads() const;
+
+		//! Runs \p function with this executor on the calling thread.
+		void Execute(const std::function<void()>& function);
+
+		//! Returns the executor of the calling thread, or nullptr if there is none.
+		static ParallelExecutor* GetCurrent();
+
+	private:
+		struct Arena;
+
+		unsigned int m_numThreads;
+		std::unique_ptr<Arena> m_arena;
+	};
+
+	//!
+	//! \brief Makes an executor current on the calling thread for its lifetime.
+	//!
+	//! The worker threads of the parallel functions use this to inherit the
+	//! executor of the thread that launched them. Unlike Execute, it does not
+	//! enter the task arena.
+	//!
+	class ParallelExecutor::Scope
+	{
+	public:
+		//! Makes \p executor current. Null makes the global settings current.
+		explicit Scope(ParallelExecutor* executor);
+
+		~Scope();
+
+		Scope(const Scope&) = delete;
+
+		Scope& operator=(const Scope&) = delete;
+
+	private:
+		ParallelExecutor* m_previous;
+	};
+
+	//! Shared pointer type for the ParallelExecutor.
+	using ParallelExecutorPtr = std::shared_ptr<ParallelExecutor>;
+
 	//! Sets maximum number of threads to use.
 	void SetMaxNumberOfThreads(unsigned int numThreads);
 
-	//! Returns maximum number of threads to use.
+	//!
+	//! \brief Returns maximum number of threads to use.
+	//!
+	//! Inside ParallelExecutor::Execute, this returns the number of threads of
+	//! that executor.
+	//!
 	unsigned int GetMaxNumberOfThreads();
+
+	//!
+	//! \brief Sets the tile size of the 3D nested loops.
+	//!
+	//! The 3D ParallelFor and ParallelRangeFor functions split their index space
+	//! into tiles of this size and distribute the tiles over the threads. The
+	//! default is 1024 x 8 x 8, which keeps the rows of common grids whole and
+	//! still gives a 1024 x 1024 x 32 domain 512 tiles. Zero is treated as one.
+	//!
+	void SetParallelForTileSize(size_t tileSizeX, size_t tileSizeY, size_t tileSizeZ);
+
+	//! Returns the tile size of the 3D nested loops.
+	void GetParallelForTileSize(size_t* tileSizeX, size_t* tileSizeY, size_t* tileSizeZ);
 }
 
 #include <Core/Utils/Parallel-Impl.h>
@@ -10,8 +10,10 @@
 #define CUBBYFLOW_VECTOR3_IMPL_H
 
 #include <Core/Math/MathUtils.h>
+#include <Core/Math/SIMD.h>
 
 #include <cassert>
+#include <type_traits>
 
 namespace CubbyFlow
 {
@@ -135,6 +137,11 @@ namespace CubbyFlow
 	template <typename T>
 	T Vector<T, 3>::Dot(const Vector& v) const
 	{
+		if constexpr (std::is_same<T, double>::value)
+		{
+			return SIMDDot3(&x, &v.x);
+		}
+
 		return x * v.x + y * v.y + z * v.z;
 	}
 
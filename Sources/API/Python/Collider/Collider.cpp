@@ -58,6 +58,13 @@ void AddCollider3(pybind11::module& m)
 			This property specifies the friction coefficient to the collider. Any
 			negative inputs will be clamped to zero.
 		)pbdoc")
+	.def_property("isUsingSDFCache", &Collider3::IsUsingSDFCache, &Collider3::SetIsUsingSDFCache,
+		R"pbdoc(
+			True if the collider caches the signed distance field of its surface.
+
+			The cached field is sampled in the local frame of the surface, so it
+			stays valid while the surface moves rigidly.
+		)pbdoc")
 	.def_property_readonly("surface", &Collider3::GetSurface,
 		R"pbdoc(
 			The surface instance.
@@ -77,5 +77,9 @@ void AddGridFractionalSinglePhasePressureSolver3(pybind11::module& m)
 	.def_property("linearSystemSolver", &GridFractionalSinglePhasePressureSolver3::GetLinearSystemSolver, &GridFractionalSinglePhasePressureSolver3::SetLinearSystemSolver,
 		R"pbdoc(
 			"The linear system solver."
+		)pbdoc")
+	.def_property("useWarmStart", &GridFractionalSinglePhasePressureSolver3::GetUseWarmStart, &GridFractionalSinglePhasePressureSolver3::SetUseWarmStart,
+		R"pbdoc(
+			True if the solve starts from the previous pressure.
 		)pbdoc");
 }
\ No newline at end of file
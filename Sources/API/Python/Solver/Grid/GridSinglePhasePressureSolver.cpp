@@ -59,5 +59,9 @@ void AddGridSinglePhasePressureSolver3(pybind11::module& m)
 	.def_property("linearSystemSolver", &GridSinglePhasePressureSolver3::GetLinearSystemSolver, &GridSinglePhasePressureSolver3::SetLinearSystemSolver,
 		R"pbdoc(
 			"The linear system solver."
+		)pbdoc")
+	.def_property("useWarmStart", &GridSinglePhasePressureSolver3::GetUseWarmStart, &GridSinglePhasePressureSolver3::SetUseWarmStart,
+		R"pbdoc(
+			True if the solve starts from the previous pressure.
 		)pbdoc");
 }
\ No newline at end of file
@@ -152,6 +152,14 @@ void AddLevelSetLiquidSolver3(pybind11::module& m)
 			24, no. 1 (2005): 81-97.
 		)pbdoc",
 		pybind11::arg("isEnabled"))
+	.def_property("narrowBandWidth", &LevelSetLiquidSolver3::GetNarrowBandWidth, &LevelSetLiquidSolver3::SetNarrowBandWidth,
+		R"pbdoc(
+			Width of the narrow band in number of cells (zero disables the band).
+		)pbdoc")
+	.def_property_readonly("numberOfNarrowBandCells", &LevelSetLiquidSolver3::GetNumberOfNarrowBandCells,
+		R"pbdoc(
+			Returns the number of cells in the current narrow band.
+		)pbdoc")
 	.def("ComputeVolume", &LevelSetLiquidSolver3::ComputeVolume,
 		R"pbdoc(
 			Returns liquid volume measured by smeared Heaviside function.
@@ -0,0 +1,106 @@
+/*************************************************************************
+> File Name: DFSPHSolver.cpp
+> Project Name: CubbyFlow
+> Author: Chan-Ho Chris Ohk
+> Purpose: DFSPHSolver functions for CubbyFlow Python API.
+> Created Time: 2026/10/19
+> Copyright (c) 2018, Chan-Ho Chris Ohk
+*************************************************************************/
+#include <API/Python/Solver/Particle/DFSPH/DFSPHSolver.h>
+#include <Core/Solver/Particle/DFSPH/DFSPHSolver2.h>
+#include <Core/Solver/Particle/DFSPH/DFSPHSolver3.h>
+#include <Core/Utils/Constants.h>
+
+#include <pybind11/pybind11.h>
+
+using namespace CubbyFlow;
+
+void AddDFSPHSolver2(pybind11::module& m)
+{
+	pybind11::class_<DFSPHSolver2, DFSPHSolver2Ptr, SPHSolver2>(static_cast<pybind11::handle>(m), "DFSPHSolver2",
+		R"pbdoc(
+			2-D DFSPH solver.
+
+			This class implements 2-D divergence-free SPH solver. The main
+			pressure solver is based on Bender and Koschier's 2015 SCA paper.
+			- See Bender and Koschier, Divergence-free smoothed particle
+			hydrodynamics, Proceedings of the 14th ACM SIGGRAPH/Eurographics
+			Symposium on Computer Animation. ACM, 2015.
+		)pbdoc")
+	.def(pybind11::init<double, double, double>(),
+		R"pbdoc(
+			Constructs a solver with target density, spacing, and relative kernel
+			radius.
+		)pbdoc",
+		pybind11::arg("targetDensity") = WATER_DENSITY,
+		pybind11::arg("targetSpacing") = 0.1,
+		pybind11::arg("relativeKernelRadius") = 1.8)
+	.def_property("maxDensityErrorRatio", &DFSPHSolver2::GetMaxDensityErrorRatio, &DFSPHSolver2::SetMaxDensityErrorRatio,
+		R"pbdoc(
+			The max allowed average density error ratio.
+
+			This property sets the max allowed average density error ratio during
+			the density solve. Default is 0.001 (0.1%). The input value should be
+			positive.
+		)pbdoc")
+	.def_property("maxDivergenceErrorRatio", &DFSPHSolver2::GetMaxDivergenceErrorRatio, &DFSPHSolver2::SetMaxDivergenceErrorRatio,
+		R"pbdoc(
+			The max allowed average divergence error ratio.
+
+			This property sets the max allowed average density change per time
+			step during the divergence solve. Default is 0.1 (10%). The input
+			value should be positive.
+		)pbdoc")
+	.def_property("maxNumberOfIterations", &DFSPHSolver2::GetMaxNumberOfIterations, &DFSPHSolver2::SetMaxNumberOfIterations,
+		R"pbdoc(
+			The max number of iterations.
+
+			This property sets the max number of iterations of the divergence and
+			the density solve. Default is 100.
+		)pbdoc");
+}
+
+void AddDFSPHSolver3(pybind11::module& m)
+{
+	pybind11::class_<DFSPHSolver3, DFSPHSolver3Ptr, SPHSolver3>(static_cast<pybind11::handle>(m), "DFSPHSolver3",
+		R"pbdoc(
+			3-D DFSPH solver.
+
+			This class implements 3-D divergence-free SPH solver. The main
+			pressure solver is based on Bender and Koschier's 2015 SCA paper.
+			- See Bender and Koschier, Divergence-free smoothed particle
+			hydrodynamics, Proceedings of the 14th ACM SIGGRAPH/Eurographics
+			Symposium on Computer Animation. ACM, 2015.
+		)pbdoc")
+	.def(pybind11::init<double, double, double>(),
+		R"pbdoc(
+			Constructs a solver with target density, spacing, and relative kernel
+			radius.
+		)pbdoc",
+		pybind11::arg("targetDensity") = WATER_DENSITY,
+		pybind11::arg("targetSpacing") = 0.1,
+		pybind11::arg("relativeKernelRadius") = 1.8)
+	.def_property("maxDensityErrorRatio", &DFSPHSolver3::GetMaxDensityErrorRatio, &DFSPHSolver3::SetMaxDensityErrorRatio,
+		R"pbdoc(
+			The max allowed average density error ratio.
+
+			This property sets the max allowed average density error ratio during
+			the density solve. Default is 0.001 (0.1%). The input value should be
+			positive.
+		)pbdoc")
+	.def_property("maxDivergenceErrorRatio", &DFSPHSolver3::GetMaxDivergenceErrorRatio, &DFSPHSolver3::SetMaxDivergenceErrorRatio,
+		R"pbdoc(
+			The max allowed average divergence error ratio.
+
+			This property sets the max allowed average density change per time
+			step during the divergence solve. Default is 0.1 (10%). The input
+			value should be positive.
+		)pbdoc")
+	.def_property("maxNumberOfIterations", &DFSPHSolver3::GetMaxNumberOfIterations, &DFSPHSolver3::SetMaxNumberOfIterations,
+		R"pbdoc(
+			The max number of iterations.
+
+			This property sets the max number of iterations of the divergence and
+			the density solve. Default is 100.
+		)pbdoc");
+}
@@ -76,6 +76,7 @@
 #include <API/Python/Solver/LevelSet/UpwindLevelSetSolver.h>
 #include <API/Python/Solver/LevelSet/ENOLevelSetSolver.h>
 #include <API/Python/Solver/LevelSet/FMMLevelSetSolver.h>
+#include <API/Python/Solver/LevelSet/FSMLevelSetSolver.h>
 #include <API/Python/Solver/Grid/GridFluidSolver.h>
 #include <API/Python/Solver/Grid/GridSmokeSolver.h>
 #include <API/Python/Solver/LevelSet/LevelSetLiquidSolver.h>
@@ -85,6 +86,7 @@
 #include <API/Python/Solver/Particle/ParticleSystemSolver.h>
 #include <API/Python/Solver/Particle/SPH/SPHSolver.h>
 #include <API/Python/Solver/Particle/PCISPH/PCISPHSolver.h>
+#include <API/Python/Solver/Particle/DFSPH/DFSPHSolver.h>
 #include <API/Python/SPH/SPHSystemData.h>
 #include <API/Python/Surface/Surface.h>
 #include <API/Python/Surface/SurfaceSet.h>
@@ -296,6 +298,7 @@ PYBIND11_MODULE(pyCubbyFlow, m)
 	AddENOLevelSetSolver3(m);
 	AddFMMLevelSetSolver2(m);
 	AddFMMLevelSetSolver3(m);
+	AddFSMLevelSetSolver3(m);
 
 	// Points to implicit functions
 	AddPointsToImplicit2(m);
@@ -332,6 +335,8 @@ PYBIND11_MODULE(pyCubbyFlow, m)
 	AddSPHSolver3(m);
 	AddPCISPHSolver2(m);
 	AddPCISPHSolver3(m);
+	AddDFSPHSolver2(m);
+	AddDFSPHSolver3(m);
 
 #ifdef VERSION_INFO
 	m.attr("__version__") = pybind11::str(VERSION_INFO);
@@ -11,6 +11,10 @@
 #include <Core/Utils/Macros.h>
 #include <Core/Utils/Timer.h>
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 namespace CubbyFlow
 {
 	PhysicsAnimation::PhysicsAnimation()
@@ -43,6 +47,36 @@ namespace CubbyFlow
 		m_numberOfFixedSubTimeSteps = numberOfSteps;
 	}
 
+	double PhysicsAnimation::GetMaxSubTimeStepGrowth() const
+	{
+		return m_maxSubTimeStepGrowth;
+	}
+
+	void PhysicsAnimation::SetMaxSubTimeStepGrowth(double factor)
+	{
+		m_maxSubTimeStepGrowth = std::max(factor, 1.0);
+	}
+
+	const SubTimeStepStatistics& PhysicsAnimation::GetSubTimeStepStatistics() const
+	{
+		return m_statistics;
+	}
+
+	void PhysicsAnimation::ResetSubTimeStepStatistics()
+	{
+		m_statistics = SubTimeStepStatistics();
+	}
+
+	const ParallelExecutorPtr& PhysicsAnimation::GetExecutor() const
+	{
+		return m_executor;
+	}
+
+	void PhysicsAnimation::SetExecutor(const ParallelExecutorPtr& executor)
+	{
+		m_executor = executor;
+	}
+
 	void PhysicsAnimation::AdvanceSingleFrame()
 	{
 		Frame f = m_currentFrame;
@@ -73,6 +107,21 @@ namespace CubbyFlow
 	}
 
 	void PhysicsAnimation::OnUpdate(const Frame& frame)
+	{
+		if (m_executor != nullptr)
+		{
+			m_executor->Execute([&]()
+			{
+				AdvanceFrames(frame);
+			});
+		}
+		else
+		{
+			AdvanceFrames(frame);
+		}
+	}
+
+	void PhysicsAnimation::AdvanceFrames(const Frame& frame)
 	{
 		if (frame.index > m_currentFrame.index)
 		{
@@ -96,6 +145,8 @@ namespace CubbyFlow
 	{
 		m_currentTime = m_currentFrame.TimeInSeconds();
 
+		const size_t numberOfSubTimeStepsBefore = m_statistics.numberOfSubTimeSteps;
+
 		if (m_isUsingFixedSubTimeSteps)
 		{
 			CUBBYFLOW_INFO << "Using fixed sub-timesteps: " << m_numberOfFixedSubTimeSteps;
@@ -105,16 +156,7 @@ namespace CubbyFlow
 
 			for (unsigned int i = 0; i < m_numberOfFixedSubTimeSteps; ++i)
 			{
-				CUBBYFLOW_INFO << "Begin onAdvanceTimeStep: " << actualTimeInterval
-					<< " (1/" << 1.0 / actualTimeInterval << ") seconds";
-
-				Timer timer;
-				OnAdvanceTimeStep(actualTimeInterval);
-
-				CUBBYFLOW_INFO << "End onAdvanceTimeStep (took "
-					<< timer.DurationInSeconds() << " seconds)";
-
-				m_currentTime += actualTimeInterval;
+				TakeSubTimeStep(actualTimeInterval);
 			}
 		}
 		else
@@ -123,26 +165,54 @@ namespace CubbyFlow
 
 			// Perform adaptive time-stepping
 			double remainingTime = timeIntervalInSeconds;
+
 			while (remainingTime > std::numeric_limits<double>::epsilon())
 			{
-				unsigned int numSteps = GetNumberOfSubTimeSteps(remainingTime);
+				Timer estimationTimer;
+				unsigned int numSteps = std::max(GetNumberOfSubTimeSteps(remainingTime), 1u);
 				double actualTimeInterval = remainingTime / static_cast<double>(numSteps);
 
-				CUBBYFLOW_INFO << "Number of remaining sub-timesteps: " << numSteps;
+				++m_statistics.numberOfEstimations;
+				m_statistics.estimationTimeInSeconds += estimationTimer.DurationInSeconds();
 
-				CUBBYFLOW_INFO << "Begin onAdvanceTimeStep: " << actualTimeInterval
-					<< " (1/" << 1.0 / actualTimeInterval << ") seconds";
+				// Let the sub-timestep grow by a bounded factor only
+				const double maxTimeInterval = m_maxSubTimeStepGrowth * m_lastSubTimeStepInSeconds;
+				if (m_lastSubTimeStepInSeconds > 0.0 && actualTimeInterval > maxTimeInterval)
+				{
+					numSteps = static_cast<unsigned int>(std::ceil(remainingTime / maxTimeInterval - 1e-9));
+					actualTimeInterval = remainingTime / static_cast<double>(numSteps);
+				}
 
-				Timer timer;
-				OnAdvanceTimeStep(actualTimeInterval);
+				CUBBYFLOW_INFO << "Number of remaining sub-timesteps: " << numSteps;
 
-				CUBBYFLOW_INFO << "End onAdvanceTimeStep (took "
-					<< timer.DurationInSeconds() << " seconds)";
+				TakeSubTimeStep(actualTimeInterval);
 
+				m_lastSubTimeStepInSeconds = actualTimeInterval;
 				remainingTime -= actualTimeInterval;
-				m_currentTime += actualTimeInterval;
 			}
 		}
+
+		const unsigned int numberOfSubTimeStepsInFrame = static_cast<unsigned int>(m_statistics.numberOfSubTimeSteps - numberOfSubTimeStepsBefore);
+		++m_statistics.numberOfFrames;
+		m_statistics.numberOfSubTimeStepsInLastFrame = numberOfSubTimeStepsInFrame;
+		m_statistics.maxNumberOfSubTimeStepsPerFrame = std::max(m_statistics.maxNumberOfSubTimeStepsPerFrame, numberOfSubTimeStepsInFrame);
+	}
+
+	void PhysicsAnimation::TakeSubTimeStep(double timeIntervalInSeconds)
+	{
+		CUBBYFLOW_INFO << "Begin onAdvanceTimeStep: " << timeIntervalInSeconds
+			<< " (1/" << 1.0 / timeIntervalInSeconds << ") seconds";
+
+		Timer timer;
+		OnAdvanceTimeStep(timeIntervalInSeconds);
+		const double stepTimeInSeconds = timer.DurationInSeconds();
+
+		CUBBYFLOW_INFO << "End onAdvanceTimeStep (took "
+			<< stepTimeInSeconds << " seconds)";
+
+		++m_statistics.numberOfSubTimeSteps;
+		m_statistics.stepTimeInSeconds += stepTimeInSeconds;
+		m_currentTime += timeIntervalInSeconds;
 	}
 
 	void PhysicsAnimation::Initialize()
@@ -7,9 +7,20 @@
 > Copyright (c) 2018, Chan-Ho Chris Ohk
 *************************************************************************/
 #include <Core/Collider/Collider3.h>
+#include <Core/Surface/ImplicitSurface3.h>
+#include <Core/Surface/SurfaceToImplicit3.h>
 
 namespace CubbyFlow
 {
+	namespace
+	{
+		// Number of cells the cached SDF extends beyond the surface bounds.
+		const double SDF_CACHE_PADDING = 4.0;
+
+		// Max number of cells per axis for the cached SDF.
+		const double MAX_SDF_CACHE_RESOLUTION = 1024.0;
+	}
+
 	Collider3::Collider3()
 	{
 		// Do nothing
@@ -81,9 +92,109 @@ namespace CubbyFlow
 		return m_surface;
 	}
 
+	bool Collider3::IsUsingSDFCache() const
+	{
+		return m_isUsingSDFCache;
+	}
+
+	void Collider3::SetIsUsingSDFCache(bool isUsingSDFCache)
+	{
+		m_isUsingSDFCache = isUsingSDFCache;
+
+		if (!m_isUsingSDFCache)
+		{
+			InvalidateSDFCache();
+		}
+	}
+
+	const CellCenteredScalarGrid3Ptr& Collider3::GetLocalSDF(const Vector3D& gridSpacing)
+	{
+		if (!m_isUsingSDFCache || m_surface == nullptr)
+		{
+			InvalidateSDFCache();
+			return m_localSDF;
+		}
+
+		// A failed build is cached too, but only for the same grid spacing
+		if (m_isLocalSDFBuilt && m_localSDFGridSpacing == gridSpacing)
+		{
+			return m_localSDF;
+		}
+
+		m_isLocalSDFBuilt = true;
+		m_localSDFGridSpacing = gridSpacing;
+		m_localSDF = nullptr;
+
+		// The bounds are taken in the local frame so that the cache can follow
+		// any later rigid motion of the surface.
+		const Transform3& transform = m_surface->transform;
+		const BoundingBox3D worldBound = m_surface->BoundingBox();
+		if (worldBound.IsEmpty())
+		{
+			return m_localSDF;
+		}
+
+		BoundingBox3D bound = transform.ToLocal(worldBound);
+
+		const double padding = SDF_CACHE_PADDING * gridSpacing.Max();
+		bound.Expand(padding);
+
+		const Vector3D resolution = (bound.upperCorner - bound.lowerCorner) / gridSpacing;
+		if (!(resolution.Max() <= MAX_SDF_CACHE_RESOLUTION))
+		{
+			return m_localSDF;
+		}
+
+		ImplicitSurface3Ptr implicitSurface = std::dynamic_pointer_cast<ImplicitSurface3>(m_surface);
+		if (implicitSurface == nullptr)
+		{
+			implicitSurface = std::make_shared<SurfaceToImplicit3>(m_surface);
+		}
+
+		m_localSDF = std::make_shared<CellCenteredScalarGrid3>(
+			static_cast<size_t>(std::ceil(resolution.x)),
+			static_cast<size_t>(std::ceil(resolution.y)),
+			static_cast<size_t>(std::ceil(resolution.z)),
+			gridSpacing.x, gridSpacing.y, gridSpacing.z,
+			bound.lowerCorner.x, bound.lowerCorner.y, bound.lowerCorner.z);
+
+		m_localSDF->Fill([&](const Vector3D& pt)
+		{
+			return implicitSurface->SignedDistance(transform.ToWorld(pt));
+		}, ExecutionPolicy::Parallel);
+
+		m_localSDFPadding = padding;
+
+		return m_localSDF;
+	}
+
+	double Collider3::GetLocalSDFFarValue(const Vector3D& point) const
+	{
+		if (m_surface == nullptr || m_localSDF == nullptr)
+		{
+			return 0.0;
+		}
+
+		// The side is taken from the closest surface point, so surfaces that
+		// are not convex or enclose the point get the right sign
+		const Vector3D closestPoint = m_surface->ClosestPoint(point);
+		const Vector3D closestNormal = m_surface->ClosestNormal(point);
+
+		return ((point - closestPoint).Dot(closestNormal) < 0.0) ? -m_localSDFPadding : m_localSDFPadding;
+	}
+
+	void Collider3::InvalidateSDFCache()
+	{
+		m_isLocalSDFBuilt = false;
+		m_localSDF = nullptr;
+		m_localSDFPadding = 0.0;
+	}
+
 	void Collider3::SetSurface(const Surface3Ptr& newSurface)
 	{
 		m_surface = newSurface;
+
+		InvalidateSDFCache();
 	}
 
 	void Collider3::GetClosestPoint(const Surface3Ptr& surface, const Vector3D& queryPoint, ColliderQueryResult* result) const
@@ -8,14 +8,19 @@
 *************************************************************************/
 #include <Core/Emitter/VolumeParticleEmitter3.h>
 #include <Core/PointGenerator/BccLatticePointGenerator.h>
-#include <Core/Searcher/PointHashGridSearcher3.h>
 #include <Core/Surface/SurfaceToImplicit3.h>
+#include <Core/Utils/Parallel.h>
 #include <Core/Utils/Samplers.h>
 
+#include <algorithm>
+
 namespace CubbyFlow
 {
 	static const size_t DEFAULT_HASH_GRID_RESOLUTION = 64;
 
+	// Number of candidates tested at once
+	static const size_t EMISSION_BATCH_SIZE = 1 << 16;
+
 	VolumeParticleEmitter3::VolumeParticleEmitter3(
 		const ImplicitSurface3Ptr& implicitSurface,
 		const BoundingBox3D& bounds,
@@ -78,71 +83,130 @@ namespace CubbyFlow
 		const double j = GetJitter();
 		const double maxJitterDist = 0.5 * j * m_spacing;
 
-		if (m_allowOverlapping || m_isOneShot)
+		// Only the continuous, non-overlapping mode has to check the neighbors
+		const bool checkNeighbors = !(m_allowOverlapping || m_isOneShot);
+		if (checkNeighbors)
 		{
-			m_pointsGen->ForEachPoint(m_bounds, m_spacing, [&](const Vector3D& point)
-			{
-				Vector3D randomDir = UniformSampleSphere(Random(), Random());
-				Vector3D offset = maxJitterDist * randomDir;
-				Vector3D candidate = point + offset;
-		
-				if (m_implicitSurface->SignedDistance(candidate) <= 0.0)
-				{
-					if (m_numberOfEmittedParticles < m_maxNumberOfParticles)
-					{
-						newPositions->Append(candidate);
-						++m_numberOfEmittedParticles;
-					}
-					else
-					{
-						return false;
-					}
-				}
-
-				return true;
-			});
+			BuildNeighborSearcher(particles->GetPositions(), maxJitterDist);
 		}
-		else
+
+		// The candidates are generated serially so that the random sequence only
+		// depends on the seed, and are tested against the surface and the
+		// existing particles in parallel. The acceptance then runs in lattice
+		// order to keep the result independent of the number of threads.
+		Array1<Vector3D> candidates;
+		Array1<char> isCandidateValid;
+		bool isFull = false;
+
+		auto processCandidates = [&]()
 		{
-			// Use serial hash grid searcher for continuous update.
-			PointHashGridSearcher3 neighborSearcher(
-				Size3(DEFAULT_HASH_GRID_RESOLUTION, DEFAULT_HASH_GRID_RESOLUTION, DEFAULT_HASH_GRID_RESOLUTION),
-				2.0 * m_spacing);
-			
-			if (!m_allowOverlapping)
+			isCandidateValid.Resize(candidates.size());
+
+			ParallelFor(ZERO_SIZE, candidates.size(), [&](size_t i)
 			{
-				neighborSearcher.Build(particles->GetPositions());
-			}
+				const Vector3D& candidate = candidates[i];
 
-			m_pointsGen->ForEachPoint(m_bounds, m_spacing, [&](const Vector3D& point)
+				isCandidateValid[i] =
+					m_implicitSurface->SignedDistance(candidate) <= 0.0 &&
+					(!checkNeighbors || !m_neighborSearcher->HasNearbyPoint(candidate, m_spacing));
+			});
+
+			for (size_t i = 0; i < candidates.size(); ++i)
 			{
-				Vector3D randomDir = UniformSampleSphere(Random(), Random());
-				Vector3D offset = maxJitterDist * randomDir;
-				Vector3D candidate = point + offset;
+				if (!isCandidateValid[i])
+				{
+					continue;
+				}
 
-				if (m_implicitSurface->SignedDistance(candidate) <= 0.0 &&
-					(!m_allowOverlapping && !neighborSearcher.HasNearbyPoint(candidate, m_spacing)))
+				// Earlier candidates from this emission may overlap as well
+				if (checkNeighbors && m_neighborSearcher->HasNearbyPoint(candidates[i], m_spacing))
 				{
-					if (m_numberOfEmittedParticles < m_maxNumberOfParticles)
-					{
-						newPositions->Append(candidate);
-						neighborSearcher.Add(candidate);
-						++m_numberOfEmittedParticles;
-					}
-					else
-					{
-						return false;
-					}
+					continue;
 				}
 
-				return true;
-			});
+				if (m_numberOfEmittedParticles >= m_maxNumberOfParticles)
+				{
+					isFull = true;
+					break;
+				}
+
+				newPositions->Append(candidates[i]);
+				++m_numberOfEmittedParticles;
+
+				if (checkNeighbors)
+				{
+					m_neighborSearcher->Add(candidates[i]);
+					m_searchedPositions.Append(candidates[i]);
+				}
+			}
+
+			candidates.Clear();
+		};
+
+		m_pointsGen->ForEachPoint(m_bounds, m_spacing, [&](const Vector3D& point)
+		{
+			Vector3D randomDir = UniformSampleSphere(Random(), Random());
+			Vector3D offset = maxJitterDist * randomDir;
+			candidates.Append(point + offset);
+
+			if (candidates.size() >= EMISSION_BATCH_SIZE)
+			{
+				processCandidates();
+			}
+
+			return !isFull;
+		});
+
+		if (!isFull)
+		{
+			processCandidates();
 		}
 
 		newVelocities->Resize(newPositions->size());
 		newVelocities->Set(m_initialVel);
 	}
 
+	void VolumeParticleEmitter3::BuildNeighborSearcher(const ConstArrayAccessor1<Vector3D>& positions, double maxJitterDist)
+	{
+		bool isSearcherReset = false;
+
+		if (m_neighborSearcher == nullptr || m_neighborSearcherSpacing != m_spacing)
+		{
+			m_neighborSearcher = std::make_shared<PointHashGridSearcher3>(
+				Size3(DEFAULT_HASH_GRID_RESOLUTION, DEFAULT_HASH_GRID_RESOLUTION, DEFAULT_HASH_GRID_RESOLUTION),
+				2.0 * m_spacing);
+			m_neighborSearcherSpacing = m_spacing;
+			m_searchedPositions.Clear();
+			isSearcherReset = true;
+		}
+
+		// Particles farther than the search radius from the jittered lattice
+		// can never reject a candidate.
+		BoundingBox3D bounds = m_bounds;
+		bounds.Expand(m_spacing + maxJitterDist);
+
+		Array1<Vector3D> nearbyPositions(positions.size());
+		const size_t numberOfNearbyPositions = ParallelCompact(
+			positions.begin(), positions.end(), nearbyPositions.begin(),
+			[&](const Vector3D& position)
+		{
+			return bounds.Contains(position);
+		});
+		nearbyPositions.Resize(numberOfNearbyPositions);
+
+		// The searcher already holds the particles of the previous emission, so
+		// it is only rebuilt when they have moved or changed.
+		if (!isSearcherReset &&
+			nearbyPositions.size() == m_searchedPositions.size() &&
+			std::equal(nearbyPositions.begin(), nearbyPositions.end(), m_searchedPositions.begin()))
+		{
+			return;
+		}
+
+		m_searchedPositions.Swap(nearbyPositions);
+		m_neighborSearcher->Build(m_searchedPositions);
+	}
+
 	void VolumeParticleEmitter3::SetPointGenerator(const PointGenerator3Ptr& newPointsGen)
 	{
 		m_pointsGen = newPointsGen;
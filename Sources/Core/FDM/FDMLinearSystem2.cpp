@@ -10,6 +10,7 @@
 #include <Core/Math/MathUtils.h>
 
 #include <cassert>
+#include <limits>
 
 namespace CubbyFlow
 {
@@ -32,6 +33,48 @@ namespace CubbyFlow
 		A.Clear();
 		x.Clear();
 		b.Clear();
+		colors.clear();
+	}
+
+	void FDMCompressedLinearSystem2::BuildColors()
+	{
+		const size_t numRows = A.Rows();
+		const auto rp = A.RowPointersBegin();
+		const auto ci = A.ColumnIndicesBegin();
+
+		const size_t unassigned = std::numeric_limits<size_t>::max();
+		std::vector<size_t> rowColors(numRows, unassigned);
+		std::vector<size_t> lastUsedBy;
+
+		colors.clear();
+
+		for (size_t i = 0; i < numRows; ++i)
+		{
+			// Mark the colors used by the already colored neighbors
+			for (size_t jj = rp[i]; jj < rp[i + 1]; ++jj)
+			{
+				const size_t c = rowColors[ci[jj]];
+				if (c != unassigned)
+				{
+					lastUsedBy[c] = i;
+				}
+			}
+
+			size_t color = 0;
+			while (color < colors.size() && lastUsedBy[color] == i)
+			{
+				++color;
+			}
+
+			if (color == colors.size())
+			{
+				colors.emplace_back();
+				lastUsedBy.push_back(unassigned);
+			}
+
+			rowColors[i] = color;
+			colors[color].push_back(i);
+		}
 	}
 
 	void FDMBLAS2::Set(double s, FDMVector2* result)
@@ -10,6 +10,7 @@
 #include <Core/Math/MathUtils.h>
 
 #include <cassert>
+#include <limits>
 
 namespace CubbyFlow
 {
@@ -32,6 +33,48 @@ namespace CubbyFlow
 		A.Clear();
 		x.Clear();
 		b.Clear();
+		colors.clear();
+	}
+
+	void FDMCompressedLinearSystem3::BuildColors()
+	{
+		const size_t numRows = A.Rows();
+		const auto rp = A.RowPointersBegin();
+		const auto ci = A.ColumnIndicesBegin();
+
+		const size_t unassigned = std::numeric_limits<size_t>::max();
+		std::vector<size_t> rowColors(numRows, unassigned);
+		std::vector<size_t> lastUsedBy;
+
+		colors.clear();
+
+		for (size_t i = 0; i < numRows; ++i)
+		{
+			// Mark the colors used by the already colored neighbors
+			for (size_t jj = rp[i]; jj < rp[i + 1]; ++jj)
+			{
+				const size_t c = rowColors[ci[jj]];
+				if (c != unassigned)
+				{
+					lastUsedBy[c] = i;
+				}
+			}
+
+			size_t color = 0;
+			while (color < colors.size() && lastUsedBy[color] == i)
+			{
+				++color;
+			}
+
+			if (color == colors.size())
+			{
+				colors.emplace_back();
+				lastUsedBy.push_back(unassigned);
+			}
+
+			rowColors[i] = color;
+			colors[color].push_back(i);
+		}
 	}
 
 	void FDMBLAS3::Set(double s, FDMVector3* result)
@@ -187,47 +230,50 @@ namespace CubbyFlow
 
 	void FDMCompressedBLAS3::MVM(const MatrixCSRD& m, const VectorND& v, VectorND* result)
 	{
-		const auto rp = m.RowPointersBegin();
-		const auto ci = m.ColumnIndicesBegin();
-		const auto nnz = m.NonZeroBegin();
+		const size_t* rp = m.RowPointersData();
+		const size_t* ci = m.ColumnIndicesData();
+		const double* nnz = m.NonZeroData();
+		const double* vp = v.data();
+		double* rPtr = result->data();
 
-		v.ParallelForEachIndex([&](size_t i)
+		m.ParallelForEachRowBlock([&](size_t rowBegin, size_t rowEnd)
 		{
-			const size_t rowBegin = rp[i];
-			const size_t rowEnd = rp[i + 1];
+			for (size_t i = rowBegin; i < rowEnd; ++i)
+			{
+				double sum = 0.0;
 
-			double sum = 0.0;
+				for (size_t jj = rp[i]; jj < rp[i + 1]; ++jj)
+				{
+					sum += nnz[jj] * vp[ci[jj]];
+				}
 
-			for (size_t jj = rowBegin; jj < rowEnd; ++jj)
-			{
-				size_t j = ci[jj];
-				sum += nnz[jj] * v[j];
+				rPtr[i] = sum;
 			}
-
-			(*result)[i] = sum;
 		});
 	}
 
 	void FDMCompressedBLAS3::Residual(const MatrixCSRD& a, const VectorND& x, const VectorND& b, VectorND* result)
 	{
-		const auto rp = a.RowPointersBegin();
-		const auto ci = a.ColumnIndicesBegin();
-		const auto nnz = a.NonZeroBegin();
-
-		x.ParallelForEachIndex([&](size_t i)
+		const size_t* rp = a.RowPointersData();
+		const size_t* ci = a.ColumnIndicesData();
+		const double* nnz = a.NonZeroData();
+		const double* xp = x.data();
+		const double* bp = b.data();
+		double* rPtr = result->data();
+
+		a.ParallelForEachRowBlock([&](size_t rowBegin, size_t rowEnd)
 		{
-			const size_t rowBegin = rp[i];
-			const size_t rowEnd = rp[i + 1];
+			for (size_t i = rowBegin; i < rowEnd; ++i)
+			{
+				double sum = 0.0;
 
-			double sum = 0.0;
+				for (size_t jj = rp[i]; jj < rp[i + 1]; ++jj)
+				{
+					sum += nnz[jj] * xp[ci[jj]];
+				}
 
-			for (size_t jj = rowBegin; jj < rowEnd; ++jj)
-			{
-				size_t j = ci[jj];
-				sum += nnz[jj] * x[j];
+				rPtr[i] = bp[i] - sum;
 			}
-
-			(*result)[i] = b[i] - sum;
 		});
 	}
 
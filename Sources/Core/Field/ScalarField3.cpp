@@ -20,6 +20,19 @@ namespace CubbyFlow
 		// Do nothing
 	}
 
+	void ScalarField3::BatchSample(
+		const ConstArrayAccessor1<Vector3D>& x,
+		ArrayAccessor1<double> result,
+		ExecutionPolicy policy) const
+	{
+		assert(x.size() == result.size());
+
+		ParallelFor(ZERO_SIZE, x.size(), [&](size_t i)
+		{
+			result[i] = Sample(x[i]);
+		}, policy);
+	}
+
 	Vector3D ScalarField3::Gradient(const Vector3D&) const
 	{
 		return Vector3D(0, 0, 0);
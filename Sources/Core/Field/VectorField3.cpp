@@ -20,6 +20,19 @@ namespace CubbyFlow
 		// Do nothing
 	}
 
+	void VectorField3::BatchSample(
+		const ConstArrayAccessor1<Vector3D>& x,
+		ArrayAccessor1<Vector3D> result,
+		ExecutionPolicy policy) const
+	{
+		assert(x.size() == result.size());
+
+		ParallelFor(ZERO_SIZE, x.size(), [&](size_t i)
+		{
+			result[i] = Sample(x[i]);
+		}, policy);
+	}
+
 	double VectorField3::Divergence(const Vector3D&) const
 	{
 		return 0.0;
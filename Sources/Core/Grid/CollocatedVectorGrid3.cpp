@@ -121,6 +121,23 @@ namespace CubbyFlow
 		return result;
 	}
 
+	void CollocatedVectorGrid3::BatchSample(
+		const ConstArrayAccessor1<Vector3D>& x,
+		ArrayAccessor1<Vector3D> result,
+		ExecutionPolicy policy) const
+	{
+		assert(x.size() == result.size());
+
+		const LinearArraySampler3<Vector3D, double>& sampler = m_linearSampler;
+		ParallelRangeFor(ZERO_SIZE, x.size(), [&](size_t begin, size_t end)
+		{
+			for (size_t i = begin; i < end; ++i)
+			{
+				result[i] = sampler(x[i]);
+			}
+		}, policy);
+	}
+
 	std::function<Vector3D(const Vector3D&)> CollocatedVectorGrid3::Sampler() const
 	{
 		return m_sampler;
@@ -403,6 +403,80 @@ namespace CubbyFlow
 		return m_sampler(x);
 	}
 
+	void FaceCenteredGrid3::BatchSample(
+		const ConstArrayAccessor1<Vector3D>& x,
+		ArrayAccessor1<Vector3D> result,
+		ExecutionPolicy policy) const
+	{
+		assert(x.size() == result.size());
+
+		const Size3 res = Resolution();
+		if (res.x == 0 || res.y == 0 || res.z == 0)
+		{
+			return;
+		}
+
+		const Vector3D& h = GridSpacing();
+		const ssize_t iLast = static_cast<ssize_t>(res.x);
+		const ssize_t jLast = static_cast<ssize_t>(res.y);
+		const ssize_t kLast = static_cast<ssize_t>(res.z);
+		const double faceX = m_dataOriginU.x;
+		const double centerX = m_dataOriginV.x;
+		const double faceY = m_dataOriginV.y;
+		const double centerY = m_dataOriginU.y;
+		const double faceZ = m_dataOriginW.z;
+		const double centerZ = m_dataOriginU.z;
+
+		ParallelRangeFor(ZERO_SIZE, x.size(), [&](size_t begin, size_t end)
+		{
+			for (size_t n = begin; n < end; ++n)
+			{
+				const Vector3D& pt = x[n];
+
+				// Face-aligned (f) and cell-center-aligned (c) barycentric
+				// coordinates along each axis. u lives on x-faces, v on y-faces,
+				// and w on z-faces, so each component combines one face-aligned
+				// axis with two center-aligned axes.
+				ssize_t iF, iC, jF, jC, kF, kC;
+				double fxF, fxC, fyF, fyC, fzF, fzC;
+				GetBarycentric((pt.x - faceX) / h.x, 0, iLast, &iF, &fxF);
+				GetBarycentric((pt.x - centerX) / h.x, 0, iLast - 1, &iC, &fxC);
+				GetBarycentric((pt.y - faceY) / h.y, 0, jLast, &jF, &fyF);
+				GetBarycentric((pt.y - centerY) / h.y, 0, jLast - 1, &jC, &fyC);
+				GetBarycentric((pt.z - faceZ) / h.z, 0, kLast, &kF, &fzF);
+				GetBarycentric((pt.z - centerZ) / h.z, 0, kLast - 1, &kC, &fzC);
+
+				const ssize_t iFp1 = std::min(iF + 1, iLast);
+				const ssize_t iCp1 = std::min(iC + 1, iLast - 1);
+				const ssize_t jFp1 = std::min(jF + 1, jLast);
+				const ssize_t jCp1 = std::min(jC + 1, jLast - 1);
+				const ssize_t kFp1 = std::min(kF + 1, kLast);
+				const ssize_t kCp1 = std::min(kC + 1, kLast - 1);
+
+				const double u = TriLerp(
+					m_dataU(iF, jC, kC), m_dataU(iFp1, jC, kC),
+					m_dataU(iF, jCp1, kC), m_dataU(iFp1, jCp1, kC),
+					m_dataU(iF, jC, kCp1), m_dataU(iFp1, jC, kCp1),
+					m_dataU(iF, jCp1, kCp1), m_dataU(iFp1, jCp1, kCp1),
+					fxF, fyC, fzC);
+				const double v = TriLerp(
+					m_dataV(iC, jF, kC), m_dataV(iCp1, jF, kC),
+					m_dataV(iC, jFp1, kC), m_dataV(iCp1, jFp1, kC),
+					m_dataV(iC, jF, kCp1), m_dataV(iCp1, jF, kCp1),
+					m_dataV(iC, jFp1, kCp1), m_dataV(iCp1, jFp1, kCp1),
+					fxC, fyF, fzC);
+				const double w = TriLerp(
+					m_dataW(iC, jC, kF), m_dataW(iCp1, jC, kF),
+					m_dataW(iC, jCp1, kF), m_dataW(iCp1, jCp1, kF),
+					m_dataW(iC, jC, kFp1), m_dataW(iCp1, jC, kFp1),
+					m_dataW(iC, jCp1, kFp1), m_dataW(iCp1, jCp1, kFp1),
+					fxC, fyC, fzF);
+
+				result[n] = Vector3D(u, v, w);
+			}
+		}, policy);
+	}
+
 	std::function<Vector3D(const Vector3D&)> FaceCenteredGrid3::Sampler() const
 	{
 		return m_sampler;
@@ -86,6 +86,9 @@ namespace CubbyFlow
 		{
 			data->Resize(resolution, gridSpacing, origin);
 		}
+
+		m_advectableScalarBackBufferList.clear();
+		m_advectableVectorBackBufferList.clear();
 	}
 
 	Size2 GridSystemData2::GetResolution() const
@@ -166,6 +169,41 @@ namespace CubbyFlow
 		return m_advectableVectorDataList[idx];
 	}
 
+	FaceCenteredGrid2Ptr GridSystemData2::GetVelocityBackBuffer()
+	{
+		return std::dynamic_pointer_cast<FaceCenteredGrid2>(GetAdvectableVectorDataBackBufferAt(m_velocityIdx));
+	}
+
+	const ScalarGrid2Ptr& GridSystemData2::GetAdvectableScalarDataBackBufferAt(size_t idx)
+	{
+		m_advectableScalarBackBufferList.resize(m_advectableScalarDataList.size());
+
+		const ScalarGrid2Ptr& data = m_advectableScalarDataList[idx];
+		ScalarGrid2Ptr& backBuffer = m_advectableScalarBackBufferList[idx];
+
+		if (backBuffer == nullptr || !backBuffer->HasSameShape(*data))
+		{
+			backBuffer = data->Clone();
+		}
+
+		return backBuffer;
+	}
+
+	const VectorGrid2Ptr& GridSystemData2::GetAdvectableVectorDataBackBufferAt(size_t idx)
+	{
+		m_advectableVectorBackBufferList.resize(m_advectableVectorDataList.size());
+
+		const VectorGrid2Ptr& data = m_advectableVectorDataList[idx];
+		VectorGrid2Ptr& backBuffer = m_advectableVectorBackBufferList[idx];
+
+		if (backBuffer == nullptr || !backBuffer->HasSameShape(*data))
+		{
+			backBuffer = data->Clone();
+		}
+
+		return backBuffer;
+	}
+
 	size_t GridSystemData2::GetNumberOfScalarData() const
 	{
 		return m_scalarDataList.size();
@@ -233,6 +271,8 @@ namespace CubbyFlow
 		m_vectorDataList.clear();
 		m_advectableScalarDataList.clear();
 		m_advectableVectorDataList.clear();
+		m_advectableScalarBackBufferList.clear();
+		m_advectableVectorBackBufferList.clear();
 
 		DeserializeGrid(gsd->scalarData(), Factory::BuildScalarGrid2, &m_scalarDataList);
 		DeserializeGrid(gsd->vectorData(), Factory::BuildVectorGrid2, &m_vectorDataList);
@@ -86,6 +86,9 @@ namespace CubbyFlow
 		{
 			data->Resize(resolution, gridSpacing, origin);
 		}
+
+		m_advectableScalarBackBufferList.clear();
+		m_advectableVectorBackBufferList.clear();
 	}
 
 	Size3 GridSystemData3::GetResolution() const
@@ -166,6 +169,41 @@ namespace CubbyFlow
 		return m_advectableVectorDataList[idx];
 	}
 
+	FaceCenteredGrid3Ptr GridSystemData3::GetVelocityBackBuffer()
+	{
+		return std::dynamic_pointer_cast<FaceCenteredGrid3>(GetAdvectableVectorDataBackBufferAt(m_velocityIdx));
+	}
+
+	const ScalarGrid3Ptr& GridSystemData3::GetAdvectableScalarDataBackBufferAt(size_t idx)
+	{
+		m_advectableScalarBackBufferList.resize(m_advectableScalarDataList.size());
+
+		const ScalarGrid3Ptr& data = m_advectableScalarDataList[idx];
+		ScalarGrid3Ptr& backBuffer = m_advectableScalarBackBufferList[idx];
+
+		if (backBuffer == nullptr || !backBuffer->HasSameShape(*data))
+		{
+			backBuffer = data->Clone();
+		}
+
+		return backBuffer;
+	}
+
+	const VectorGrid3Ptr& GridSystemData3::GetAdvectableVectorDataBackBufferAt(size_t idx)
+	{
+		m_advectableVectorBackBufferList.resize(m_advectableVectorDataList.size());
+
+		const VectorGrid3Ptr& data = m_advectableVectorDataList[idx];
+		VectorGrid3Ptr& backBuffer = m_advectableVectorBackBufferList[idx];
+
+		if (backBuffer == nullptr || !backBuffer->HasSameShape(*data))
+		{
+			backBuffer = data->Clone();
+		}
+
+		return backBuffer;
+	}
+
 	size_t GridSystemData3::GetNumberOfScalarData() const
 	{
 		return m_scalarDataList.size();
@@ -233,6 +271,8 @@ namespace CubbyFlow
 		m_vectorDataList.clear();
 		m_advectableScalarDataList.clear();
 		m_advectableVectorDataList.clear();
+		m_advectableScalarBackBufferList.clear();
+		m_advectableVectorBackBufferList.clear();
 
 		DeserializeGrid(gsd->scalarData(), Factory::BuildScalarGrid3, &m_scalarDataList);
 		DeserializeGrid(gsd->vectorData(), Factory::BuildVectorGrid3, &m_vectorDataList);
@@ -95,6 +95,23 @@ namespace CubbyFlow
 		return m_sampler(x);
 	}
 
+	void ScalarGrid3::BatchSample(
+		const ConstArrayAccessor1<Vector3D>& x,
+		ArrayAccessor1<double> result,
+		ExecutionPolicy policy) const
+	{
+		assert(x.size() == result.size());
+
+		const LinearArraySampler3<double, double>& sampler = m_linearSampler;
+		ParallelRangeFor(ZERO_SIZE, x.size(), [&](size_t begin, size_t end)
+		{
+			for (size_t i = begin; i < end; ++i)
+			{
+				result[i] = sampler(x[i]);
+			}
+		}, policy);
+	}
+
 	std::function<double(const Vector3D&)> ScalarGrid3::Sampler() const
 	{
 		return m_sampler;
@@ -252,7 +252,8 @@ namespace CubbyFlow
 
 		auto points = GetPositions();
 
-		for (size_t i = 0; i < GetNumberOfParticles(); ++i)
+		// Each particle only writes its own list
+		ParallelFor(ZERO_SIZE, GetNumberOfParticles(), [&](size_t i)
 		{
 			Vector2D origin = points[i];
 			m_neighborLists[i].clear();
@@ -264,7 +265,7 @@ namespace CubbyFlow
 					m_neighborLists[i].push_back(j);
 				}
 			});
-		}
+		});
 
 		CUBBYFLOW_INFO << "Building neighbor list took: "
 			<< timer.DurationInSeconds()
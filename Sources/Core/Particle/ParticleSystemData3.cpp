@@ -6,6 +6,7 @@
 > Created Time: 2017/05/09
 > Copyright (c) 2018, Chan-Ho Chris Ohk
 *************************************************************************/
+#include <Core/Array/ArrayUtils.h>
 #include <Core/Particle/ParticleSystemData3.h>
 #include <Core/Searcher/PointNeighborSearcher3.h>
 #include <Core/Searcher/PointParallelHashGridSearcher3.h>
@@ -216,6 +217,82 @@ namespace CubbyFlow
 		}
 	}
 
+	size_t ParticleSystemData3::RemoveParticles(const ConstArrayAccessor1<char>& shouldRemove)
+	{
+		const size_t oldNumberOfParticles = GetNumberOfParticles();
+		if (shouldRemove.size() != oldNumberOfParticles)
+		{
+			throw std::invalid_argument("shouldRemove.size() != GetNumberOfParticles()");
+		}
+
+		Array1<size_t> newIndices;
+		const size_t newNumberOfParticles = ComputeCompactionIndices1(shouldRemove, oldNumberOfParticles, &newIndices);
+
+		if (newNumberOfParticles == oldNumberOfParticles)
+		{
+			return 0;
+		}
+
+		for (auto& attr : m_scalarDataList)
+		{
+			Compact1(shouldRemove, newIndices, newNumberOfParticles, &attr);
+		}
+
+		for (auto& attr : m_vectorDataList)
+		{
+			Compact1(shouldRemove, newIndices, newNumberOfParticles, &attr);
+		}
+
+		m_numberOfParticles = newNumberOfParticles;
+
+		// Neighbors that are removed are dropped from the lists
+		if (m_neighborLists.size() == oldNumberOfParticles)
+		{
+			std::vector<std::vector<size_t>> newNeighborLists(newNumberOfParticles);
+
+			ParallelFor(ZERO_SIZE, oldNumberOfParticles, [&](size_t i)
+			{
+				if (shouldRemove[i])
+				{
+					return;
+				}
+
+				std::vector<size_t>& neighbors = newNeighborLists[newIndices[i]];
+				neighbors.reserve(m_neighborLists[i].size());
+
+				for (size_t j : m_neighborLists[i])
+				{
+					if (!shouldRemove[j])
+					{
+						neighbors.push_back(newIndices[j]);
+					}
+				}
+			});
+
+			m_neighborLists.swap(newNeighborLists);
+		}
+		else
+		{
+			m_neighborLists.clear();
+		}
+
+		m_neighborSearcher->Build(GetPositions());
+
+		return oldNumberOfParticles - newNumberOfParticles;
+	}
+
+	size_t ParticleSystemData3::RemoveParticles(const std::function<bool(size_t)>& predicate)
+	{
+		Array1<char> shouldRemove(GetNumberOfParticles());
+
+		ParallelFor(ZERO_SIZE, shouldRemove.size(), [&](size_t i)
+		{
+			shouldRemove[i] = predicate(i) ? 1 : 0;
+		});
+
+		return RemoveParticles(shouldRemove.ConstAccessor());
+	}
+
 	const PointNeighborSearcher3Ptr& ParticleSystemData3::GetNeighborSearcher() const
 	{
 		return m_neighborSearcher;
@@ -257,7 +334,8 @@ namespace CubbyFlow
 
 		auto points = GetPositions();
 
-		for (size_t i = 0; i < GetNumberOfParticles(); ++i)
+		// Each particle only writes its own list
+		ParallelFor(ZERO_SIZE, GetNumberOfParticles(), [&](size_t i)
 		{
 			Vector3D origin = points[i];
 			m_neighborLists[i].clear();
@@ -269,7 +347,7 @@ namespace CubbyFlow
 					m_neighborLists[i].push_back(j);
 				}
 			});
-		}
+		});
 
 		CUBBYFLOW_INFO << "Building neighbor list took: "
 			<< timer.DurationInSeconds()
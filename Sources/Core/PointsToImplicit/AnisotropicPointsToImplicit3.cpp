@@ -151,30 +151,30 @@ namespace CubbyFlow
 
 				cov /= wSum;
 
-				// SVD
-				Matrix3x3D u;
+				// Eigendecomposition of the symmetric covariance matrix into
+				// the eigenvalues v and the eigenvectors in the columns of w
 				Vector3D v;
 				Matrix3x3D w;
-				SVD(cov, u, v, w);
+				SymmetricEigenDecomposition(cov, v, w);
 
-				// Take off the sign
+				// Round-off can leave small negative eigenvalues
 				v.x = std::fabs(v.x);
 				v.y = std::fabs(v.y);
 				v.z = std::fabs(v.z);
 
 				// Constrain Sigma
-				const double maxSingularVal = v.Max();
+				const double maxEigenvalue = v.Max();
 				const double kr = 4.0;
-				v.x = std::max(v.x, maxSingularVal / kr);
-				v.y = std::max(v.y, maxSingularVal / kr);
-				v.z = std::max(v.z, maxSingularVal / kr);
+				v.x = std::max(v.x, maxEigenvalue / kr);
+				v.y = std::max(v.y, maxEigenvalue / kr);
+				v.z = std::max(v.z, maxEigenvalue / kr);
 
 				const auto invSigma = Matrix3x3D::MakeScaleMatrix(1.0 / v);
 
 				// Compute G
 				// Volume preservation
 				const double scale = std::pow(v.x * v.y * v.z, 1.0 / 3.0);
-				const Matrix3x3D g = invH * scale * (w * invSigma * u.Transposed());
+				const Matrix3x3D g = invH * scale * (w * invSigma * w.Transposed());
 				gs[i] = g;
 			}
 		});
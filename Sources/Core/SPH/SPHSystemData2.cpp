@@ -79,6 +79,31 @@ namespace CubbyFlow
 		auto d = GetDensities();
 		const double m = GetMass();
 
+		// The searcher is stale between the rebuilds of skinned lists
+		if (m_neighborListSkin > 0.0 && GetNeighborLists().size() == GetNumberOfParticles())
+		{
+			const auto& neighborLists = GetNeighborLists();
+			SPHStdKernel2 kernel(m_kernelRadius);
+
+			ParallelFor(ZERO_SIZE, GetNumberOfParticles(), [&](size_t i)
+			{
+				double sum = kernel(0.0);
+
+				for (size_t j : neighborLists[i])
+				{
+					double dist = p[i].DistanceTo(p[j]);
+					if (dist < m_kernelRadius)
+					{
+						sum += kernel(dist);
+					}
+				}
+
+				d[i] = m * sum;
+			});
+
+			return;
+		}
+
 		ParallelFor(ZERO_SIZE, GetNumberOfParticles(), [&](size_t i)
 		{
 			double sum = SumOfKernelNearby(p[i]);
@@ -260,11 +285,70 @@ namespace CubbyFlow
 	void SPHSystemData2::BuildNeighborSearcher()
 	{
 		ParticleSystemData2::BuildNeighborSearcher(m_kernelRadius);
+		m_neighborListRadius = 0.0;
 	}
 
 	void SPHSystemData2::BuildNeighborLists()
 	{
 		ParticleSystemData2::BuildNeighborLists(m_kernelRadius);
+		m_neighborListRadius = 0.0;
+	}
+
+	double SPHSystemData2::GetNeighborListSkin() const
+	{
+		return m_neighborListSkin;
+	}
+
+	void SPHSystemData2::SetNeighborListSkin(double skin)
+	{
+		m_neighborListSkin = std::max(skin, 0.0);
+	}
+
+	bool SPHSystemData2::UpdateNeighborLists()
+	{
+		const size_t numberOfParticles = GetNumberOfParticles();
+		const double searchRadius = (1.0 + m_neighborListSkin) * m_kernelRadius;
+		auto p = GetPositions();
+
+		if (m_neighborListSkin > 0.0 &&
+			m_neighborListRadius == searchRadius &&
+			m_neighborListPositions.size() == numberOfParticles &&
+			GetNeighborLists().size() == numberOfParticles)
+		{
+			const double& (*_max)(const double&, const double&) = std::max<double>;
+
+			const double maxDisplacementSquared = ParallelReduce(ZERO_SIZE, numberOfParticles, 0.0,
+				[&](size_t begin, size_t end, double init)
+			{
+				double result = init;
+
+				for (size_t i = begin; i < end; ++i)
+				{
+					result = std::max(result, p[i].DistanceSquaredTo(m_neighborListPositions[i]));
+				}
+
+				return result;
+			}, _max);
+
+			// No pair can have entered the kernel radius from outside the
+			// search radius while every particle moved less than half the skin
+			if (maxDisplacementSquared < Square(0.5 * m_neighborListSkin * m_kernelRadius))
+			{
+				return false;
+			}
+		}
+
+		ParticleSystemData2::BuildNeighborSearcher(searchRadius);
+		ParticleSystemData2::BuildNeighborLists(searchRadius);
+
+		m_neighborListRadius = searchRadius;
+		m_neighborListPositions.Resize(numberOfParticles);
+		ParallelFor(ZERO_SIZE, numberOfParticles, [&](size_t i)
+		{
+			m_neighborListPositions[i] = p[i];
+		});
+
+		return true;
 	}
 
 	void SPHSystemData2::ComputeMass()
@@ -341,6 +425,7 @@ namespace CubbyFlow
 		m_kernelRadius = fbsSPHSystemData->kernelRadius();
 		m_pressureIdx = static_cast<size_t>(fbsSPHSystemData->pressureIdx());
 		m_densityIdx = static_cast<size_t>(fbsSPHSystemData->densityIdx());
+		m_neighborListRadius = 0.0;
 	}
 
 	void SPHSystemData2::Set(const SPHSystemData2& other)
@@ -353,6 +438,8 @@ namespace CubbyFlow
 		m_kernelRadius = other.m_kernelRadius;
 		m_densityIdx = other.m_densityIdx;
 		m_pressureIdx = other.m_pressureIdx;
+		m_neighborListSkin = other.m_neighborListSkin;
+		m_neighborListRadius = 0.0;
 	}
 
 	SPHSystemData2& SPHSystemData2::operator=(const SPHSystemData2& other)
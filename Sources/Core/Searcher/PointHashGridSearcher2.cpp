@@ -8,6 +8,7 @@
 *************************************************************************/
 #include <Core/Searcher/PointHashGridSearcher2.h>
 #include <Core/Utils/FlatbuffersHelper.h>
+#include <Core/Utils/Parallel.h>
 
 #include <Flatbuffers/generated/PointHashGridSearcher2_generated.h>
 
@@ -33,25 +34,33 @@ namespace CubbyFlow
 
 	void PointHashGridSearcher2::Build(const ConstArrayAccessor1<Vector2D>& points)
 	{
-		m_buckets.clear();
 		m_points.clear();
+		m_sortedIndices.clear();
+		m_bucketStarts.clear();
+		m_addedHeads.clear();
+		m_addedNexts.clear();
 
 		// Allocate memory chunks
-		m_buckets.resize(m_resolution.x * m_resolution.y);
-		m_points.resize(points.size());
-
-		if (m_points.size() == 0)
+		const size_t numberOfBuckets = static_cast<size_t>(m_resolution.x * m_resolution.y);
+		const size_t numberOfPoints = points.size();
+		std::vector<size_t> keys(numberOfPoints);
+		m_bucketStarts.resize(numberOfBuckets + 1);
+		m_sortedIndices.resize(numberOfPoints);
+		m_points.resize(numberOfPoints);
+
+		ParallelFor(ZERO_SIZE, numberOfPoints, [&](size_t i)
 		{
-			return;
-		}
+			keys[i] = GetHashKeyFromPosition(points[i]);
+		});
 
-		// Put points into buckets
-		for (size_t i = 0; i < points.size(); ++i)
+		// Group the point indices by bucket
+		ParallelCountingSort(keys.begin(), keys.end(), numberOfBuckets, m_bucketStarts.begin(), m_sortedIndices.begin());
+
+		// Store the points of each bucket contiguously
+		ParallelFor(ZERO_SIZE, numberOfPoints, [&](size_t i)
 		{
-			m_points[i] = points[i];
-			size_t key = GetHashKeyFromPosition(points[i]);
-			m_buckets[key].push_back(i);
-		}
+			m_points[i] = points[m_sortedIndices[i]];
+		});
 	}
 
 	void PointHashGridSearcher2::ForEachNearbyPoint(
@@ -59,7 +68,7 @@ namespace CubbyFlow
 		double radius,
 		const ForEachNearbyPointFunc& callback) const
 	{
-		if (m_buckets.empty())
+		if (m_bucketStarts.empty())
 		{
 			return;
 		}
@@ -68,27 +77,41 @@ namespace CubbyFlow
 		GetNearbyKeys(origin, nearByKeys);
 
 		const double queryRadiusSquared = radius * radius;
+		const size_t numberOfSortedPoints = m_bucketStarts.back();
 
 		for (size_t i = 0; i < 4; ++i)
 		{
-			const auto& bucket = m_buckets[nearByKeys[i]];
-			size_t numberOfPointsInBucket = bucket.size();
+			const size_t key = nearByKeys[i];
+
+			for (size_t j = m_bucketStarts[key]; j < m_bucketStarts[key + 1]; ++j)
+			{
+				double rSquared = (m_points[j] - origin).LengthSquared();
+				if (rSquared <= queryRadiusSquared)
+				{
+					callback(m_sortedIndices[j], m_points[j]);
+				}
+			}
+
+			if (m_addedHeads.empty())
+			{
+				continue;
+			}
 
-			for (size_t j = 0; j < numberOfPointsInBucket; ++j)
+			for (size_t j = m_addedHeads[key]; j != std::numeric_limits<size_t>::max();
+				j = m_addedNexts[j - numberOfSortedPoints])
 			{
-				size_t pointIndex = bucket[j];
-				double rSquared = (m_points[pointIndex] - origin).LengthSquared();
+				double rSquared = (m_points[j] - origin).LengthSquared();
 				if (rSquared <= queryRadiusSquared)
 				{
-					callback(pointIndex, m_points[pointIndex]);
+					callback(m_sortedIndices[j], m_points[j]);
 				}
 			}
 		}
 	}
 
-	bool PointHashGridSearcher2::HasNearbyPoint(const Vector2D& origin, double radius) const
+	bool PointHashGridSearcher2::HasNearbyPoint(const Vector2D&  origin, double radius) const
 	{
-		if (m_buckets.empty())
+		if (m_bucketStarts.empty())
 		{
 			return false;
 		}
@@ -97,16 +120,30 @@ namespace CubbyFlow
 		GetNearbyKeys(origin, nearbyKeys);
 
 		const double queryRadiusSquared = radius * radius;
-		
+		const size_t numberOfSortedPoints = m_bucketStarts.back();
+
 		for (size_t i = 0; i < 4; ++i)
 		{
-			const auto& bucket = m_buckets[nearbyKeys[i]];
-			size_t numberOfPointsInBucket = bucket.size();
+			const size_t key = nearbyKeys[i];
+
+			for (size_t j = m_bucketStarts[key]; j < m_bucketStarts[key + 1]; ++j)
+			{
+				double rSquared = (m_points[j] - origin).LengthSquared();
+				if (rSquared <= queryRadiusSquared)
+				{
+					return true;
+				}
+			}
+
+			if (m_addedHeads.empty())
+			{
+				continue;
+			}
 
-			for (size_t j = 0; j < numberOfPointsInBucket; ++j)
+			for (size_t j = m_addedHeads[key]; j != std::numeric_limits<size_t>::max();
+				j = m_addedNexts[j - numberOfSortedPoints])
 			{
-				size_t pointIndex = bucket[j];
-				double rSquared = (m_points[pointIndex] - origin).LengthSquared();
+				double rSquared = (m_points[j] - origin).LengthSquared();
 				if (rSquared <= queryRadiusSquared)
 				{
 					return true;
@@ -119,23 +156,53 @@ namespace CubbyFlow
 
 	void PointHashGridSearcher2::Add(const Vector2D& point)
 	{
-		if (m_buckets.empty())
+		if (m_bucketStarts.empty())
 		{
 			Array1<Vector2D> arr = { point };
 			Build(arr);
 		}
 		else
 		{
+			// Chain the point to the head of its bucket
+			if (m_addedHeads.empty())
+			{
+				m_addedHeads.resize(m_bucketStarts.size() - 1, std::numeric_limits<size_t>::max());
+			}
+
 			size_t i = m_points.size();
-			m_points.push_back(point);
 			size_t key = GetHashKeyFromPosition(point);
-			m_buckets[key].push_back(i);
+			m_points.push_back(point);
+			m_sortedIndices.push_back(i);
+			m_addedNexts.push_back(m_addedHeads[key]);
+			m_addedHeads[key] = i;
+		}
+	}
+
+	std::vector<std::vector<size_t>> PointHashGridSearcher2::GetBuckets() const
+	{
+		if (m_bucketStarts.empty())
+		{
+			return std::vector<std::vector<size_t>>();
+		}
+
+		std::vector<std::vector<size_t>> buckets(m_bucketStarts.size() - 1);
+
+		for (size_t key = 0; key < buckets.size(); ++key)
+		{
+			GetBucket(key, &buckets[key]);
 		}
+
+		return buckets;
+	}
+
+	const std::vector<size_t>& PointHashGridSearcher2::GetBucketStarts() const
+	{
+		return m_bucketStarts;
 	}
 
-	const std::vector<std::vector<size_t>>& PointHashGridSearcher2::GetBuckets() const
+	const std::vector<size_t>& PointHashGridSearcher2::GetSortedIndices() const
 	{
-		return m_buckets;
+		return m_sortedIndices;
 	}
 
 	size_t PointHashGridSearcher2::GetHashKeyFromBucketIndex(const Point2I& bucketIndex) const
@@ -186,7 +253,10 @@ namespace CubbyFlow
 		m_resolution = other.m_resolution;
 		m_gridSpacing = other.m_gridSpacing;
 		m_points = other.m_points;
-		m_buckets = other.m_buckets;
+		m_sortedIndices = other.m_sortedIndices;
+		m_bucketStarts = other.m_bucketStarts;
+		m_addedHeads = other.m_addedHeads;
+		m_addedNexts = other.m_addedNexts;
 	}
 
 	void PointHashGridSearcher2::Serialize(std::vector<uint8_t>* buffer) const
@@ -196,19 +266,25 @@ namespace CubbyFlow
 		// Copy simple data
 		auto fbsResolution = fbs::Size2(m_resolution.x, m_resolution.y);
 
-		// Copy points
-		std::vector<fbs::Vector2D> points;
-		for (const auto& pt : m_points)
+		// Copy points in their original order
+		std::vector<fbs::Vector2D> points(m_points.size());
+		for (size_t i = 0; i < m_points.size(); ++i)
 		{
-			points.push_back(CubbyFlowToFlatbuffers(pt));
+			points[m_sortedIndices[i]] = CubbyFlowToFlatbuffers(m_points[i]);
 		}
 
 		auto fbsPoints = builder.CreateVectorOfStructs(points.data(), points.size());
 
 		// Copy buckets
+		const size_t numberOfBuckets = m_bucketStarts.empty() ? 0 : m_bucketStarts.size() - 1;
 		std::vector<flatbuffers::Offset<fbs::PointHashGridSearcherBucket2>> buckets;
-		for (const auto& bucket : m_buckets)
+		buckets.reserve(numberOfBuckets);
+
+		std::vector<size_t> bucket;
+		for (size_t key = 0; key < numberOfBuckets; ++key)
 		{
+			GetBucket(key, &bucket);
+
 			std::vector<uint64_t> bucket64(bucket.begin(), bucket.end());
 			flatbuffers::Offset<fbs::PointHashGridSearcherBucket2> fbsBucket
 				= fbs::CreatePointHashGridSearcherBucket2(
@@ -241,30 +317,15 @@ namespace CubbyFlow
 		m_resolution.Set({ res.x, res.y });
 		m_gridSpacing = fbsSearcher->gridSpacing();
 
-		// Copy points
+		// Copy points and rebuild the buckets from them
 		auto fbsPoints = fbsSearcher->points();
-		m_points.resize(fbsPoints->size());
+		Array1<Vector2D> points(fbsPoints->size());
 		for (uint32_t i = 0; i < fbsPoints->size(); ++i)
 		{
-			m_points[i] = FlatbuffersToCubbyFlow(*fbsPoints->Get(i));
+			points[i] = FlatbuffersToCubbyFlow(*fbsPoints->Get(i));
 		}
 
-		// Copy buckets
-		auto fbsBuckets = fbsSearcher->buckets();
-		m_buckets.resize(fbsBuckets->size());		
-		for (uint32_t i = 0; i < fbsBuckets->size(); ++i)
-		{
-			auto fbsBucket = fbsBuckets->Get(i);
-			m_buckets[i].resize(fbsBucket->data()->size());			
-			std::transform(
-				fbsBucket->data()->begin(),
-				fbsBucket->data()->end(),
-				m_buckets[i].begin(),
-				[](uint64_t val)
-			{
-				return static_cast<size_t>(val);
-			});
-		}
+		Build(points);
 	}
 
 	PointHashGridSearcher2::Builder PointHashGridSearcher2::GetBuilder()
@@ -278,6 +339,27 @@ namespace CubbyFlow
 		return GetHashKeyFromBucketIndex(bucketIndex);
 	}
 
+	void PointHashGridSearcher2::GetBucket(size_t key, std::vector<size_t>* bucket) const
+	{
+		bucket->assign(m_sortedIndices.begin() + m_bucketStarts[key], m_sortedIndices.begin() + m_bucketStarts[key + 1]);
+
+		if (m_addedHeads.empty())
+		{
+			return;
+		}
+
+		// Added points are chained in reverse order
+		const size_t numberOfSortedPoints = m_bucketStarts.back();
+		const size_t numberOfBuiltPoints = bucket->size();
+		for (size_t j = m_addedHeads[key]; j != std::numeric_limits<size_t>::max();
+			j = m_addedNexts[j - numberOfSortedPoints])
+		{
+			bucket->push_back(m_sortedIndices[j]);
+		}
+
+		std::reverse(bucket->begin() + numberOfBuiltPoints, bucket->end());
+	}
+
 	void PointHashGridSearcher2::GetNearbyKeys(const Vector2D& position, size_t* nearbyKeys) const
 	{
 		Point2I originIndex = GetBucketIndex(position), nearbyBucketIndices[4];
@@ -48,9 +48,10 @@ namespace CubbyFlow
 
 		// Allocate memory chunks
 		size_t numberOfPoints = points.size();
+		size_t numberOfBuckets = static_cast<size_t>(m_resolution.x * m_resolution.y);
 		std::vector<size_t> tempKeys(numberOfPoints);
-		m_startIndexTable.resize(m_resolution.x * m_resolution.y);
-		m_endIndexTable.resize(m_resolution.x * m_resolution.y);
+		m_startIndexTable.resize(numberOfBuckets);
+		m_endIndexTable.resize(numberOfBuckets);
 		ParallelFill(m_startIndexTable.begin(), m_startIndexTable.end(), std::numeric_limits<size_t>::max());
 		ParallelFill(m_endIndexTable.begin(), m_endIndexTable.end(), std::numeric_limits<size_t>::max());
 		m_keys.resize(numberOfPoints);
@@ -62,19 +63,16 @@ namespace CubbyFlow
 			return;
 		}
 
-		// Initialize indices array and generate hash key for each point
+		// Generate hash key for each point
 		ParallelFor(ZERO_SIZE, numberOfPoints, [&](size_t i)
 		{
-			m_sortedIndices[i] = i;
-			m_points[i] = points[i];
 			tempKeys[i] = GetHashKeyFromPosition(points[i]);
 		});
 
-		// Sort indices based on hash key
-		ParallelSort(m_sortedIndices.begin(), m_sortedIndices.end(), [&tempKeys](size_t indexA, size_t indexB)
-		{
-			return tempKeys[indexA] < tempKeys[indexB];
-		});
+		// Sort indices based on hash key. The counting sort also gives the
+		// start index of each bucket in the sorted list.
+		std::vector<size_t> bucketStarts(numberOfBuckets + 1);
+		ParallelCountingSort(tempKeys.begin(), tempKeys.end(), numberOfBuckets, bucketStarts.begin(), m_sortedIndices.begin());
 
 		// Re-order point and key arrays
 		ParallelFor(ZERO_SIZE, numberOfPoints, [&](size_t i)
@@ -84,7 +82,7 @@ namespace CubbyFlow
 		});
 
 		// Now m_points and m_keys are sorted by points' hash key values.
-		// Let's fill in start/end index table with m_keys.
+		// Let's fill in start/end index table with the bucket starts.
 
 		// Assume that m_keys array looks like:
 		// [5|8|8|10|10|10]
@@ -95,15 +93,12 @@ namespace CubbyFlow
 		// So that m_endIndexTable[i] - m_startIndexTable[i] is the number points
 		// in i-th table bucket.
 
-		m_startIndexTable[m_keys[0]] = 0;
-		m_endIndexTable[m_keys[numberOfPoints - 1]] = numberOfPoints;
-
-		ParallelFor(static_cast<size_t>(1), numberOfPoints, [&](size_t i)
+		ParallelFor(ZERO_SIZE, numberOfBuckets, [&](size_t key)
 		{
-			if (m_keys[i] > m_keys[i - 1])
+			if (bucketStarts[key] < bucketStarts[key + 1])
 			{
-				m_startIndexTable[m_keys[i]] = i;
-				m_endIndexTable[m_keys[i - 1]] = i;
+				m_startIndexTable[key] = bucketStarts[key];
+				m_endIndexTable[key] = bucketStarts[key + 1];
 			}
 		});
 
@@ -31,6 +31,7 @@ namespace CubbyFlow
 		double h = std::min(output->GridSpacing().x, output->GridSpacing().y);
 
 		auto inputDataPos = input.GetDataPosition();
+		auto inputDataAcc = input.GetConstDataAccessor();
 		auto outputDataPos = output->GetDataPosition();
 		auto outputDataAcc = output->GetDataAccessor();
 		
@@ -41,6 +42,10 @@ namespace CubbyFlow
 				Vector2D pt = BackTrace(flow, dt, h, outputDataPos(i, j), boundarySDF);
 				outputDataAcc(i, j) = inputSamplerFunc(pt);
 			}
+			else
+			{
+				outputDataAcc(i, j) = inputDataAcc(i, j);
+			}
 		});
 	}
 
@@ -55,6 +60,7 @@ namespace CubbyFlow
 		double h = std::min(output->GridSpacing().x, output->GridSpacing().y);
 
 		auto inputDataPos = input.GetDataPosition();
+		auto inputDataAcc = input.GetConstDataAccessor();
 		auto outputDataPos = output->GetDataPosition();
 		auto outputDataAcc = output->GetDataAccessor();
 
@@ -65,6 +71,10 @@ namespace CubbyFlow
 				Vector2D pt = BackTrace(flow, dt, h, outputDataPos(i, j), boundarySDF);
 				outputDataAcc(i, j) = inputSamplerFunc(pt);
 			}
+			else
+			{
+				outputDataAcc(i, j) = inputDataAcc(i, j);
+			}
 		});
 	}
 
@@ -79,6 +89,7 @@ namespace CubbyFlow
 		double h = std::min(output->GridSpacing().x, output->GridSpacing().y);
 
 		auto uSourceDataPos = input.GetUPosition();
+		auto uSourceDataAcc = input.GetUConstAccessor();
 		auto uTargetDataPos = output->GetUPosition();
 		auto uTargetDataAcc = output->GetUAccessor();
 
@@ -89,9 +100,14 @@ namespace CubbyFlow
 				Vector2D pt = BackTrace(flow, dt, h, uTargetDataPos(i, j), boundarySDF);
 				uTargetDataAcc(i, j) = inputSamplerFunc(pt).x;
 			}
+			else
+			{
+				uTargetDataAcc(i, j) = uSourceDataAcc(i, j);
+			}
 		});
 
 		auto vSourceDataPos = input.GetVPosition();
+		auto vSourceDataAcc = input.GetVConstAccessor();
 		auto vTargetDataPos = output->GetVPosition();
 		auto vTargetDataAcc = output->GetVAccessor();
 
@@ -102,6 +118,10 @@ namespace CubbyFlow
 				Vector2D pt = BackTrace(flow, dt, h, vTargetDataPos(i, j), boundarySDF);
 				vTargetDataAcc(i, j) = inputSamplerFunc(pt).y;
 			}
+			else
+			{
+				vTargetDataAcc(i, j) = vSourceDataAcc(i, j);
+			}
 		});
 	}
 
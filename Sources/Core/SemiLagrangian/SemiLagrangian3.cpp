@@ -7,9 +7,56 @@
 > Copyright (c) 2018, Chan-Ho Chris Ohk
 *************************************************************************/
 #include <Core/SemiLagrangian/SemiLagrangian3.h>
+#include <Core/Utils/Constants.h>
+#include <Core/Utils/Parallel.h>
+
+#include <algorithm>
 
 namespace CubbyFlow
 {
+	namespace
+	{
+		// Returns true if the two grids have their data points at the same
+		// positions, so that they can share the departure points
+		template <typename GridType>
+		bool HasSameDataLayout(const GridType& a, const GridType& b)
+		{
+			return a.GetDataSize() == b.GetDataSize() &&
+				a.GetDataOrigin() == b.GetDataOrigin() &&
+				a.GridSpacing() == b.GridSpacing();
+		}
+
+		// Splits the fields into groups of the same input and output data
+		// layouts and returns the field indices of each group
+		template <typename InputType, typename OutputType>
+		std::vector<std::vector<size_t>> GroupByDataLayout(
+			const std::vector<const InputType*>& inputs,
+			const std::vector<OutputType*>& outputs)
+		{
+			std::vector<std::vector<size_t>> groups;
+
+			for (size_t n = 0; n < inputs.size(); ++n)
+			{
+				auto iter = std::find_if(groups.begin(), groups.end(), [&](const std::vector<size_t>& group)
+				{
+					return HasSameDataLayout(*inputs[group[0]], *inputs[n]) &&
+						HasSameDataLayout(*outputs[group[0]], *outputs[n]);
+				});
+
+				if (iter != groups.end())
+				{
+					iter->push_back(n);
+				}
+				else
+				{
+					groups.push_back({ n });
+				}
+			}
+
+			return groups;
+		}
+	}
+
 	SemiLagrangian3::SemiLagrangian3()
 	{
 		// Do nothing
@@ -31,6 +78,7 @@ namespace CubbyFlow
 		double h = std::min(output->GridSpacing().x, output->GridSpacing().y);
 
 		auto inputDataPos = input.GetDataPosition();
+		auto inputDataAcc = input.GetConstDataAccessor();
 		auto outputDataPos = output->GetDataPosition();
 		auto outputDataAcc = output->GetDataAccessor();
 
@@ -41,6 +89,40 @@ namespace CubbyFlow
 				Vector3D pt = BackTrace(flow, dt, h, outputDataPos(i, j, k), boundarySDF);
 				outputDataAcc(i, j, k) = inputSamplerFunc(pt);
 			}
+			else
+			{
+				outputDataAcc(i, j, k) = inputDataAcc(i, j, k);
+			}
+		});
+	}
+
+	void SemiLagrangian3::Advect(
+		const ScalarGrid3& input,
+		const VectorField3& flow,
+		double dt,
+		const ConstArrayAccessor1<Point3UI>& dataPoints,
+		ArrayAccessor1<double> output,
+		const ScalarField3& boundarySDF)
+	{
+		auto inputSamplerFunc = GetScalarSamplerFunc(input);
+		double h = std::min(input.GridSpacing().x, input.GridSpacing().y);
+
+		auto inputDataPos = input.GetDataPosition();
+		auto inputDataAcc = input.GetConstDataAccessor();
+
+		ParallelFor(ZERO_SIZE, dataPoints.size(), [&](size_t n)
+		{
+			const Point3UI& pt = dataPoints[n];
+			const Vector3D pos = inputDataPos(pt.x, pt.y, pt.z);
+
+			if (boundarySDF.Sample(pos) > 0.0)
+			{
+				output[n] = inputSamplerFunc(BackTrace(flow, dt, h, pos, boundarySDF));
+			}
+			else
+			{
+				output[n] = inputDataAcc(pt);
+			}
 		});
 	}
 
@@ -55,6 +137,7 @@ namespace CubbyFlow
 		double h = std::min(output->GridSpacing().x, output->GridSpacing().y);
 
 		auto inputDataPos = input.GetDataPosition();
+		auto inputDataAcc = input.GetConstDataAccessor();
 		auto outputDataPos = output->GetDataPosition();
 		auto outputDataAcc = output->GetDataAccessor();
 
@@ -65,6 +148,10 @@ namespace CubbyFlow
 				Vector3D pt = BackTrace(flow, dt, h, outputDataPos(i, j, k), boundarySDF);
 				outputDataAcc(i, j, k) = inputSamplerFunc(pt);
 			}
+			else
+			{
+				outputDataAcc(i, j, k) = inputDataAcc(i, j, k);
+			}
 		});
 	}
 
@@ -79,6 +166,7 @@ namespace CubbyFlow
 		double h = std::min(output->GridSpacing().x, output->GridSpacing().y);
 
 		auto uSourceDataPos = input.GetUPosition();
+		auto uSourceDataAcc = input.GetUConstAccessor();
 		auto uTargetDataPos = output->GetUPosition();
 		auto uTargetDataAcc = output->GetUAccessor();
 
@@ -89,9 +177,14 @@ namespace CubbyFlow
 				Vector3D pt = BackTrace(flow, dt, h, uTargetDataPos(i, j, k), boundarySDF);
 				uTargetDataAcc(i, j, k) = inputSamplerFunc(pt).x;
 			}
+			else
+			{
+				uTargetDataAcc(i, j, k) = uSourceDataAcc(i, j, k);
+			}
 		});
 
 		auto vSourceDataPos = input.GetVPosition();
+		auto vSourceDataAcc = input.GetVConstAccessor();
 		auto vTargetDataPos = output->GetVPosition();
 		auto vTargetDataAcc = output->GetVAccessor();
 
@@ -102,11 +195,16 @@ namespace CubbyFlow
 				Vector3D pt = BackTrace(flow, dt, h, vTargetDataPos(i, j, k), boundarySDF);
 				vTargetDataAcc(i, j, k) = inputSamplerFunc(pt).y;
 			}
+			else
+			{
+				vTargetDataAcc(i, j, k) = vSourceDataAcc(i, j, k);
+			}
 		});
 
 		auto wTargetDataPos = output->GetWPosition();
 		auto wTargetDataAcc = output->GetWAccessor();
 		auto wSourceDataPos = input.GetWPosition();
+		auto wSourceDataAcc = input.GetWConstAccessor();
 
 		output->ParallelForEachWIndex([&](size_t i, size_t j, size_t k)
 		{
@@ -115,9 +213,113 @@ namespace CubbyFlow
 				Vector3D pt = BackTrace(flow, dt, h, wTargetDataPos(i, j, k), boundarySDF);
 				wTargetDataAcc(i, j, k) = inputSamplerFunc(pt).z;
 			}
+			else
+			{
+				wTargetDataAcc(i, j, k) = wSourceDataAcc(i, j, k);
+			}
 		});
 	}
 
+	void SemiLagrangian3::Advect(
+		const std::vector<const ScalarGrid3*>& inputs,
+		const VectorField3& flow,
+		double dt,
+		const std::vector<ScalarGrid3*>& outputs,
+		const ScalarField3& boundarySDF)
+	{
+		for (const auto& group : GroupByDataLayout(inputs, outputs))
+		{
+			std::vector<std::function<double(const Vector3D&)>> inputSamplerFuncs;
+			std::vector<ScalarGrid3::ConstScalarDataAccessor> inputDataAccs;
+			std::vector<ScalarGrid3::ScalarDataAccessor> outputDataAccs;
+
+			for (size_t n : group)
+			{
+				inputSamplerFuncs.push_back(GetScalarSamplerFunc(*inputs[n]));
+				inputDataAccs.push_back(inputs[n]->GetConstDataAccessor());
+				outputDataAccs.push_back(outputs[n]->GetDataAccessor());
+			}
+
+			const ScalarGrid3& input = *inputs[group[0]];
+			ScalarGrid3* output = outputs[group[0]];
+			double h = std::min(output->GridSpacing().x, output->GridSpacing().y);
+
+			auto inputDataPos = input.GetDataPosition();
+			auto outputDataPos = output->GetDataPosition();
+			const size_t numFields = group.size();
+
+			output->ParallelForEachDataPointIndex([&](size_t i, size_t j, size_t k)
+			{
+				if (boundarySDF.Sample(inputDataPos(i, j, k)) > 0.0)
+				{
+					Vector3D pt = BackTrace(flow, dt, h, outputDataPos(i, j, k), boundarySDF);
+
+					for (size_t n = 0; n < numFields; ++n)
+					{
+						outputDataAccs[n](i, j, k) = inputSamplerFuncs[n](pt);
+					}
+				}
+				else
+				{
+					for (size_t n = 0; n < numFields; ++n)
+					{
+						outputDataAccs[n](i, j, k) = inputDataAccs[n](i, j, k);
+					}
+				}
+			});
+		}
+	}
+
+	void SemiLagrangian3::Advect(
+		const std::vector<const CollocatedVectorGrid3*>& inputs,
+		const VectorField3& flow,
+		double dt,
+		const std::vector<CollocatedVectorGrid3*>& outputs,
+		const ScalarField3& boundarySDF)
+	{
+		for (const auto& group : GroupByDataLayout(inputs, outputs))
+		{
+			std::vector<std::function<Vector3D(const Vector3D&)>> inputSamplerFuncs;
+			std::vector<CollocatedVectorGrid3::ConstVectorDataAccessor> inputDataAccs;
+			std::vector<CollocatedVectorGrid3::VectorDataAccessor> outputDataAccs;
+
+			for (size_t n : group)
+			{
+				inputSamplerFuncs.push_back(GetVectorSamplerFunc(*inputs[n]));
+				inputDataAccs.push_back(inputs[n]->GetConstDataAccessor());
+				outputDataAccs.push_back(outputs[n]->GetDataAccessor());
+			}
+
+			const CollocatedVectorGrid3& input = *inputs[group[0]];
+			CollocatedVectorGrid3* output = outputs[group[0]];
+			double h = std::min(output->GridSpacing().x, output->GridSpacing().y);
+
+			auto inputDataPos = input.GetDataPosition();
+			auto outputDataPos = output->GetDataPosition();
+			const size_t numFields = group.size();
+
+			output->ParallelForEachDataPointIndex([&](size_t i, size_t j, size_t k)
+			{
+				if (boundarySDF.Sample(inputDataPos(i, j, k)) > 0.0)
+				{
+					Vector3D pt = BackTrace(flow, dt, h, outputDataPos(i, j, k), boundarySDF);
+
+					for (size_t n = 0; n < numFields; ++n)
+					{
+						outputDataAccs[n](i, j, k) = inputSamplerFuncs[n](pt);
+					}
+				}
+				else
+				{
+					for (size_t n = 0; n < numFields; ++n)
+					{
+						outputDataAccs[n](i, j, k) = inputDataAccs[n](i, j, k);
+					}
+				}
+			});
+		}
+	}
+
 	Vector3D SemiLagrangian3::BackTrace(
 		const VectorField3& flow,
 		double dt,
@@ -7,6 +7,8 @@
 > Copyright (c) 2018, Chan-Ho Chris Ohk
 *************************************************************************/
 #include <Core/Solver/Advection/AdvectionSolver3.h>
+#include <Core/Utils/Constants.h>
+#include <Core/Utils/Parallel.h>
 
 namespace CubbyFlow
 {
@@ -20,6 +22,25 @@ namespace CubbyFlow
 		// Do nothing
 	}
 
+	void AdvectionSolver3::Advect(
+		const ScalarGrid3& input,
+		const VectorField3& flow,
+		double dt,
+		const ConstArrayAccessor1<Point3UI>& dataPoints,
+		ArrayAccessor1<double> output,
+		const ScalarField3& boundarySDF)
+	{
+		auto grid = input.Clone();
+
+		Advect(input, flow, dt, grid.get(), boundarySDF);
+
+		ParallelFor(ZERO_SIZE, dataPoints.size(), [&](size_t n)
+		{
+			const Point3UI& pt = dataPoints[n];
+			output[n] = (*grid)(pt.x, pt.y, pt.z);
+		});
+	}
+
 	void AdvectionSolver3::Advect(
 		const CollocatedVectorGrid3& source,
 		const VectorField3& flow,
@@ -47,4 +68,30 @@ namespace CubbyFlow
 		UNUSED_VARIABLE(target);
 		UNUSED_VARIABLE(boundarySDF);
 	}
+
+	void AdvectionSolver3::Advect(
+		const std::vector<const ScalarGrid3*>& inputs,
+		const VectorField3& flow,
+		double dt,
+		const std::vector<ScalarGrid3*>& outputs,
+		const ScalarField3& boundarySDF)
+	{
+		for (size_t n = 0; n < inputs.size(); ++n)
+		{
+			Advect(*inputs[n], flow, dt, outputs[n], boundarySDF);
+		}
+	}
+
+	void AdvectionSolver3::Advect(
+		const std::vector<const CollocatedVectorGrid3*>& inputs,
+		const VectorField3& flow,
+		double dt,
+		const std::vector<CollocatedVectorGrid3*>& outputs,
+		const ScalarField3& boundarySDF)
+	{
+		for (size_t n = 0; n < inputs.size(); ++n)
+		{
+			Advect(*inputs[n], flow, dt, outputs[n], boundarySDF);
+		}
+	}
 }
\ No newline at end of file
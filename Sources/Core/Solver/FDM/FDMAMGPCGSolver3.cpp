@@ -0,0 +1,796 @@
+/*************************************************************************
+> File Name: FDMAMGPCGSolver3.cpp
+> Project Name: CubbyFlow
+> Author: Chan-Ho Chris Ohk
+> Purpose: 3-D finite difference-type linear system solver using algebraic
+>          multigrid preconditioned conjugate gradient (AMGPCG).
+> Created Time: 2026/10/19
+> Copyright (c) 2018, Chan-Ho Chris Ohk
+*************************************************************************/
+#include <Core/Math/CG.h>
+#include <Core/Point/Point3.h>
+#include <Core/Solver/FDM/FDMAMGPCGSolver3.h>
+#include <Core/Utils/Logging.h>
+#include <Core/Utils/Parallel.h>
+
+#include <algorithm>
+#include <functional>
+
+namespace CubbyFlow
+{
+	namespace
+	{
+		const size_t UNASSIGNED = std::numeric_limits<size_t>::max();
+
+		// Strength of connection threshold for the aggregation.
+		const double STRENGTH_THRESHOLD = 0.02;
+
+		// Number of power iterations for the spectral radius estimation.
+		const int NUMBER_OF_POWER_ITERATIONS = 20;
+
+		// Max number of rows the coarsest level is factorized for.
+		const size_t MAX_DENSE_COARSEST_SIZE = 1024;
+
+		MatrixCSRD BuildMatrix(
+			size_t rows, size_t cols,
+			const std::vector<size_t>& rowPointers,
+			const std::vector<size_t>& columnIndices,
+			const std::vector<double>& nonZeros)
+		{
+			MatrixCSRD m;
+			m.Reserve(rows, cols, nonZeros.size());
+
+			std::copy(rowPointers.begin(), rowPointers.end(), m.RowPointersBegin());
+			std::copy(columnIndices.begin(), columnIndices.end(), m.ColumnIndicesBegin());
+			std::copy(nonZeros.begin(), nonZeros.end(), m.NonZeroBegin());
+
+			return m;
+		}
+
+		MatrixCSRD Transpose(const MatrixCSRD& m)
+		{
+			const size_t rows = m.Rows();
+			const size_t cols = m.Cols();
+			const auto rp = m.RowPointersBegin();
+			const auto ci = m.ColumnIndicesBegin();
+			const auto nnz = m.NonZeroBegin();
+
+			std::vector<size_t> rowPointers(cols + 1, 0);
+			for (size_t jj = 0; jj < m.NumberOfNonZeros(); ++jj)
+			{
+				++rowPointers[ci[jj] + 1];
+			}
+			for (size_t j = 0; j < cols; ++j)
+			{
+				rowPointers[j + 1] += rowPointers[j];
+			}
+
+			std::vector<size_t> next(rowPointers.begin(), rowPointers.end() - 1);
+			std::vector<size_t> columnIndices(m.NumberOfNonZeros());
+			std::vector<double> nonZeros(m.NumberOfNonZeros());
+
+			for (size_t i = 0; i < rows; ++i)
+			{
+				for (size_t jj = rp[i]; jj < rp[i + 1]; ++jj)
+				{
+					const size_t pos = next[ci[jj]]++;
+					columnIndices[pos] = i;
+					nonZeros[pos] = nnz[jj];
+				}
+			}
+
+			return BuildMatrix(cols, rows, rowPointers, columnIndices, nonZeros);
+		}
+
+		MatrixCSRD Multiply(const MatrixCSRD& a, const MatrixCSRD& b)
+		{
+			const auto arp = a.RowPointersBegin();
+			const auto aci = a.ColumnIndicesBegin();
+			const auto annz = a.NonZeroBegin();
+			const auto brp = b.RowPointersBegin();
+			const auto bci = b.ColumnIndicesBegin();
+			const auto bnnz = b.NonZeroBegin();
+
+			std::vector<size_t> marker(b.Cols(), UNASSIGNED);
+			std::vector<double> accumulator(b.Cols(), 0.0);
+
+			std::vector<size_t> rowPointers(1, 0);
+			std::vector<size_t> columnIndices;
+			std::vector<double> nonZeros;
+
+			for (size_t i = 0; i < a.Rows(); ++i)
+			{
+				const size_t rowBegin = columnIndices.size();
+
+				for (size_t jj = arp[i]; jj < arp[i + 1]; ++jj)
+				{
+					const size_t j = aci[jj];
+
+					for (size_t kk = brp[j]; kk < brp[j + 1]; ++kk)
+					{
+						const size_t k = bci[kk];
+
+						if (marker[k] != i)
+						{
+							marker[k] = i;
+							accumulator[k] = annz[jj] * bnnz[kk];
+							columnIndices.push_back(k);
+						}
+						else
+						{
+							accumulator[k] += annz[jj] * bnnz[kk];
+						}
+					}
+				}
+
+				std::sort(columnIndices.begin() + rowBegin, columnIndices.end());
+				for (size_t kk = rowBegin; kk < columnIndices.size(); ++kk)
+				{
+					nonZeros.push_back(accumulator[columnIndices[kk]]);
+				}
+
+				rowPointers.push_back(columnIndices.size());
+			}
+
+			return BuildMatrix(a.Rows(), b.Cols(), rowPointers, columnIndices, nonZeros);
+		}
+
+		void Multiply(const MatrixCSRD& m, const VectorND& v, VectorND* result)
+		{
+			const auto rp = m.RowPointersBegin();
+			const auto ci = m.ColumnIndicesBegin();
+			const auto nnz = m.NonZeroBegin();
+
+			ParallelFor(ZERO_SIZE, m.Rows(), [&](size_t i)
+			{
+				double sum = 0.0;
+
+				for (size_t jj = rp[i]; jj < rp[i + 1]; ++jj)
+				{
+					sum += nnz[jj] * v[ci[jj]];
+				}
+
+				(*result)[i] = sum;
+			});
+		}
+
+		// Estimates the spectral radius of D^-1 A using power iterations.
+		double EstimateSpectralRadius(const MatrixCSRD& m, const VectorND& invDiag)
+		{
+			const size_t n = m.Rows();
+			VectorND v(n);
+			VectorND w(n);
+
+			// Deterministic start vector which is not orthogonal to the dominant
+			// eigenvector in general
+			ParallelFor(ZERO_SIZE, n, [&](size_t i)
+			{
+				v[i] = static_cast<double>((i * 7919) % 101) / 101.0 - 0.5;
+			});
+
+			double radius = 0.0;
+			for (int iter = 0; iter < NUMBER_OF_POWER_ITERATIONS; ++iter)
+			{
+				const double norm = v.Length();
+				if (norm <= 0.0)
+				{
+					break;
+				}
+
+				v /= norm;
+				Multiply(m, v, &w);
+				ParallelFor(ZERO_SIZE, n, [&](size_t i)
+				{
+					w[i] *= invDiag[i];
+				});
+
+				radius = w.Length();
+				v.Swap(w);
+			}
+
+			return radius;
+		}
+
+		//
+		// Groups the strongly connected rows into aggregates. Rows without any
+		// strong connection are left out of the coarser levels since they are
+		// handled by the smoother.
+		//
+		size_t Aggregate(const MatrixCSRD& m, const VectorND& diag, std::vector<size_t>* aggregates)
+		{
+			const size_t n = m.Rows();
+			const auto rp = m.RowPointersBegin();
+			const auto ci = m.ColumnIndicesBegin();
+			const auto nnz = m.NonZeroBegin();
+
+			auto isStrong = [&](size_t i, size_t jj)
+			{
+				const size_t j = ci[jj];
+				return j != i && Square(nnz[jj]) > Square(STRENGTH_THRESHOLD) * std::fabs(diag[i] * diag[j]);
+			};
+
+			std::vector<size_t>& agg = *aggregates;
+			agg.assign(n, UNASSIGNED);
+			std::vector<bool> hasStrong(n, false);
+			size_t numberOfAggregates = 0;
+
+			// Phase 1: form aggregates from the rows whose neighborhood is free
+			for (size_t i = 0; i < n; ++i)
+			{
+				bool isFree = true;
+
+				for (size_t jj = rp[i]; jj < rp[i + 1]; ++jj)
+				{
+					if (isStrong(i, jj))
+					{
+						hasStrong[i] = true;
+
+						if (agg[ci[jj]] != UNASSIGNED)
+						{
+							isFree = false;
+						}
+					}
+				}
+
+				if (agg[i] != UNASSIGNED || !hasStrong[i] || !isFree)
+				{
+					continue;
+				}
+
+				agg[i] = numberOfAggregates;
+				for (size_t jj = rp[i]; jj < rp[i + 1]; ++jj)
+				{
+					if (isStrong(i, jj))
+					{
+						agg[ci[jj]] = numberOfAggregates;
+					}
+				}
+
+				++numberOfAggregates;
+			}
+
+			// Phase 2: attach the remaining rows to a neighboring aggregate
+			const std::vector<size_t> phase1 = agg;
+			for (size_t i = 0; i < n; ++i)
+			{
+				if (agg[i] != UNASSIGNED)
+				{
+					continue;
+				}
+
+				for (size_t jj = rp[i]; jj < rp[i + 1]; ++jj)
+				{
+					if (isStrong(i, jj) && phase1[ci[jj]] != UNASSIGNED)
+					{
+						agg[i] = phase1[ci[jj]];
+						break;
+					}
+				}
+			}
+
+			// Phase 3: aggregate whatever is left
+			for (size_t i = 0; i < n; ++i)
+			{
+				if (agg[i] != UNASSIGNED || !hasStrong[i])
+				{
+					continue;
+				}
+
+				agg[i] = numberOfAggregates;
+				for (size_t jj = rp[i]; jj < rp[i + 1]; ++jj)
+				{
+					if (isStrong(i, jj) && agg[ci[jj]] == UNASSIGNED)
+					{
+						agg[ci[jj]] = numberOfAggregates;
+					}
+				}
+
+				++numberOfAggregates;
+			}
+
+			return numberOfAggregates;
+		}
+
+		// Builds the smoothed prolongation P = (I - omega D^-1 A) T where T is
+		// the piecewise constant prolongation of the aggregates.
+		MatrixCSRD BuildProlongation(
+			const MatrixCSRD& m, const VectorND& invDiag, double omega,
+			const std::vector<size_t>& aggregates, size_t numberOfAggregates)
+		{
+			const auto rp = m.RowPointersBegin();
+			const auto ci = m.ColumnIndicesBegin();
+			const auto nnz = m.NonZeroBegin();
+
+			std::vector<size_t> marker(numberOfAggregates, UNASSIGNED);
+			std::vector<double> accumulator(numberOfAggregates, 0.0);
+
+			std::vector<size_t> rowPointers(1, 0);
+			std::vector<size_t> columnIndices;
+			std::vector<double> nonZeros;
+
+			auto add = [&](size_t i, size_t col, double value)
+			{
+				if (marker[col] != i)
+				{
+					marker[col] = i;
+					accumulator[col] = value;
+					columnIndices.push_back(col);
+				}
+				else
+				{
+					accumulator[col] += value;
+				}
+			};
+
+			for (size_t i = 0; i < m.Rows(); ++i)
+			{
+				const size_t rowBegin = columnIndices.size();
+
+				if (aggregates[i] != UNASSIGNED)
+				{
+					add(i, aggregates[i], 1.0);
+				}
+
+				for (size_t jj = rp[i]; jj < rp[i + 1]; ++jj)
+				{
+					const size_t j = ci[jj];
+
+					if (aggregates[j] != UNASSIGNED)
+					{
+						add(i, aggregates[j], -omega * invDiag[i] * nnz[jj]);
+					}
+				}
+
+				std::sort(columnIndices.begin() + rowBegin, columnIndices.end());
+				for (size_t kk = rowBegin; kk < columnIndices.size(); ++kk)
+				{
+					nonZeros.push_back(accumulator[columnIndices[kk]]);
+				}
+
+				rowPointers.push_back(columnIndices.size());
+			}
+
+			return BuildMatrix(m.Rows(), numberOfAggregates, rowPointers, columnIndices, nonZeros);
+		}
+	}
+
+	void FDMAMGPCGSolver3::Preconditioner::Build(const MatrixCSRD& matrix)
+	{
+		levels.clear();
+		levels.emplace_back();
+		levels[0].A = matrix;
+
+		for (size_t l = 0; ; ++l)
+		{
+			Level& level = levels[l];
+			const size_t n = level.A.Rows();
+			const auto rp = level.A.RowPointersBegin();
+			const auto ci = level.A.ColumnIndicesBegin();
+			const auto nnz = level.A.NonZeroBegin();
+
+			VectorND diag(n, 0.0);
+			level.invDiag.Resize(n, 0.0);
+			ParallelFor(ZERO_SIZE, n, [&](size_t i)
+			{
+				for (size_t jj = rp[i]; jj < rp[i + 1]; ++jj)
+				{
+					if (ci[jj] == i)
+					{
+						diag[i] = nnz[jj];
+					}
+				}
+
+				level.invDiag[i] = (std::fabs(diag[i]) > 0.0) ? 1.0 / diag[i] : 0.0;
+			});
+
+			const double radius = EstimateSpectralRadius(level.A, level.invDiag);
+			level.smoothingFactor = (radius > 0.0) ? (4.0 / 3.0) / radius : 1.0;
+
+			level.x.Resize(n, 0.0);
+			level.b.Resize(n, 0.0);
+			level.r.Resize(n, 0.0);
+
+			if (n <= maxCoarsestSize || levels.size() >= maxNumberOfLevels)
+			{
+				break;
+			}
+
+			std::vector<size_t> aggregates;
+			const size_t numberOfAggregates = Aggregate(level.A, diag, &aggregates);
+
+			// Stop if the coarsening stalls
+			if (numberOfAggregates == 0 || numberOfAggregates * 10 > n * 9)
+			{
+				break;
+			}
+
+			level.P = BuildProlongation(level.A, level.invDiag, level.smoothingFactor, aggregates, numberOfAggregates);
+			level.R = Transpose(level.P);
+
+			MatrixCSRD coarseA = Multiply(level.R, Multiply(level.A, level.P));
+
+			levels.emplace_back();
+			levels.back().A = std::move(coarseA);
+		}
+
+		BuildCoarsestSolver(levels.back().A);
+	}
+
+	void FDMAMGPCGSolver3::Preconditioner::Solve(const VectorND& b, VectorND* x)
+	{
+		Cycle(0, b, x);
+	}
+
+	void FDMAMGPCGSolver3::Preconditioner::Cycle(size_t l, const VectorND& b, VectorND* x)
+	{
+		Level& level = levels[l];
+
+		if (l + 1 == levels.size())
+		{
+			if (coarsestSize > 0)
+			{
+				SolveCoarsest(b, x);
+			}
+			else
+			{
+				x->Set(0.0);
+				Smooth(level, 10 * numberOfSmoothingIter, b, x, &level.r);
+			}
+
+			return;
+		}
+
+		Level& coarser = levels[l + 1];
+
+		// Pre-smoothing
+		x->Set(0.0);
+		Smooth(level, numberOfSmoothingIter, b, x, &level.r);
+
+		// Restriction
+		FDMCompressedBLAS3::Residual(level.A, *x, b, &level.r);
+		Multiply(level.R, level.r, &coarser.b);
+
+		Cycle(l + 1, coarser.b, &coarser.x);
+
+		// Correction
+		const auto rp = level.P.RowPointersBegin();
+		const auto ci = level.P.ColumnIndicesBegin();
+		const auto nnz = level.P.NonZeroBegin();
+
+		ParallelFor(ZERO_SIZE, level.P.Rows(), [&](size_t i)
+		{
+			double sum = 0.0;
+
+			for (size_t jj = rp[i]; jj < rp[i + 1]; ++jj)
+			{
+				sum += nnz[jj] * coarser.x[ci[jj]];
+			}
+
+			(*x)[i] += sum;
+		});
+
+		// Post-smoothing
+		Smooth(level, numberOfSmoothingIter, b, x, &level.r);
+	}
+
+	void FDMAMGPCGSolver3::Preconditioner::Smooth(
+		const Level& level, unsigned int numberOfIter, const VectorND& b, VectorND* x, VectorND* r) const
+	{
+		// Damped Jacobi keeps the V-cycle symmetric
+		for (unsigned int iter = 0; iter < numberOfIter; ++iter)
+		{
+			FDMCompressedBLAS3::Residual(level.A, *x, b, r);
+
+			ParallelFor(ZERO_SIZE, x->size(), [&](size_t i)
+			{
+				(*x)[i] += level.smoothingFactor * level.invDiag[i] * (*r)[i];
+			});
+		}
+	}
+
+	void FDMAMGPCGSolver3::Preconditioner::BuildCoarsestSolver(const MatrixCSRD& matrix)
+	{
+		const size_t n = matrix.Rows();
+
+		coarsestFactor.clear();
+		coarsestSize = 0;
+
+		if (n > MAX_DENSE_COARSEST_SIZE)
+		{
+			return;
+		}
+
+		coarsestSize = n;
+		coarsestFactor.assign(n * n, 0.0);
+
+		const auto rp = matrix.RowPointersBegin();
+		const auto ci = matrix.ColumnIndicesBegin();
+		const auto nnz = matrix.NonZeroBegin();
+
+		for (size_t i = 0; i < n; ++i)
+		{
+			for (size_t jj = rp[i]; jj < rp[i + 1]; ++jj)
+			{
+				coarsestFactor[i * n + ci[jj]] = nnz[jj];
+			}
+		}
+
+		// In-place Cholesky factorization (lower triangle). Pivots which vanish
+		// relative to the diagonal (e.g., the null space of pure Neumann
+		// problems) are dropped so that the solve stays symmetric.
+		double* L = coarsestFactor.data();
+		for (size_t j = 0; j < n; ++j)
+		{
+			const double ajj = L[j * n + j];
+			double d = ajj;
+			for (size_t k = 0; k < j; ++k)
+			{
+				d -= Square(L[j * n + k]);
+			}
+
+			if (d <= 1e-10 * std::fabs(ajj) || d <= 0.0)
+			{
+				for (size_t i = j; i < n; ++i)
+				{
+					L[i * n + j] = 0.0;
+				}
+
+				continue;
+			}
+
+			const double ljj = std::sqrt(d);
+			L[j * n + j] = ljj;
+
+			for (size_t i = j + 1; i < n; ++i)
+			{
+				double sum = L[i * n + j];
+				for (size_t k = 0; k < j; ++k)
+				{
+					sum -= L[i * n + k] * L[j * n + k];
+				}
+
+				L[i * n + j] = sum / ljj;
+			}
+		}
+	}
+
+	void FDMAMGPCGSolver3::Preconditioner::SolveCoarsest(const VectorND& b, VectorND* x) const
+	{
+		const size_t n = coarsestSize;
+		const double* L = coarsestFactor.data();
+		VectorND& refX = *x;
+
+		for (size_t i = 0; i < n; ++i)
+		{
+			double sum = b[i];
+			for (size_t k = 0; k < i; ++k)
+			{
+				sum -= L[i * n + k] * refX[k];
+			}
+
+			refX[i] = (L[i * n + i] > 0.0) ? sum / L[i * n + i] : 0.0;
+		}
+
+		for (size_t ii = n; ii > 0; --ii)
+		{
+			const size_t i = ii - 1;
+
+			double sum = refX[i];
+			for (size_t k = i + 1; k < n; ++k)
+			{
+				sum -= L[k * n + i] * refX[k];
+			}
+
+			refX[i] = (L[i * n + i] > 0.0) ? sum / L[i * n + i] : 0.0;
+		}
+	}
+
+	FDMAMGPCGSolver3::FDMAMGPCGSolver3(
+		unsigned int maxNumberOfIterations,
+		double tolerance,
+		size_t maxNumberOfLevels,
+		unsigned int numberOfSmoothingIter,
+		size_t maxCoarsestSize) :
+		m_maxNumberOfIterations(maxNumberOfIterations),
+		m_lastNumberOfIterations(0),
+		m_tolerance(tolerance),
+		m_lastResidualNorm(std::numeric_limits<double>::max())
+	{
+		m_precond.maxNumberOfLevels = std::max(maxNumberOfLevels, ONE_SIZE);
+		m_precond.numberOfSmoothingIter = numberOfSmoothingIter;
+		m_precond.maxCoarsestSize = maxCoarsestSize;
+	}
+
+	bool FDMAMGPCGSolver3::Solve(FDMLinearSystem3* system)
+	{
+		const FDMMatrix3& A = system->A;
+		const FDMVector3& b = system->b;
+		FDMVector3& x = system->x;
+		const Size3 size = A.size();
+
+		// Rows without any coupling are solved directly, and only the coupled
+		// rows go into the compressed system. The coupled rows are numbered in
+		// the lexicographic order with a prefix sum of their flags.
+		const size_t numberOfCells = size.x * size.y * size.z;
+		Array3<char> isCoupled(size);
+		Array3<size_t> coordToIndex(size);
+		size_t* coordToIndexData = coordToIndex.data();
+
+		A.ParallelForEachIndex([&](size_t i, size_t j, size_t k)
+		{
+			const FDMMatrixRow3& row = A(i, j, k);
+			isCoupled(i, j, k) =
+				row.right != 0.0 || row.up != 0.0 || row.front != 0.0 ||
+				(i > 0 && A(i - 1, j, k).right != 0.0) ||
+				(j > 0 && A(i, j - 1, k).up != 0.0) ||
+				(k > 0 && A(i, j, k - 1).front != 0.0);
+			coordToIndex(i, j, k) = isCoupled(i, j, k) ? 1 : 0;
+		});
+
+		const size_t numRows = ParallelExclusiveScan(coordToIndexData, coordToIndexData + numberOfCells,
+			coordToIndexData, ZERO_SIZE, std::plus<size_t>());
+
+		std::vector<Point3UI> indexToCoord(numRows);
+		A.ParallelForEachIndex([&](size_t i, size_t j, size_t k)
+		{
+			if (isCoupled(i, j, k))
+			{
+				indexToCoord[coordToIndex(i, j, k)] = Point3UI(i, j, k);
+			}
+			else
+			{
+				const double center = A(i, j, k).center;
+				x(i, j, k) = (center != 0.0) ? b(i, j, k) / center : 0.0;
+			}
+		});
+
+		// Calls the function for each non-zero of the row, the diagonal first
+		auto forEachNonZero = [&](size_t row, const auto& func)
+		{
+			const Point3UI& pt = indexToCoord[row];
+			const size_t i = pt.x, j = pt.y, k = pt.z;
+
+			func(A(i, j, k).center, row);
+
+			auto addNeighbor = [&](double value, size_t ni, size_t nj, size_t nk)
+			{
+				if (value != 0.0)
+				{
+					func(value, coordToIndex(ni, nj, nk));
+				}
+			};
+
+			if (i > 0)
+			{
+				addNeighbor(A(i - 1, j, k).right, i - 1, j, k);
+			}
+			if (i + 1 < size.x)
+			{
+				addNeighbor(A(i, j, k).right, i + 1, j, k);
+			}
+			if (j > 0)
+			{
+				addNeighbor(A(i, j - 1, k).up, i, j - 1, k);
+			}
+			if (j + 1 < size.y)
+			{
+				addNeighbor(A(i, j, k).up, i, j + 1, k);
+			}
+			if (k > 0)
+			{
+				addNeighbor(A(i, j, k - 1).front, i, j, k - 1);
+			}
+			if (k + 1 < size.z)
+			{
+				addNeighbor(A(i, j, k).front, i, j, k + 1);
+			}
+		};
+
+		m_compSystem.A.Build(numRows, numRows,
+			[&](size_t row)
+		{
+			size_t count = 0;
+			forEachNonZero(row, [&](double, size_t) { ++count; });
+			return count;
+		},
+			[&](size_t row, auto nonZeros, auto columnIndices)
+		{
+			forEachNonZero(row, [&](double value, size_t col)
+			{
+				*nonZeros++ = value;
+				*columnIndices++ = col;
+			});
+		});
+
+		m_compSystem.b.Resize(numRows);
+		m_compSystem.x.Resize(numRows, 0.0);
+
+		const bool useInitialGuess = GetUseInitialGuess();
+		ParallelFor(ZERO_SIZE, numRows, [&](size_t row)
+		{
+			const Point3UI& pt = indexToCoord[row];
+			m_compSystem.b[row] = b(pt);
+
+			if (useInitialGuess)
+			{
+				m_compSystem.x[row] = x(pt);
+			}
+		});
+
+		const bool result = SolveCompressed(&m_compSystem);
+
+		ParallelFor(ZERO_SIZE, numRows, [&](size_t row)
+		{
+			x(indexToCoord[row]) = m_compSystem.x[row];
+		});
+
+		return result;
+	}
+
+	bool FDMAMGPCGSolver3::SolveCompressed(FDMCompressedLinearSystem3* system)
+	{
+		MatrixCSRD& matrix = system->A;
+		VectorND& solution = system->x;
+		VectorND& rhs = system->b;
+
+		const size_t size = solution.size();
+		m_r.Resize(size);
+		m_d.Resize(size);
+		m_q.Resize(size);
+		m_s.Resize(size);
+
+		if (!GetUseInitialGuess())
+		{
+			system->x.Set(0.0);
+		}
+
+		m_r.Set(0.0);
+		m_d.Set(0.0);
+		m_q.Set(0.0);
+		m_s.Set(0.0);
+
+		if (size == 0)
+		{
+			m_lastNumberOfIterations = 0;
+			m_lastResidualNorm = 0.0;
+			return true;
+		}
+
+		m_precond.Build(matrix);
+
+		PCG<FDMCompressedBLAS3, Preconditioner>(
+			matrix, rhs, m_maxNumberOfIterations, m_tolerance, &m_precond, &solution,
+			&m_r, &m_d, &m_q, &m_s, &m_lastNumberOfIterations, &m_lastResidualNorm);
+
+		CUBBYFLOW_INFO << "Residual after solving AMGPCG: " << m_lastResidualNorm
+			<< " Number of AMGPCG iterations: " << m_lastNumberOfIterations
+			<< " Number of AMG levels: " << m_precond.levels.size();
+
+		return (m_lastResidualNorm <= m_tolerance) || (m_lastNumberOfIterations < m_maxNumberOfIterations);
+	}
+
+	unsigned int FDMAMGPCGSolver3::GetMaxNumberOfIterations() const
+	{
+		return m_maxNumberOfIterations;
+	}
+
+	unsigned int FDMAMGPCGSolver3::GetLastNumberOfIterations() const
+	{
+		return m_lastNumberOfIterations;
+	}
+
+	double FDMAMGPCGSolver3::GetTolerance() const
+	{
+		return m_tolerance;
+	}
+
+	double FDMAMGPCGSolver3::GetLastResidual() const
+	{
+		return m_lastResidualNorm;
+	}
+
+	size_t FDMAMGPCGSolver3::GetLastNumberOfLevels() const
+	{
+		return m_precond.levels.size();
+	}
+}
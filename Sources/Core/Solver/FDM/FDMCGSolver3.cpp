@@ -37,7 +37,11 @@ namespace CubbyFlow
 		m_q.Resize(size);
 		m_s.Resize(size);
 
-		system->x.Set(0.0);
+		if (!GetUseInitialGuess())
+		{
+			system->x.Set(0.0);
+		}
+
 		m_r.Set(0.0);
 		m_d.Set(0.0);
 		m_q.Set(0.0);
@@ -63,7 +67,11 @@ namespace CubbyFlow
 		m_qComp.Resize(size);
 		m_sComp.Resize(size);
 
-		system->x.Set(0.0);
+		if (!GetUseInitialGuess())
+		{
+			system->x.Set(0.0);
+		}
+
 		m_rComp.Set(0.0);
 		m_dComp.Set(0.0);
 		m_qComp.Set(0.0);
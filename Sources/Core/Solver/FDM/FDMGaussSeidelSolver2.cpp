@@ -72,9 +72,21 @@ namespace CubbyFlow
 
 		m_lastNumberOfIterations = m_maxNumberOfIterations;
 
+		if (m_useRedBlackOrdering && system->colors.empty())
+		{
+			system->BuildColors();
+		}
+
 		for (unsigned int iter = 0; iter < m_maxNumberOfIterations; ++iter)
 		{
-			Relax(system->A, system->b, m_sorFactor, &system->x);
+			if (m_useRedBlackOrdering)
+			{
+				RelaxMultiColor(system->A, system->b, system->colors, m_sorFactor, &system->x);
+			}
+			else
+			{
+				Relax(system->A, system->b, m_sorFactor, &system->x);
+			}
 
 			if (iter != 0 && iter % m_residualCheckInterval == 0)
 			{
@@ -176,6 +188,44 @@ namespace CubbyFlow
 		});
 	}
 
+	void FDMGaussSeidelSolver2::RelaxMultiColor(const MatrixCSRD& A, const VectorND& b,
+		const std::vector<std::vector<size_t>>& colors, double sorFactor, VectorND* x_)
+	{
+		const auto rp = A.RowPointersBegin();
+		const auto ci = A.ColumnIndicesBegin();
+		const auto nnz = A.NonZeroBegin();
+
+		VectorND& x = *x_;
+
+		for (const auto& rows : colors)
+		{
+			ParallelFor(ZERO_SIZE, rows.size(), [&](size_t n)
+			{
+				const size_t i = rows[n];
+				const size_t rowBegin = rp[i];
+				const size_t rowEnd = rp[i + 1];
+
+				double r = 0.0;
+				double diag = 1.0;
+				for (size_t jj = rowBegin; jj < rowEnd; ++jj)
+				{
+					size_t j = ci[jj];
+
+					if (i == j)
+					{
+						diag = nnz[jj];
+					}
+					else
+					{
+						r += nnz[jj] * x[j];
+					}
+				}
+
+				x[i] = (1.0 - sorFactor) * x[i] + sorFactor * (b[i] - r) / diag;
+			});
+		}
+	}
+
 	void FDMGaussSeidelSolver2::RelaxRedBlack(const FDMMatrix2& A, const FDMVector2& b,
 		double sorFactor, FDMVector2* x)
 	{
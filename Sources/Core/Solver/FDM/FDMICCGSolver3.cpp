@@ -9,7 +9,9 @@
 *************************************************************************/
 #include <Core/Math/CG.h>
 #include <Core/Solver/FDM/FDMICCGSolver3.h>
+#include <Core/Utils/Constants.h>
 #include <Core/Utils/Logging.h>
+#include <Core/Utils/Parallel.h>
 
 namespace CubbyFlow
 {
@@ -42,6 +44,12 @@ namespace CubbyFlow
 
 	void FDMICCGSolver3::Preconditioner::Solve(const FDMVector3& b, FDMVector3* x)
 	{
+		Solve(b, x, &y);
+	}
+
+	void FDMICCGSolver3::Preconditioner::Solve(const FDMVector3& b, FDMVector3* x, FDMVector3* temp) const
+	{
+		FDMVector3& y = *temp;
 		const Size3 size = b.size();
 		const ssize_t sx = static_cast<ssize_t>(size.x);
 		const ssize_t sy = static_cast<ssize_t>(size.y);
@@ -74,6 +82,11 @@ namespace CubbyFlow
 		}
 	}
 
+	void FDMICCGSolver3::SharedPreconditioner::Solve(const FDMVector3& b, FDMVector3* x)
+	{
+		precond->Solve(b, x, &y);
+	}
+
 	void FDMICCGSolver3::PreconditionerCompressed::Build(const MatrixCSRD& matrix)
 	{
 		const size_t size = matrix.Cols();
@@ -190,7 +203,11 @@ namespace CubbyFlow
 		m_q.Resize(size);
 		m_s.Resize(size);
 
-		system->x.Set(0.0);
+		if (!GetUseInitialGuess())
+		{
+			system->x.Set(0.0);
+		}
+
 		m_r.Set(0.0);
 		m_d.Set(0.0);
 		m_q.Set(0.0);
@@ -221,7 +238,11 @@ namespace CubbyFlow
 		m_qComp.Resize(size);
 		m_sComp.Resize(size);
 
-		system->x.Set(0.0);
+		if (!GetUseInitialGuess())
+		{
+			system->x.Set(0.0);
+		}
+
 		m_rComp.Set(0.0);
 		m_dComp.Set(0.0);
 		m_qComp.Set(0.0);
@@ -239,6 +260,68 @@ namespace CubbyFlow
 		return (m_lastResidualNorm <= m_tolerance) || (m_lastNumberOfIterations < m_maxNumberOfIterations);
 	}
 
+	bool FDMICCGSolver3::SolveMultiple(
+		FDMLinearSystem3* system,
+		const std::vector<const FDMVector3*>& rhs,
+		const std::vector<FDMVector3*>& solutions)
+	{
+		FDMMatrix3& matrix = system->A;
+		const Size3 size = matrix.size();
+		const size_t numberOfSystems = rhs.size();
+
+		ClearCompressedVectors();
+
+		m_precond.Build(matrix);
+
+		m_multipleSolveVectors.resize(numberOfSystems);
+		std::vector<unsigned int> numberOfIterations(numberOfSystems, 0);
+		std::vector<double> residualNorms(numberOfSystems, 0.0);
+
+		// The triangular solves of the preconditioner are serial, so the
+		// systems are solved concurrently rather than one after another
+		ParallelFor(ZERO_SIZE, numberOfSystems, [&](size_t n)
+		{
+			assert(rhs[n]->size() == size);
+			assert(solutions[n]->size() == size);
+
+			MultipleSolveVectors& vectors = m_multipleSolveVectors[n];
+			vectors.r.Resize(size);
+			vectors.d.Resize(size);
+			vectors.q.Resize(size);
+			vectors.s.Resize(size);
+			vectors.precond.y.Resize(size);
+			vectors.precond.precond = &m_precond;
+
+			if (!GetUseInitialGuess())
+			{
+				solutions[n]->Set(0.0);
+			}
+
+			vectors.r.Set(0.0);
+			vectors.d.Set(0.0);
+			vectors.q.Set(0.0);
+			vectors.s.Set(0.0);
+
+			PCG<FDMBLAS3, SharedPreconditioner>(matrix, *rhs[n], m_maxNumberOfIterations, m_tolerance,
+				&vectors.precond, solutions[n], &vectors.r, &vectors.d, &vectors.q, &vectors.s,
+				&numberOfIterations[n], &residualNorms[n]);
+		});
+
+		m_lastNumberOfIterations = 0;
+		m_lastResidualNorm = 0.0;
+
+		for (size_t n = 0; n < numberOfSystems; ++n)
+		{
+			m_lastNumberOfIterations = std::max(m_lastNumberOfIterations, numberOfIterations[n]);
+			m_lastResidualNorm = std::max(m_lastResidualNorm, residualNorms[n]);
+		}
+
+		CUBBYFLOW_INFO << "Residual norm after solving " << numberOfSystems << " systems with ICCG: "
+			<< m_lastResidualNorm << " Number of ICCG iterations: " << m_lastNumberOfIterations;
+
+		return (m_lastResidualNorm <= m_tolerance) || (m_lastNumberOfIterations < m_maxNumberOfIterations);
+	}
+
 	unsigned int FDMICCGSolver3::GetMaxNumberOfIterations() const
 	{
 		return m_maxNumberOfIterations;
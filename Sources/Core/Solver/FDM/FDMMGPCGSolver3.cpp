@@ -66,7 +66,11 @@ namespace CubbyFlow
 		m_q.Resize(size);
 		m_s.Resize(size);
 
-		system->x.levels.front().Set(0.0);
+		if (!GetUseInitialGuess())
+		{
+			system->x.levels.front().Set(0.0);
+		}
+
 		m_r.Set(0.0);
 		m_d.Set(0.0);
 		m_q.Set(0.0);
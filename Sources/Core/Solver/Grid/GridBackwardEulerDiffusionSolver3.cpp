@@ -10,6 +10,8 @@
 #include <Core/Solver/FDM/FDMICCGSolver3.h>
 #include <Core/Solver/Grid/GridBackwardEulerDiffusionSolver3.h>
 
+#include <algorithm>
+
 namespace CubbyFlow
 {
 	const char FLUID = 0;
@@ -36,7 +38,7 @@ namespace CubbyFlow
 
 		BuildMarkers(source.GetDataSize(), pos, boundarySDF, fluidSDF);
 		BuildMatrix(source.GetDataSize(), c);
-		BuildVectors(source.GetConstDataAccessor(), c);
+		BuildVectors(source.GetConstDataAccessor(), c, &m_system.x, &m_system.b);
 
 		if (m_systemSolver != nullptr)
 		{
@@ -67,51 +69,29 @@ namespace CubbyFlow
 		BuildMarkers(source.GetDataSize(), pos, boundarySDF, fluidSDF);
 		BuildMatrix(source.GetDataSize(), c);
 
-		// u
-		BuildVectors(source.GetConstDataAccessor(), c, 0);
-
-		if (m_systemSolver != nullptr)
-		{
-			// Solve the system
-			m_systemSolver->Solve(&m_system);
-
-			// Assign the solution
-			source.ParallelForEachDataPointIndex(
-				[&](size_t i, size_t j, size_t k)
-			{
-				(*dest)(i, j, k).x = m_system.x(i, j, k);
-			});
-		}
-
-		// v
-		BuildVectors(source.GetConstDataAccessor(), c, 1);
+		// The components share the matrix, so they are solved together
+		m_multipleRHS.resize(3);
+		m_multipleSolutions.resize(3);
 
-		if (m_systemSolver != nullptr)
+		for (size_t component = 0; component < 3; ++component)
 		{
-			// Solve the system
-			m_systemSolver->Solve(&m_system);
-
-			// Assign the solution
-			source.ParallelForEachDataPointIndex(
-				[&](size_t i, size_t j, size_t k)
-			{
-				(*dest)(i, j, k).y = m_system.x(i, j, k);
-			});
+			BuildVectors(source.GetConstDataAccessor(), c, component,
+				&m_multipleSolutions[component], &m_multipleRHS[component]);
 		}
 
-		// w
-		BuildVectors(source.GetConstDataAccessor(), c, 2);
-
 		if (m_systemSolver != nullptr)
 		{
-			// Solve the system
-			m_systemSolver->Solve(&m_system);
+			// Solve the systems
+			SolveMultipleSystems(3);
 
 			// Assign the solution
 			source.ParallelForEachDataPointIndex(
 				[&](size_t i, size_t j, size_t k)
 			{
-				(*dest)(i, j, k).z = m_system.x(i, j, k);
+				(*dest)(i, j, k) = Vector3D(
+					m_multipleSolutions[0](i, j, k),
+					m_multipleSolutions[1](i, j, k),
+					m_multipleSolutions[2](i, j, k));
 			});
 		}
 	}
@@ -131,7 +111,7 @@ namespace CubbyFlow
 		auto uPos = source.GetUPosition();
 		BuildMarkers(source.GetUSize(), uPos, boundarySDF, fluidSDF);
 		BuildMatrix(source.GetUSize(), c);
-		BuildVectors(source.GetUConstAccessor(), c);
+		BuildVectors(source.GetUConstAccessor(), c, &m_system.x, &m_system.b);
 
 		if (m_systemSolver != nullptr)
 		{
@@ -150,7 +130,7 @@ namespace CubbyFlow
 		auto vPos = source.GetVPosition();
 		BuildMarkers(source.GetVSize(), vPos, boundarySDF, fluidSDF);
 		BuildMatrix(source.GetVSize(), c);
-		BuildVectors(source.GetVConstAccessor(), c);
+		BuildVectors(source.GetVConstAccessor(), c, &m_system.x, &m_system.b);
 
 		if (m_systemSolver != nullptr)
 		{
@@ -169,7 +149,7 @@ namespace CubbyFlow
 		auto wPos = source.GetWPosition();
 		BuildMarkers(source.GetWSize(), wPos, boundarySDF, fluidSDF);
 		BuildMatrix(source.GetWSize(), c);
-		BuildVectors(source.GetWConstAccessor(), c);
+		BuildVectors(source.GetWConstAccessor(), c, &m_system.x, &m_system.b);
 
 		if (m_systemSolver != nullptr)
 		{
@@ -185,6 +165,66 @@ namespace CubbyFlow
 		}
 	}
 
+	void GridBackwardEulerDiffusionSolver3::Solve(
+		const std::vector<const ScalarGrid3*>& sources,
+		double diffusionCoefficient,
+		double timeIntervalInSeconds,
+		const std::vector<ScalarGrid3*>& dests,
+		const ScalarField3& boundarySDF,
+		const ScalarField3& fluidSDF)
+	{
+		if (sources.empty())
+		{
+			return;
+		}
+
+		const ScalarGrid3& source = *sources[0];
+		const bool hasSameDataLayout = std::all_of(sources.begin(), sources.end(), [&](const ScalarGrid3* other)
+		{
+			return other->GetDataSize() == source.GetDataSize() &&
+				other->GetDataOrigin() == source.GetDataOrigin() &&
+				other->GridSpacing() == source.GridSpacing();
+		});
+
+		if (!hasSameDataLayout)
+		{
+			GridDiffusionSolver3::Solve(sources, diffusionCoefficient, timeIntervalInSeconds, dests, boundarySDF, fluidSDF);
+			return;
+		}
+
+		auto pos = source.GetDataPosition();
+		Vector3D h = source.GridSpacing();
+		Vector3D c = timeIntervalInSeconds * diffusionCoefficient / (h * h);
+
+		BuildMarkers(source.GetDataSize(), pos, boundarySDF, fluidSDF);
+		BuildMatrix(source.GetDataSize(), c);
+
+		const size_t numberOfSystems = sources.size();
+		m_multipleRHS.resize(numberOfSystems);
+		m_multipleSolutions.resize(numberOfSystems);
+
+		for (size_t n = 0; n < numberOfSystems; ++n)
+		{
+			BuildVectors(sources[n]->GetConstDataAccessor(), c, &m_multipleSolutions[n], &m_multipleRHS[n]);
+		}
+
+		if (m_systemSolver != nullptr)
+		{
+			// Solve the systems
+			SolveMultipleSystems(numberOfSystems);
+
+			// Assign the solutions
+			for (size_t n = 0; n < numberOfSystems; ++n)
+			{
+				source.ParallelForEachDataPointIndex(
+					[&](size_t i, size_t j, size_t k)
+				{
+					(*dests[n])(i, j, k) = m_multipleSolutions[n](i, j, k);
+				});
+			}
+		}
+	}
+
 	void GridBackwardEulerDiffusionSolver3::SetLinearSystemSolver(const FDMLinearSystemSolver3Ptr& Solver)
 	{
 		m_systemSolver = Solver;
@@ -289,97 +329,111 @@ namespace CubbyFlow
 		});
 	}
 
-	void GridBackwardEulerDiffusionSolver3::BuildVectors(const ConstArrayAccessor3<double>& f, const Vector3D& c)
+	void GridBackwardEulerDiffusionSolver3::BuildVectors(const ConstArrayAccessor3<double>& f, const Vector3D& c, FDMVector3* x, FDMVector3* b)
 	{
 		Size3 size = f.size();
 
-		m_system.x.Resize(size, 0.0);
-		m_system.b.Resize(size, 0.0);
+		x->Resize(size, 0.0);
+		b->Resize(size, 0.0);
 
 		// Build linear system
-		m_system.x.ParallelForEachIndex([&](size_t i, size_t j, size_t k)
+		x->ParallelForEachIndex([&](size_t i, size_t j, size_t k)
 		{
-			m_system.b(i, j, k) = m_system.x(i, j, k) = f(i, j, k);
+			(*b)(i, j, k) = (*x)(i, j, k) = f(i, j, k);
 
 			if (m_boundaryType == BoundaryType::Dirichlet && m_markers(i, j, k) == FLUID)
 			{
 				if (i + 1 < size.x && m_markers(i + 1, j, k) == BOUNDARY)
 				{
-					m_system.b(i, j, k) += c.x * f(i + 1, j, k);
+					(*b)(i, j, k) += c.x * f(i + 1, j, k);
 				}
 
 				if (i > 0 && m_markers(i - 1, j, k) == BOUNDARY)
 				{
-					m_system.b(i, j, k) += c.x * f(i - 1, j, k);
+					(*b)(i, j, k) += c.x * f(i - 1, j, k);
 				}
 
 				if (j + 1 < size.y && m_markers(i, j + 1, k) == BOUNDARY)
 				{
-					m_system.b(i, j, k) += c.y * f(i, j + 1, k);
+					(*b)(i, j, k) += c.y * f(i, j + 1, k);
 				}
 
 				if (j > 0 && m_markers(i, j - 1, k) == BOUNDARY)
 				{
-					m_system.b(i, j, k) += c.y * f(i, j - 1, k);
+					(*b)(i, j, k) += c.y * f(i, j - 1, k);
 				}
 
 				if (k + 1 < size.z && m_markers(i, j, k + 1) == BOUNDARY)
 				{
-					m_system.b(i, j, k) += c.z * f(i, j, k + 1);
+					(*b)(i, j, k) += c.z * f(i, j, k + 1);
 				}
 
 				if (k > 0 && m_markers(i, j, k - 1) == BOUNDARY)
 				{
-					m_system.b(i, j, k) += c.z * f(i, j, k - 1);
+					(*b)(i, j, k) += c.z * f(i, j, k - 1);
 				}
 			}
 		});
 	}
 
-	void GridBackwardEulerDiffusionSolver3::BuildVectors(const ConstArrayAccessor3<Vector3D>& f, const Vector3D& c, size_t component)
+	void GridBackwardEulerDiffusionSolver3::BuildVectors(const ConstArrayAccessor3<Vector3D>& f, const Vector3D& c, size_t component, FDMVector3* x, FDMVector3* b)
 	{
 		Size3 size = f.size();
 
-		m_system.x.Resize(size, 0.0);
-		m_system.b.Resize(size, 0.0);
+		x->Resize(size, 0.0);
+		b->Resize(size, 0.0);
 
 		// Build linear system
-		m_system.x.ParallelForEachIndex([&](size_t i, size_t j, size_t k)
+		x->ParallelForEachIndex([&](size_t i, size_t j, size_t k)
 		{
-			m_system.b(i, j, k) = m_system.x(i, j, k) = f(i, j, k)[component];
+			(*b)(i, j, k) = (*x)(i, j, k) = f(i, j, k)[component];
 
 			if (m_boundaryType == BoundaryType::Dirichlet && m_markers(i, j, k) == FLUID)
 			{
 				if (i + 1 < size.x && m_markers(i + 1, j, k) == BOUNDARY)
 				{
-					m_system.b(i, j, k) += c.x * f(i + 1, j, k)[component];
+					(*b)(i, j, k) += c.x * f(i + 1, j, k)[component];
 				}
 
 				if (i > 0 && m_markers(i - 1, j, k) == BOUNDARY)
 				{
-					m_system.b(i, j, k) += c.x * f(i - 1, j, k)[component];
+					(*b)(i, j, k) += c.x * f(i - 1, j, k)[component];
 				}
 
 				if (j + 1 < size.y && m_markers(i, j + 1, k) == BOUNDARY)
 				{
-					m_system.b(i, j, k) += c.y * f(i, j + 1, k)[component];
+					(*b)(i, j, k) += c.y * f(i, j + 1, k)[component];
 				}
 
 				if (j > 0 && m_markers(i, j - 1, k) == BOUNDARY)
 				{
-					m_system.b(i, j, k) += c.y * f(i, j - 1, k)[component];
+					(*b)(i, j, k) += c.y * f(i, j - 1, k)[component];
 				}
 
 				if (k + 1 < size.z && m_markers(i, j, k + 1) == BOUNDARY)
 				{
-					m_system.b(i, j, k) += c.z * f(i, j, k + 1)[component];
+					(*b)(i, j, k) += c.z * f(i, j, k + 1)[component];
 				}
 
 				if (k > 0 && m_markers(i, j, k - 1) == BOUNDARY)
 				{
-					m_system.b(i, j, k) += c.z * f(i, j, k - 1)[component];
+					(*b)(i, j, k) += c.z * f(i, j, k - 1)[component];
 				}
 			}
 		});
 	}
+
+	void GridBackwardEulerDiffusionSolver3::SolveMultipleSystems(size_t numberOfSystems)
+	{
+		std::vector<const FDMVector3*> rhs;
+		std::vector<FDMVector3*> solutions;
+
+		for (size_t n = 0; n < numberOfSystems; ++n)
+		{
+			rhs.push_back(&m_multipleRHS[n]);
+			solutions.push_back(&m_multipleSolutions[n]);
+		}
+
+		m_systemSolver->SolveMultiple(&m_system, rhs, solutions);
+	}
 }
\ No newline at end of file
@@ -19,4 +19,18 @@ namespace CubbyFlow
 	{
 		// Do nothing
 	}
+
+	void GridDiffusionSolver3::Solve(
+		const std::vector<const ScalarGrid3*>& sources,
+		double diffusionCoefficient,
+		double timeIntervalInSeconds,
+		const std::vector<ScalarGrid3*>& dests,
+		const ScalarField3& boundarySDF,
+		const ScalarField3& fluidSDF)
+	{
+		for (size_t n = 0; n < sources.size(); ++n)
+		{
+			Solve(*sources[n], diffusionCoefficient, timeIntervalInSeconds, dests[n], boundarySDF, fluidSDF);
+		}
+	}
 }
\ No newline at end of file
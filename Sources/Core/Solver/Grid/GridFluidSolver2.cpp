@@ -70,8 +70,7 @@ namespace CubbyFlow
 		vel->ForEachCellIndex([&](size_t i, size_t j)
 		{
 			Vector2D v = vel->ValueAtCellCenter(i, j) + timeIntervalInSeconds * m_gravity;
-			maxVel = std::max(maxVel, v.x);
-			maxVel = std::max(maxVel, v.y);
+			maxVel = std::max(maxVel, std::fabs(v.AbsMax()));
 		});
 
 		Vector2D gridSpacing = m_grids->GetGridSpacing();
@@ -269,8 +268,11 @@ namespace CubbyFlow
 	{
 		if (m_diffusionSolver != nullptr && m_viscosityCoefficient > std::numeric_limits<double>::epsilon())
 		{
+			// The diffusion solver may leave some faces untouched, so it reads
+			// from a copy in the back buffer
 			auto vel = GetVelocity();
-			auto vel0 = std::dynamic_pointer_cast<FaceCenteredGrid2>(vel->Clone());
+			auto vel0 = m_grids->GetVelocityBackBuffer();
+			vel0->Set(*vel);
 
 			m_diffusionSolver->Solve(
 				*vel0,
@@ -287,8 +289,11 @@ namespace CubbyFlow
 	{
 		if (m_pressureSolver != nullptr)
 		{
+			// The pressure gradient is only applied to the faces next to the
+			// fluid, so the solver reads from a copy in the back buffer
 			auto vel = GetVelocity();
-			auto vel0 = std::dynamic_pointer_cast<FaceCenteredGrid2>(vel->Clone());
+			auto vel0 = m_grids->GetVelocityBackBuffer();
+			vel0->Set(*vel);
 
 			m_pressureSolver->Solve(
 				*vel0,
@@ -312,15 +317,17 @@ namespace CubbyFlow
 
 			for (size_t i = 0; i < n; ++i)
 			{
+				// Advect into the back buffer and swap
 				auto grid = m_grids->GetAdvectableScalarDataAt(i);
-				auto grid0 = grid->Clone();
+				auto grid1 = m_grids->GetAdvectableScalarDataBackBufferAt(i);
 
 				m_advectionSolver->Advect(
-					*grid0,
+					*grid,
 					*vel,
 					timeIntervalInSeconds,
-					grid.get(),
+					grid1.get(),
 					*GetColliderSDF());
+				grid->Swap(grid1.get());
 				ExtrapolateIntoCollider(grid.get());
 			}
 
@@ -336,48 +343,52 @@ namespace CubbyFlow
 					continue;
 				}
 
+				// Advect into the back buffer and swap
 				auto grid = m_grids->GetAdvectableVectorDataAt(i);
-				auto grid0 = grid->Clone();
+				auto grid1 = m_grids->GetAdvectableVectorDataBackBufferAt(i);
 
 				auto collocated = std::dynamic_pointer_cast<CollocatedVectorGrid2>(grid);
-				auto collocated0 = std::dynamic_pointer_cast<CollocatedVectorGrid2>(grid0);
-				
-				if (collocated != nullptr)
+				auto collocated1 = std::dynamic_pointer_cast<CollocatedVectorGrid2>(grid1);
+
+				if (collocated != nullptr && collocated1 != nullptr)
 				{
 					m_advectionSolver->Advect(
-						*collocated0,
+						*collocated,
 						*vel,
 						timeIntervalInSeconds,
-						collocated.get(),
+						collocated1.get(),
 						*GetColliderSDF());
+					collocated->Swap(collocated1.get());
 					ExtrapolateIntoCollider(collocated.get());
 					continue;
 				}
 
 				auto faceCentered = std::dynamic_pointer_cast<FaceCenteredGrid2>(grid);
-				auto faceCentered0 = std::dynamic_pointer_cast<FaceCenteredGrid2>(grid0);
-				
-				if (faceCentered != nullptr && faceCentered0 != nullptr)
+				auto faceCentered1 = std::dynamic_pointer_cast<FaceCenteredGrid2>(grid1);
+
+				if (faceCentered != nullptr && faceCentered1 != nullptr)
 				{
 					m_advectionSolver->Advect(
-						*faceCentered0,
+						*faceCentered,
 						*vel,
 						timeIntervalInSeconds,
-						faceCentered.get(),
+						faceCentered1.get(),
 						*GetColliderSDF());
+					faceCentered->Swap(faceCentered1.get());
 					ExtrapolateIntoCollider(faceCentered.get());
 				}
 			}
 
 			// Solve velocity advection
-			auto vel0 = std::dynamic_pointer_cast<FaceCenteredGrid2>(vel->Clone());
+			auto vel1 = m_grids->GetVelocityBackBuffer();
 
 			m_advectionSolver->Advect(
-				*vel0,
-				*vel0,
+				*vel,
+				*vel,
 				timeIntervalInSeconds,
-				vel.get(),
+				vel1.get(),
 				*GetColliderSDF());
+			vel->Swap(vel1.get());
 			ApplyBoundaryCondition();
 		}
 	}
@@ -13,8 +13,11 @@
 #include <Core/Solver/Grid/GridFractionalSinglePhasePressureSolver3.h>
 #include <Core/Solver/Grid/GridFluidSolver3.h>
 #include <Core/Utils/Logging.h>
+#include <Core/Utils/Parallel.h>
 #include <Core/Utils/Timer.h>
 
+#include <numeric>
+
 namespace CubbyFlow
 {
 	GridFluidSolver3::GridFluidSolver3() :
@@ -65,14 +68,30 @@ namespace CubbyFlow
 	double GridFluidSolver3::GetCFL(double timeIntervalInSeconds) const
 	{
 		auto vel = m_grids->GetVelocity();
-		double maxVel = 0.0;
+		const Size3 res = vel->Resolution();
+		const double& (*_max)(const double&, const double&) = std::max<double>;
 
-		vel->ForEachCellIndex([&](size_t i, size_t j, size_t k)
+		// Reduce the max velocity over the z-slices in parallel
+		const double maxVel = ParallelReduce(ZERO_SIZE, res.z, 0.0,
+			[&](size_t kBegin, size_t kEnd, double init)
 		{
-			Vector3D v = vel->ValueAtCellCenter(i, j, k) + timeIntervalInSeconds * m_gravity;
-			maxVel = std::max(maxVel, v.Max());
-		});
-		
+			double result = init;
+
+			for (size_t k = kBegin; k < kEnd; ++k)
+			{
+				for (size_t j = 0; j < res.y; ++j)
+				{
+					for (size_t i = 0; i < res.x; ++i)
+					{
+						Vector3D v = vel->ValueAtCellCenter(i, j, k) + timeIntervalInSeconds * m_gravity;
+						result = std::max(result, std::fabs(v.AbsMax()));
+					}
+				}
+			}
+
+			return result;
+		}, _max);
+
 		Vector3D gridSpacing = m_grids->GetGridSpacing();
 		double minGridSize = gridSpacing.Min();
 
@@ -270,8 +289,11 @@ namespace CubbyFlow
 	{
 		if (m_diffusionSolver != nullptr && m_viscosityCoefficient > std::numeric_limits<double>::epsilon())
 		{
+			// The diffusion solver may leave some faces untouched, so it reads
+			// from a copy in the back buffer
 			auto vel = GetVelocity();
-			auto vel0 = std::dynamic_pointer_cast<FaceCenteredGrid3>(vel->Clone());
+			auto vel0 = m_grids->GetVelocityBackBuffer();
+			vel0->Set(*vel);
 
 			m_diffusionSolver->Solve(
 				*vel0,
@@ -288,8 +310,11 @@ namespace CubbyFlow
 	{
 		if (m_pressureSolver != nullptr)
 		{
+			// The pressure gradient is only applied to the faces next to the
+			// fluid, so the solver reads from a copy in the back buffer
 			auto vel = GetVelocity();
-			auto vel0 = std::dynamic_pointer_cast<FaceCenteredGrid3>(vel->Clone());
+			auto vel0 = m_grids->GetVelocityBackBuffer();
+			vel0->Set(*vel);
 
 			m_pressureSolver->Solve(
 				*vel0,
@@ -310,25 +335,19 @@ namespace CubbyFlow
 		{
 			// Solve advections for custom scalar fields.
 			size_t n = m_grids->GetNumberOfAdvectableScalarData();
+			std::vector<size_t> scalarIndices(n);
+			std::iota(scalarIndices.begin(), scalarIndices.end(), ZERO_SIZE);
 
-			for (size_t i = 0; i < n; ++i)
-			{
-				auto grid = m_grids->GetAdvectableScalarDataAt(i);
-				auto grid0 = grid->Clone();
+			ComputeScalarDataAdvection(scalarIndices, timeIntervalInSeconds);
 
-				m_advectionSolver->Advect(
-					*grid0,
-					*vel,
-					timeIntervalInSeconds,
-					grid.get(),
-					*GetColliderSDF());
-				ExtrapolateIntoCollider(grid.get());
-			}
-
-			// Solve advections for custom vector fields.
+			// Solve advections for custom vector fields. The collocated grids
+			// are advected together so that they share the departure points.
 			n = m_grids->GetNumberOfAdvectableVectorData();
 			size_t velIdx = m_grids->GetVelocityIndex();
 
+			std::vector<CollocatedVectorGrid3Ptr> collocatedGrids;
+			std::vector<CollocatedVectorGrid3Ptr> collocatedGrids1;
+
 			for (size_t i = 0; i < n; ++i)
 			{
 				// Handle velocity layer separately.
@@ -337,52 +356,107 @@ namespace CubbyFlow
 					continue;
 				}
 
+				// Advect into the back buffer and swap
 				auto grid = m_grids->GetAdvectableVectorDataAt(i);
-				auto grid0 = grid->Clone();
+				auto grid1 = m_grids->GetAdvectableVectorDataBackBufferAt(i);
 
 				auto collocated = std::dynamic_pointer_cast<CollocatedVectorGrid3>(grid);
-				auto collocated0 = std::dynamic_pointer_cast<CollocatedVectorGrid3>(grid0);
+				auto collocated1 = std::dynamic_pointer_cast<CollocatedVectorGrid3>(grid1);
 
-				if (collocated != nullptr)
+				if (collocated != nullptr && collocated1 != nullptr)
 				{
-					m_advectionSolver->Advect(
-						*collocated0,
-						*vel,
-						timeIntervalInSeconds,
-						collocated.get(),
-						*GetColliderSDF());
-					ExtrapolateIntoCollider(collocated.get());
+					collocatedGrids.push_back(collocated);
+					collocatedGrids1.push_back(collocated1);
 					continue;
 				}
 
 				auto faceCentered = std::dynamic_pointer_cast<FaceCenteredGrid3>(grid);
-				auto faceCentered0 = std::dynamic_pointer_cast<FaceCenteredGrid3>(grid0);
+				auto faceCentered1 = std::dynamic_pointer_cast<FaceCenteredGrid3>(grid1);
 
-				if (faceCentered != nullptr && faceCentered0 != nullptr)
+				if (faceCentered != nullptr && faceCentered1 != nullptr)
 				{
 					m_advectionSolver->Advect(
-						*faceCentered0,
+						*faceCentered,
 						*vel,
 						timeIntervalInSeconds,
-						faceCentered.get(),
+						faceCentered1.get(),
 						*GetColliderSDF());
+					faceCentered->Swap(faceCentered1.get());
 					ExtrapolateIntoCollider(faceCentered.get());
 				}
 			}
 
+			if (!collocatedGrids.empty())
+			{
+				std::vector<const CollocatedVectorGrid3*> inputs;
+				std::vector<CollocatedVectorGrid3*> outputs;
+
+				for (size_t i = 0; i < collocatedGrids.size(); ++i)
+				{
+					inputs.push_back(collocatedGrids[i].get());
+					outputs.push_back(collocatedGrids1[i].get());
+				}
+
+				m_advectionSolver->Advect(
+					inputs,
+					*vel,
+					timeIntervalInSeconds,
+					outputs,
+					*GetColliderSDF());
+
+				for (size_t i = 0; i < collocatedGrids.size(); ++i)
+				{
+					collocatedGrids[i]->Swap(collocatedGrids1[i].get());
+					ExtrapolateIntoCollider(collocatedGrids[i].get());
+				}
+			}
+
 			// Solve velocity advection
-			auto vel0 = std::dynamic_pointer_cast<FaceCenteredGrid3>(vel->Clone());
+			auto vel1 = m_grids->GetVelocityBackBuffer();
 
 			m_advectionSolver->Advect(
-				*vel0,
-				*vel0,
+				*vel,
+				*vel,
 				timeIntervalInSeconds,
-				vel.get(),
+				vel1.get(),
 				*GetColliderSDF());
+			vel->Swap(vel1.get());
 			ApplyBoundaryCondition();
 		}
 	}
 
+	void GridFluidSolver3::ComputeScalarDataAdvection(const std::vector<size_t>& indices, double timeIntervalInSeconds)
+	{
+		if (indices.empty())
+		{
+			return;
+		}
+
+		// Advect into the back buffers in a single pass and swap
+		std::vector<const ScalarGrid3*> inputs;
+		std::vector<ScalarGrid3*> outputs;
+
+		for (size_t index : indices)
+		{
+			inputs.push_back(m_grids->GetAdvectableScalarDataAt(index).get());
+			outputs.push_back(m_grids->GetAdvectableScalarDataBackBufferAt(index).get());
+		}
+
+		m_advectionSolver->Advect(
+			inputs,
+			*GetVelocity(),
+			timeIntervalInSeconds,
+			outputs,
+			*GetColliderSDF());
+
+		for (size_t index : indices)
+		{
+			auto grid = m_grids->GetAdvectableScalarDataAt(index);
+			grid->Swap(m_grids->GetAdvectableScalarDataBackBufferAt(index).get());
+			ExtrapolateIntoCollider(grid.get());
+		}
+	}
+
 	ScalarField3Ptr GridFluidSolver3::GetFluidSDF() const
 	{
 		return std::make_shared<ConstantScalarField3>(-std::numeric_limits<double>::max());
@@ -7,14 +7,60 @@
 > Copyright (c) 2018, Chan-Ho Chris Ohk
 *************************************************************************/
 #include <Core/Array/ArrayUtils.h>
+#include <Core/Collider/ColliderSet3.h>
 #include <Core/LevelSet/LevelSetUtils.h>
 #include <Core/Solver/Grid/GridFractionalBoundaryConditionSolver3.h>
 #include <Core/Surface/ImplicitSurface3.h>
 #include <Core/Surface/SurfaceToImplicit3.h>
+#include <Core/Utils/Parallel.h>
 #include <Core/Utils/PhysicsHelpers.h>
 
 namespace CubbyFlow
 {
+	namespace
+	{
+		// Flattens collider sets so that each part keeps its own SDF cache.
+		void GatherColliders(const Collider3Ptr& collider, std::vector<Collider3Ptr>* colliders)
+		{
+			ColliderSet3Ptr colliderSet = std::dynamic_pointer_cast<ColliderSet3>(collider);
+
+			if (colliderSet == nullptr)
+			{
+				colliders->push_back(collider);
+				return;
+			}
+
+			for (size_t i = 0; i < colliderSet->NumberOfColliders(); ++i)
+			{
+				GatherColliders(colliderSet->Collider(i), colliders);
+			}
+		}
+
+		// Returns the range of cells whose centers are inside of the box.
+		void GetCellRange(
+			const BoundingBox3D& box, const CellCenteredScalarGrid3& grid,
+			Size3* lowerIndex, Size3* upperIndex)
+		{
+			const Size3 res = grid.Resolution();
+			const Vector3D lower = (box.lowerCorner - grid.Origin()) / grid.GridSpacing() - Vector3D(0.5, 0.5, 0.5);
+			const Vector3D upper = (box.upperCorner - grid.Origin()) / grid.GridSpacing() - Vector3D(0.5, 0.5, 0.5);
+
+			auto toIndex = [](double x, size_t n)
+			{
+				return static_cast<size_t>(std::clamp(x, 0.0, static_cast<double>(n)));
+			};
+
+			*lowerIndex = Size3(
+				toIndex(std::floor(lower.x), res.x),
+				toIndex(std::floor(lower.y), res.y),
+				toIndex(std::floor(lower.z), res.z));
+			*upperIndex = Size3(
+				toIndex(std::ceil(upper.x) + 1.0, res.x),
+				toIndex(std::ceil(upper.y) + 1.0, res.y),
+				toIndex(std::ceil(upper.z) + 1.0, res.z));
+		}
+	}
+
 	GridFractionalBoundaryConditionSolver3::GridFractionalBoundaryConditionSolver3()
 	{
 		// Do nothing
@@ -304,21 +350,34 @@ namespace CubbyFlow
 			m_colliderSDF = std::make_shared<CellCenteredScalarGrid3>();
 		}
 
-		m_colliderSDF->Resize(gridSize, gridSpacing, gridOrigin);
+		const bool isResized =
+			m_colliderSDF->Resolution() != gridSize ||
+			m_colliderSDF->GridSpacing() != gridSpacing ||
+			m_colliderSDF->Origin() != gridOrigin;
+
+		if (isResized)
+		{
+			m_colliderSDF->Resize(gridSize, gridSpacing, gridOrigin);
+		}
 
 		if (GetCollider() != nullptr)
 		{
-			Surface3Ptr surface = GetCollider()->GetSurface();
-			ImplicitSurface3Ptr implicitSurface = std::dynamic_pointer_cast<ImplicitSurface3>(surface);
-			if (implicitSurface == nullptr)
+			if (!UpdateColliderSDFFromCache(isResized))
 			{
-				implicitSurface = std::make_shared<SurfaceToImplicit3>(surface);
-			}
+				m_cachedColliderStates.clear();
 
-			m_colliderSDF->Fill([&](const Vector3D& pt)
-			{
-				return implicitSurface->SignedDistance(pt);
-			});
+				Surface3Ptr surface = GetCollider()->GetSurface();
+				ImplicitSurface3Ptr implicitSurface = std::dynamic_pointer_cast<ImplicitSurface3>(surface);
+				if (implicitSurface == nullptr)
+				{
+					implicitSurface = std::make_shared<SurfaceToImplicit3>(surface);
+				}
+
+				m_colliderSDF->Fill([&](const Vector3D& pt)
+				{
+					return implicitSurface->SignedDistance(pt);
+				}, ExecutionPolicy::Parallel);
+			}
 
 			m_colliderVel = CustomVectorField3::Builder()
 				.WithFunction([&](const Vector3D& x)
@@ -330,6 +389,7 @@ namespace CubbyFlow
 		}
 		else
 		{
+			m_cachedColliderStates.clear();
 			m_colliderSDF->Fill(std::numeric_limits<double>::max());
 
 			m_colliderVel = CustomVectorField3::Builder()
@@ -341,4 +401,91 @@ namespace CubbyFlow
 				.MakeShared();
 		}
 	}
-}
\ No newline at end of file
+
+	bool GridFractionalBoundaryConditionSolver3::UpdateColliderSDFFromCache(bool isResized)
+	{
+		std::vector<Collider3Ptr> colliders;
+		GatherColliders(GetCollider(), &colliders);
+
+		std::vector<CachedColliderState> states(colliders.size());
+		for (size_t i = 0; i < colliders.size(); ++i)
+		{
+			CachedColliderState& state = states[i];
+			state.collider = colliders[i];
+			state.localSDF = state.collider->GetLocalSDF(m_colliderSDF->GridSpacing());
+
+			if (state.localSDF == nullptr)
+			{
+				return false;
+			}
+
+			state.transform = state.collider->GetSurface()->transform;
+			GetCellRange(state.transform.ToWorld(state.localSDF->BoundingBox()), *m_colliderSDF, &state.lowerIndex, &state.upperIndex);
+		}
+
+		bool isIncremental = !isResized && states.size() == m_cachedColliderStates.size();
+		for (size_t i = 0; isIncremental && i < states.size(); ++i)
+		{
+			isIncremental =
+				states[i].collider == m_cachedColliderStates[i].collider &&
+				states[i].localSDF == m_cachedColliderStates[i].localSDF;
+		}
+
+		std::swap(states, m_cachedColliderStates);
+
+		if (isIncremental)
+		{
+			// Only the cells a moved collider has left or entered can change
+			for (size_t i = 0; i < m_cachedColliderStates.size(); ++i)
+			{
+				const CachedColliderState& prev = states[i];
+				const CachedColliderState& curr = m_cachedColliderStates[i];
+
+				if (prev.transform.GetTranslation() != curr.transform.GetTranslation() ||
+					prev.transform.GetOrientation() != curr.transform.GetOrientation())
+				{
+					UpdateColliderSDFRegion(prev.lowerIndex, prev.upperIndex);
+					UpdateColliderSDFRegion(curr.lowerIndex, curr.upperIndex);
+				}
+			}
+		}
+		else
+		{
+			UpdateColliderSDFRegion(Size3(0, 0, 0), m_colliderSDF->Resolution());
+		}
+
+		return true;
+	}
+
+	void GridFractionalBoundaryConditionSolver3::UpdateColliderSDFRegion(const Size3& lowerIndex, const Size3& upperIndex)
+	{
+		auto sdf = m_colliderSDF->GetDataAccessor();
+		auto pos = m_colliderSDF->GetDataPosition();
+
+		ParallelFor(
+			lowerIndex.x, upperIndex.x,
+			lowerIndex.y, upperIndex.y,
+			lowerIndex.z, upperIndex.z,
+			[&](size_t i, size_t j, size_t k)
+		{
+			const Vector3D pt = pos(i, j, k);
+			double phi = std::numeric_limits<double>::max();
+
+			for (const CachedColliderState& state : m_cachedColliderStates)
+			{
+				const Vector3D localPt = state.transform.ToLocal(pt);
+
+				if (state.localSDF->BoundingBox().Contains(localPt))
+				{
+					phi = std::min(phi, state.localSDF->Sample(localPt));
+				}
+				else
+				{
+					phi = std::min(phi, state.collider->GetLocalSDFFarValue(pt));
+				}
+			}
+
+			sdf(i, j, k) = phi;
+		});
+	}
+}
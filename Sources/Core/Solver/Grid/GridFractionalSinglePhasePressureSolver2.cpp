@@ -249,6 +249,7 @@ namespace CubbyFlow
 		}
 
 		void BuildSingleSystem(MatrixCSRD* A, VectorND* x, VectorND* b,
+			std::vector<std::vector<size_t>>* colors,
 			const Array2<float>& fluidSDF,
 			const Array2<float>& uWeights,
 			const Array2<float>& vWeights,
@@ -267,6 +268,10 @@ namespace CubbyFlow
 			A->Clear();
 			b->Clear();
 
+			// Red-black ordering of the 5-point stencil, which lets the
+			// compressed system be relaxed in parallel
+			colors->assign(2, std::vector<size_t>());
+
 			size_t numRows = 0;
 			Array2<size_t> coordToIndex(size);
 			fluidSDF.ForEachIndex([&](size_t i, size_t j)
@@ -276,6 +281,7 @@ namespace CubbyFlow
 
 				if (IsInsideSDF(centerPhi))
 				{
+					(*colors)[(i + j) % 2].push_back(numRows);
 					coordToIndex[cIdx] = numRows++;
 				}
 			});
@@ -642,7 +648,7 @@ namespace CubbyFlow
 			if (useCompressed)
 			{
 				BuildSingleSystem(
-					&m_compSystem.A, &m_compSystem.x, &m_compSystem.b,
+					&m_compSystem.A, &m_compSystem.x, &m_compSystem.b, &m_compSystem.colors,
 					m_fluidSDF[0], m_uWeights[0], m_vWeights[0],
 					m_boundaryVel, *finer);
 			}
@@ -15,15 +15,27 @@
 //
 
 #include <Core/LevelSet/LevelSetUtils.h>
-#include <Core/Solver/FDM/FDMICCGSolver3.h>
+#include <Core/Solver/FDM/FDMAMGPCGSolver3.h>
 #include <Core/Solver/Grid/GridFractionalBoundaryConditionSolver3.h>
 #include <Core/Solver/Grid/GridFractionalSinglePhasePressureSolver3.h>
+#include <Core/Utils/Parallel.h>
+
+#include <array>
+#include <functional>
+#include <numeric>
 
 namespace CubbyFlow
 {
 	const double DEFAULT_TOLERANCE = 1e-6;
 	const double MIN_WEIGHT = 0.01;
 
+	// Row index of the cells which are not in the compressed system
+	const size_t UNASSIGNED_ROW = std::numeric_limits<size_t>::max();
+
+	// Ratio of the stale (identity or appended) rows to all rows of the
+	// compressed system above which the rows are renumbered from scratch
+	const double MAX_STALE_ROW_RATIO = 0.1;
+
 	namespace
 	{
 		void Restrict(const Array3<float>& finer, Array3<float>* coarser)
@@ -323,15 +335,22 @@ namespace CubbyFlow
 			});
 		}
 
-		void BuildSingleSystem(MatrixCSRD* A, VectorND* x, VectorND* b,
+		//
+		// Computes the row of the compressed system at fluid cell (i, j, k).
+		// coefficients[0] is the diagonal and coefficients[1..6] are the
+		// (+x, -x, +y, -y, +z, -z) neighbors, which are zero if the neighbor is
+		// not fluid. Returns the right-hand side of the row.
+		//
+		double BuildCompressedRow(size_t i, size_t j, size_t k,
 			const Array3<float>& fluidSDF,
 			const Array3<float>& uWeights,
 			const Array3<float>& vWeights,
 			const Array3<float>& wWeights,
-			std::function<Vector3D(const Vector3D&)> boundaryVel,
-			const FaceCenteredGrid3& input)
+			const std::function<Vector3D(const Vector3D&)>& boundaryVel,
+			const FaceCenteredGrid3& input,
+			std::array<double, 7>* coefficients)
 		{
-			const Size3 size = input.Resolution();
+			const Size3 size = fluidSDF.size();
 			const auto uPos = input.GetUPosition();
 			const auto vPos = input.GetVPosition();
 			const auto wPos = input.GetWPosition();
@@ -339,217 +358,111 @@ namespace CubbyFlow
 			const Vector3D invH = 1.0 / input.GridSpacing();
 			const Vector3D invHSqr = invH * invH;
 
-			const auto fluidSDFAcc = fluidSDF.ConstAccessor();
+			const double centerPhi = fluidSDF(i, j, k);
+			std::array<double, 7>& row = *coefficients;
+			row.fill(0.0);
 
-			A->Clear();
-			b->Clear();
+			double bijk = 0.0;
 
-			size_t numRows = 0;
-			Array3<size_t> coordToIndex(size);
-			fluidSDF.ForEachIndex([&](size_t i, size_t j, size_t k)
+			auto addNeighbor = [&](size_t n, double term, double neighborPhi)
 			{
-				const size_t cIdx = fluidSDFAcc.Index(i, j, k);
-				const double centerPhi = fluidSDF[cIdx];
-
-				if (IsInsideSDF(centerPhi))
+				if (IsInsideSDF(neighborPhi))
 				{
-					coordToIndex[cIdx] = numRows++;
+					row[0] += term;
+					row[n] = -term;
 				}
-			});
-
-			fluidSDF.ForEachIndex([&](size_t i, size_t j, size_t k)
-			{
-				const size_t cIdx = fluidSDFAcc.Index(i, j, k);
-				const double centerPhi = fluidSDF[cIdx];
-
-				if (IsInsideSDF(centerPhi))
+				else
 				{
-					double bijk = 0.0;
-
-					std::vector<double> row(1, 0.0);
-					std::vector<size_t> colIdx(1, coordToIndex[cIdx]);
-
-					double term;
-
-					if (i + 1 < size.x)
-					{
-						term = uWeights(i + 1, j, k) * invHSqr.x;
-						const double rightPhi = fluidSDF(i + 1, j, k);
-						
-						if (IsInsideSDF(rightPhi))
-						{
-							row[0] += term;
-							row.push_back(-term);
-							colIdx.push_back(coordToIndex(i + 1, j, k));
-						}
-						else 
-						{
-							double theta = FractionInsideSDF(centerPhi, rightPhi);
-							theta = std::max(theta, 0.01);
-							row[0] += term / theta;
-						}
-						
-						bijk += uWeights(i + 1, j, k) * input.GetU(i + 1, j, k) * invH.x;
-					}
-					else
-					{
-						bijk += input.GetU(i + 1, j, k) * invH.x;
-					}
-
-					if (i > 0)
-					{
-						term = uWeights(i, j, k) * invHSqr.x;
-						const double leftPhi = fluidSDF(i - 1, j, k);
-						
-						if (IsInsideSDF(leftPhi))
-						{
-							row[0] += term;
-							row.push_back(-term);
-							colIdx.push_back(coordToIndex(i - 1, j, k));
-						}
-						else
-						{
-							double theta = FractionInsideSDF(centerPhi, leftPhi);
-							theta = std::max(theta, 0.01);
-							row[0] += term / theta;
-						}
-
-						bijk -= uWeights(i, j, k) * input.GetU(i, j, k) * invH.x;
-					}
-					else
-					{
-						bijk -= input.GetU(i, j, k) * invH.x;
-					}
-
-					if (j + 1 < size.y)
-					{
-						term = vWeights(i, j + 1, k) * invHSqr.y;
-						const double upPhi = fluidSDF(i, j + 1, k);
-
-						if (IsInsideSDF(upPhi))
-						{
-							row[0] += term;
-							row.push_back(-term);
-							colIdx.push_back(coordToIndex(i, j + 1, k));
-						}
-						else
-						{
-							double theta = FractionInsideSDF(centerPhi, upPhi);
-							theta = std::max(theta, 0.01);
-							row[0] += term / theta;
-						}
-						
-						bijk += vWeights(i, j + 1, k) * input.GetV(i, j + 1, k) * invH.y;
-					}
-					else
-					{
-						bijk += input.GetV(i, j + 1, k) * invH.y;
-					}
-
-					if (j > 0)
-					{
-						term = vWeights(i, j, k) * invHSqr.y;
-						const double downPhi = fluidSDF(i, j - 1, k);
-						
-						if (IsInsideSDF(downPhi))
-						{
-							row[0] += term;
-							row.push_back(-term);
-							colIdx.push_back(coordToIndex(i, j - 1, k));
-						}
-						else
-						{
-							double theta = FractionInsideSDF(centerPhi, downPhi);
-							theta = std::max(theta, 0.01);
-							row[0] += term / theta;
-						}
-
-						bijk -= vWeights(i, j, k) * input.GetV(i, j, k) * invH.y;
-					}
-					else
-					{
-						bijk -= input.GetV(i, j, k) * invH.y;
-					}
+					double theta = FractionInsideSDF(centerPhi, neighborPhi);
+					theta = std::max(theta, 0.01);
+					row[0] += term / theta;
+				}
+			};
 
-					if (k + 1 < size.z)
-					{
-						term = wWeights(i, j, k + 1) * invHSqr.z;
-						const double frontPhi = fluidSDF(i, j, k + 1);
-						
-						if (IsInsideSDF(frontPhi))
-						{
-							row[0] += term;
-							row.push_back(-term);
-							colIdx.push_back(coordToIndex(i, j, k + 1));
-						}
-						else
-						{
-							double theta = FractionInsideSDF(centerPhi, frontPhi);
-							theta = std::max(theta, 0.01);
-							row[0] += term / theta;
-						}
+			if (i + 1 < size.x)
+			{
+				addNeighbor(1, uWeights(i + 1, j, k) * invHSqr.x, fluidSDF(i + 1, j, k));
+				bijk += uWeights(i + 1, j, k) * input.GetU(i + 1, j, k) * invH.x;
+			}
+			else
+			{
+				bijk += input.GetU(i + 1, j, k) * invH.x;
+			}
 
-						bijk += wWeights(i, j, k + 1) * input.GetW(i, j, k + 1) * invH.z;
-					}
-					else
-					{
-						bijk += input.GetW(i, j, k + 1) * invH.z;
-					}
+			if (i > 0)
+			{
+				addNeighbor(2, uWeights(i, j, k) * invHSqr.x, fluidSDF(i - 1, j, k));
+				bijk -= uWeights(i, j, k) * input.GetU(i, j, k) * invH.x;
+			}
+			else
+			{
+				bijk -= input.GetU(i, j, k) * invH.x;
+			}
 
-					if (k > 0) 
-					{
-						term = wWeights(i, j, k) * invHSqr.z;
-						const double backPhi = fluidSDF(i, j, k - 1);
-						
-						if (IsInsideSDF(backPhi))
-						{
-							row[0] += term;
-							row.push_back(-term);
-							colIdx.push_back(coordToIndex(i, j, k - 1));
-						}
-						else
-						{
-							double theta = FractionInsideSDF(centerPhi, backPhi);
-							theta = std::max(theta, 0.01);
-							row[0] += term / theta;
-						}
+			if (j + 1 < size.y)
+			{
+				addNeighbor(3, vWeights(i, j + 1, k) * invHSqr.y, fluidSDF(i, j + 1, k));
+				bijk += vWeights(i, j + 1, k) * input.GetV(i, j + 1, k) * invH.y;
+			}
+			else
+			{
+				bijk += input.GetV(i, j + 1, k) * invH.y;
+			}
 
-						bijk -= wWeights(i, j, k) * input.GetW(i, j, k) * invH.z;
-					}
-					else
-					{
-						bijk -= input.GetW(i, j, k) * invH.z;
-					}
+			if (j > 0)
+			{
+				addNeighbor(4, vWeights(i, j, k) * invHSqr.y, fluidSDF(i, j - 1, k));
+				bijk -= vWeights(i, j, k) * input.GetV(i, j, k) * invH.y;
+			}
+			else
+			{
+				bijk -= input.GetV(i, j, k) * invH.y;
+			}
 
-					// Accumulate contributions from the moving boundary
-					double boundaryContribution =
-						(1.0 - uWeights(i + 1, j, k)) * boundaryVel(uPos(i + 1, j, k)).x * invH.x -
-						(1.0 - uWeights(i, j, k)) * boundaryVel(uPos(i, j, k)).x * invH.x +
-						(1.0 - vWeights(i, j + 1, k)) * boundaryVel(vPos(i, j + 1, k)).y * invH.y -
-						(1.0 - vWeights(i, j, k)) * boundaryVel(vPos(i, j, k)).y * invH.y +
-						(1.0 - wWeights(i, j, k + 1)) * boundaryVel(wPos(i, j, k + 1)).z * invH.z -
-						(1.0 - wWeights(i, j, k)) * boundaryVel(wPos(i, j, k)).z * invH.z;
-					bijk += boundaryContribution;
+			if (k + 1 < size.z)
+			{
+				addNeighbor(5, wWeights(i, j, k + 1) * invHSqr.z, fluidSDF(i, j, k + 1));
+				bijk += wWeights(i, j, k + 1) * input.GetW(i, j, k + 1) * invH.z;
+			}
+			else
+			{
+				bijk += input.GetW(i, j, k + 1) * invH.z;
+			}
 
-					// If row.center is near-zero, the cell is likely inside a solid boundary.
-					if (row[0] < std::numeric_limits<double>::epsilon())
-					{
-						row[0] = 1.0;
-						bijk = 0.0;
-					}
+			if (k > 0)
+			{
+				addNeighbor(6, wWeights(i, j, k) * invHSqr.z, fluidSDF(i, j, k - 1));
+				bijk -= wWeights(i, j, k) * input.GetW(i, j, k) * invH.z;
+			}
+			else
+			{
+				bijk -= input.GetW(i, j, k) * invH.z;
+			}
 
-					A->AddRow(row, colIdx);
-					b->Append(bijk);
-				}
-			});
+			// Accumulate contributions from the moving boundary
+			double boundaryContribution =
+				(1.0 - uWeights(i + 1, j, k)) * boundaryVel(uPos(i + 1, j, k)).x * invH.x -
+				(1.0 - uWeights(i, j, k)) * boundaryVel(uPos(i, j, k)).x * invH.x +
+				(1.0 - vWeights(i, j + 1, k)) * boundaryVel(vPos(i, j + 1, k)).y * invH.y -
+				(1.0 - vWeights(i, j, k)) * boundaryVel(vPos(i, j, k)).y * invH.y +
+				(1.0 - wWeights(i, j, k + 1)) * boundaryVel(wPos(i, j, k + 1)).z * invH.z -
+				(1.0 - wWeights(i, j, k)) * boundaryVel(wPos(i, j, k)).z * invH.z;
+			bijk += boundaryContribution;
+
+			// If row.center is near-zero, the cell is likely inside a solid boundary.
+			if (row[0] < std::numeric_limits<double>::epsilon())
+			{
+				row[0] = 1.0;
+				bijk = 0.0;
+			}
 
-			x->Resize(b->size(), 0.0);
+			return bijk;
 		}
 	}
 
 	GridFractionalSinglePhasePressureSolver3::GridFractionalSinglePhasePressureSolver3()
 	{
-		m_systemSolver = std::make_shared<FDMICCGSolver3>(100, DEFAULT_TOLERANCE);
+		m_systemSolver = std::make_shared<FDMAMGPCGSolver3>(100, DEFAULT_TOLERANCE);
 	}
 
 	GridFractionalSinglePhasePressureSolver3::~GridFractionalSinglePhasePressureSolver3()
@@ -566,13 +479,21 @@ namespace CubbyFlow
 		const ScalarField3& fluidSDF,
 		bool useCompressed)
 	{
-		UNUSED_VARIABLE(timeIntervalInSeconds);
-
 		BuildWeights(input, boundarySDF, boundaryVelocity, fluidSDF);
 		BuildSystem(input, useCompressed);
 
 		if (m_systemSolver != nullptr)
 		{
+			// The warm start sets the flag of the linear system solver only
+			// for this solve
+			const bool useInitialGuess = m_systemSolver->GetUseInitialGuess();
+
+			if (m_useWarmStart)
+			{
+				BuildInitialGuess(timeIntervalInSeconds, useCompressed);
+				m_systemSolver->SetUseInitialGuess(true);
+			}
+
 			// Solve the system
 			if (m_mgSystemSolver == nullptr)
 			{
@@ -592,6 +513,14 @@ namespace CubbyFlow
 			{
 				m_mgSystemSolver->Solve(&m_mgSystem);
 			}
+
+			m_systemSolver->SetUseInitialGuess(useInitialGuess);
+
+			if (m_useWarmStart)
+			{
+				m_lastPressure.Set(GetPressure());
+				m_lastTimeIntervalInSeconds = timeIntervalInSeconds;
+			}
 		}
 
 		// Apply pressure gradient
@@ -636,6 +565,22 @@ namespace CubbyFlow
 		return m_mgSystem.x.levels.front();
 	}
 
+	bool GridFractionalSinglePhasePressureSolver3::GetUseWarmStart() const
+	{
+		return m_useWarmStart;
+	}
+
+	void GridFractionalSinglePhasePressureSolver3::SetUseWarmStart(bool useWarmStart)
+	{
+		m_useWarmStart = useWarmStart;
+
+		if (!m_useWarmStart)
+		{
+			m_lastPressure.Clear();
+			m_lastTimeIntervalInSeconds = 0.0;
+		}
+	}
+
 	void GridFractionalSinglePhasePressureSolver3::BuildWeights(
 		const FaceCenteredGrid3& input,
 		const ScalarField3& boundarySDF,
@@ -757,18 +702,309 @@ namespace CubbyFlow
 
 	void GridFractionalSinglePhasePressureSolver3::DecompressSolution()
 	{
-		const auto acc = m_fluidSDF[0].ConstAccessor();
-		m_system.x.Resize(acc.size());
+		// Only the cells of the rows are written, so clear the rest first
+		m_system.x.Resize(m_fluidSDF[0].size());
+		m_system.x.Set(0.0);
+
+		ParallelFor(ZERO_SIZE, m_rowToCoord.size(), [&](size_t row)
+		{
+			m_system.x(m_rowToCoord[row]) = m_compSystem.x[row];
+		});
+	}
+
+	void GridFractionalSinglePhasePressureSolver3::BuildInitialGuess(double timeIntervalInSeconds, bool useCompressed)
+	{
+		const Size3 size = m_fluidSDF[0].size();
+
+		// The pressure scales with the time interval. Without the pressure of
+		// the same resolution, the solve starts from zero as usual.
+		const bool hasLastPressure = m_lastPressure.size() == size && m_lastTimeIntervalInSeconds > 0.0;
+		const double scale = hasLastPressure ? timeIntervalInSeconds / m_lastTimeIntervalInSeconds : 0.0;
+
+		// The cells which were not fluid in the last step hold zero, which is
+		// also the pressure at the free surface.
+		auto initialGuess = [&](size_t i, size_t j, size_t k)
+		{
+			return (hasLastPressure && IsInsideSDF(m_fluidSDF[0](i, j, k))) ? scale * m_lastPressure(i, j, k) : 0.0;
+		};
+
+		if (m_mgSystemSolver != nullptr)
+		{
+			FDMVector3& x = m_mgSystem.x.levels.front();
+			x.ParallelForEachIndex([&](size_t i, size_t j, size_t k)
+			{
+				x(i, j, k) = initialGuess(i, j, k);
+			});
+		}
+		else if (useCompressed)
+		{
+			ParallelFor(ZERO_SIZE, m_rowToCoord.size(), [&](size_t row)
+			{
+				const Point3UI& pt = m_rowToCoord[row];
+				m_compSystem.x[row] = initialGuess(pt.x, pt.y, pt.z);
+			});
+		}
+		else
+		{
+			m_system.x.ParallelForEachIndex([&](size_t i, size_t j, size_t k)
+			{
+				m_system.x(i, j, k) = initialGuess(i, j, k);
+			});
+		}
+	}
+
+	void GridFractionalSinglePhasePressureSolver3::BuildCompressedSystem(const FaceCenteredGrid3& input)
+	{
+		const Array3<float>& fluidSDF = m_fluidSDF[0];
+		const Size3 size = fluidSDF.size();
+		const size_t numberOfCells = size.x * size.y * size.z;
+		const float* phi = fluidSDF.data();
+
+		bool isRenumberingNeeded =
+			m_coordToRow.size() != size ||
+			m_compSystem.A.Rows() != m_rowToCoord.size() ||
+			m_compSystem.b.size() != m_rowToCoord.size() ||
+			m_compSystem.colors.size() != 2;
+
+		size_t numberOfNewRows = 0;
+
+		if (!isRenumberingNeeded)
+		{
+			const size_t* coordToRow = m_coordToRow.data();
+
+			numberOfNewRows = ParallelReduce(ZERO_SIZE, numberOfCells, ZERO_SIZE,
+				[&](size_t begin, size_t end, size_t result)
+			{
+				for (size_t c = begin; c < end; ++c)
+				{
+					if (IsInsideSDF(phi[c]) && coordToRow[c] == UNASSIGNED_ROW)
+					{
+						++result;
+					}
+				}
+
+				return result;
+			}, std::plus<size_t>());
+
+			const size_t numberOfIdentityRows = ParallelReduce(ZERO_SIZE, m_rowToCoord.size(), ZERO_SIZE,
+				[&](size_t begin, size_t end, size_t result)
+			{
+				for (size_t row = begin; row < end; ++row)
+				{
+					if (!IsInsideSDF(fluidSDF(m_rowToCoord[row])))
+					{
+						++result;
+					}
+				}
+
+				return result;
+			}, std::plus<size_t>());
+
+			const size_t numberOfRows = m_rowToCoord.size() + numberOfNewRows;
+			isRenumberingNeeded =
+				static_cast<double>(m_numberOfStaleRows + numberOfNewRows + numberOfIdentityRows) >
+				MAX_STALE_ROW_RATIO * static_cast<double>(numberOfRows);
+		}
+
+		// Red-black ordering of the 7-point stencil, which lets the compressed
+		// system be relaxed in parallel. Rows from firstRow are appended to
+		// the colors in ascending order.
+		auto appendColors = [&](size_t firstRow)
+		{
+			std::vector<size_t> rows(m_rowToCoord.size() - firstRow);
+			std::iota(rows.begin(), rows.end(), firstRow);
+
+			const size_t numberOfRedRows = ParallelPartition(rows.begin(), rows.end(), [&](size_t row)
+			{
+				const Point3UI& pt = m_rowToCoord[row];
+				return (pt.x + pt.y + pt.z) % 2 == 0;
+			});
+
+			m_compSystem.colors[0].insert(m_compSystem.colors[0].end(), rows.begin(), rows.begin() + numberOfRedRows);
+			m_compSystem.colors[1].insert(m_compSystem.colors[1].end(), rows.begin() + numberOfRedRows, rows.end());
+		};
 
-		size_t row = 0;
-		m_fluidSDF[0].ForEachIndex([&](size_t i, size_t j, size_t k)
+		if (isRenumberingNeeded)
 		{
-			if (IsInsideSDF(acc(i, j, k)))
+			// Number the fluid cells in the lexicographic order with a prefix
+			// sum of the fluid flags
+			m_coordToRow.Resize(size);
+			size_t* coordToRow = m_coordToRow.data();
+
+			ParallelFor(ZERO_SIZE, numberOfCells, [&](size_t c)
+			{
+				coordToRow[c] = IsInsideSDF(phi[c]) ? 1 : 0;
+			});
+
+			const size_t numberOfRows = ParallelExclusiveScan(coordToRow, coordToRow + numberOfCells,
+				coordToRow, ZERO_SIZE, std::plus<size_t>());
+
+			m_rowToCoord.resize(numberOfRows);
+			fluidSDF.ParallelForEachIndex([&](size_t i, size_t j, size_t k)
+			{
+				const size_t c = i + size.x * (j + size.y * k);
+
+				if (IsInsideSDF(phi[c]))
+				{
+					m_rowToCoord[coordToRow[c]] = Point3UI(i, j, k);
+				}
+				else
+				{
+					coordToRow[c] = UNASSIGNED_ROW;
+				}
+			});
+
+			m_compSystem.colors.assign(2, std::vector<size_t>());
+			m_numberOfStaleRows = 0;
+			appendColors(0);
+
+			BuildCompressedStructure();
+		}
+		else if (numberOfNewRows > 0)
+		{
+			// Append the cells which entered the fluid in the lexicographic order
+			size_t* coordToRow = m_coordToRow.data();
+			const size_t firstNewRow = m_rowToCoord.size();
+			std::vector<size_t> newRowOffsets(numberOfCells);
+
+			ParallelFor(ZERO_SIZE, numberOfCells, [&](size_t c)
+			{
+				newRowOffsets[c] = (IsInsideSDF(phi[c]) && coordToRow[c] == UNASSIGNED_ROW) ? 1 : 0;
+			});
+
+			ParallelExclusiveScan(newRowOffsets.begin(), newRowOffsets.end(),
+				newRowOffsets.begin(), ZERO_SIZE, std::plus<size_t>());
+
+			m_rowToCoord.resize(firstNewRow + numberOfNewRows);
+			fluidSDF.ParallelForEachIndex([&](size_t i, size_t j, size_t k)
+			{
+				const size_t c = i + size.x * (j + size.y * k);
+
+				if (IsInsideSDF(phi[c]) && coordToRow[c] == UNASSIGNED_ROW)
+				{
+					const size_t row = firstNewRow + newRowOffsets[c];
+					coordToRow[c] = row;
+					m_rowToCoord[row] = Point3UI(i, j, k);
+				}
+			});
+
+			m_numberOfStaleRows += numberOfNewRows;
+			appendColors(firstNewRow);
+
+			BuildCompressedStructure();
+		}
+
+		// Update the values in place. The rows of the cells which left the fluid
+		// become identity rows, and the entries pointing to them are zero.
+		MatrixCSRD& A = m_compSystem.A;
+		VectorND& b = m_compSystem.b;
+		const size_t* rowPointers = A.RowPointersData();
+		const size_t* columnIndices = A.ColumnIndicesData();
+		double* nonZeros = A.NonZeroData();
+
+		ParallelFor(ZERO_SIZE, m_rowToCoord.size(), [&](size_t row)
+		{
+			const Point3UI& pt = m_rowToCoord[row];
+			const size_t rowBegin = rowPointers[row];
+			const size_t rowEnd = rowPointers[row + 1];
+
+			if (!IsInsideSDF(fluidSDF(pt)))
 			{
-				m_system.x(i, j, k) = m_compSystem.x[row];
-				++row;
+				for (size_t n = rowBegin; n < rowEnd; ++n)
+				{
+					nonZeros[n] = (columnIndices[n] == row) ? 1.0 : 0.0;
+				}
+
+				b[row] = 0.0;
+				return;
 			}
+
+			std::array<double, 7> coefficients;
+			b[row] = BuildCompressedRow(pt.x, pt.y, pt.z, fluidSDF,
+				m_uWeights[0], m_vWeights[0], m_wWeights[0], m_boundaryVel, input, &coefficients);
+
+			// Rows of the (center, +x, -x, +y, -y, +z, -z) cells
+			const std::array<size_t, 7> neighborRows = {
+				{
+					row,
+					(pt.x + 1 < size.x) ? m_coordToRow(pt.x + 1, pt.y, pt.z) : UNASSIGNED_ROW,
+					(pt.x > 0) ? m_coordToRow(pt.x - 1, pt.y, pt.z) : UNASSIGNED_ROW,
+					(pt.y + 1 < size.y) ? m_coordToRow(pt.x, pt.y + 1, pt.z) : UNASSIGNED_ROW,
+					(pt.y > 0) ? m_coordToRow(pt.x, pt.y - 1, pt.z) : UNASSIGNED_ROW,
+					(pt.z + 1 < size.z) ? m_coordToRow(pt.x, pt.y, pt.z + 1) : UNASSIGNED_ROW,
+					(pt.z > 0) ? m_coordToRow(pt.x, pt.y, pt.z - 1) : UNASSIGNED_ROW
+				}
+			};
+
+			for (size_t n = rowBegin; n < rowEnd; ++n)
+			{
+				for (size_t d = 0; d < 7; ++d)
+				{
+					if (neighborRows[d] == columnIndices[n])
+					{
+						nonZeros[n] = coefficients[d];
+						break;
+					}
+				}
+			}
+		});
+
+		m_compSystem.x.Resize(m_rowToCoord.size(), 0.0);
+	}
+
+	void GridFractionalSinglePhasePressureSolver3::BuildCompressedStructure()
+	{
+		const Size3 size = m_coordToRow.size();
+		const size_t numberOfRows = m_rowToCoord.size();
+
+		// Columns of a row are the row itself and the face neighbors which
+		// have rows, sorted in ascending order
+		auto collectColumns = [&](size_t row, std::array<size_t, 7>* columns) -> size_t
+		{
+			const Point3UI& pt = m_rowToCoord[row];
+			size_t count = 0;
+
+			// Inserts the column in place, which keeps the columns sorted
+			auto add = [&](size_t column)
+			{
+				if (column != UNASSIGNED_ROW)
+				{
+					size_t i = count++;
+
+					for (; i > 0 && (*columns)[i - 1] > column; --i)
+					{
+						(*columns)[i] = (*columns)[i - 1];
+					}
+
+					(*columns)[i] = column;
+				}
+			};
+
+			add(row);
+			add((pt.x + 1 < size.x) ? m_coordToRow(pt.x + 1, pt.y, pt.z) : UNASSIGNED_ROW);
+			add((pt.x > 0) ? m_coordToRow(pt.x - 1, pt.y, pt.z) : UNASSIGNED_ROW);
+			add((pt.y + 1 < size.y) ? m_coordToRow(pt.x, pt.y + 1, pt.z) : UNASSIGNED_ROW);
+			add((pt.y > 0) ? m_coordToRow(pt.x, pt.y - 1, pt.z) : UNASSIGNED_ROW);
+			add((pt.z + 1 < size.z) ? m_coordToRow(pt.x, pt.y, pt.z + 1) : UNASSIGNED_ROW);
+			add((pt.z > 0) ? m_coordToRow(pt.x, pt.y, pt.z - 1) : UNASSIGNED_ROW);
+
+			return count;
+		};
+
+		m_compSystem.A.Build(numberOfRows, numberOfRows,
+			[&](size_t row)
+		{
+			std::array<size_t, 7> columns;
+			return collectColumns(row, &columns);
+		},
+			[&](size_t row, MatrixCSRD::NonZeroIterator, MatrixCSRD::IndexIterator columnIndices)
+		{
+			std::array<size_t, 7> columns;
+			const size_t count = collectColumns(row, &columns);
+			std::copy(columns.begin(), columns.begin() + count, columnIndices);
 		});
+
+		m_compSystem.b.Resize(numberOfRows);
 	}
 
 	void GridFractionalSinglePhasePressureSolver3::BuildSystem(const FaceCenteredGrid3& input, bool useCompressed)
@@ -800,10 +1036,7 @@ namespace CubbyFlow
 		{
 			if (useCompressed)
 			{
-				BuildSingleSystem(
-					&m_compSystem.A, &m_compSystem.x, &m_compSystem.b,
-					m_fluidSDF[0], m_uWeights[0], m_vWeights[0], m_wWeights[0],
-					m_boundaryVel, *finer);
+				BuildCompressedSystem(*finer);
 			}
 			else
 			{
@@ -77,6 +77,7 @@ namespace CubbyFlow
 		}
 
 		void BuildSingleSystem(MatrixCSRD* A, VectorND* x, VectorND* b,
+			std::vector<std::vector<size_t>>* colors,
 			const Array2<char>& markers,
 			const FaceCenteredGrid2& input)
 		{
@@ -89,6 +90,10 @@ namespace CubbyFlow
 			A->Clear();
 			b->Clear();
 
+			// Red-black ordering of the 5-point stencil, which lets the
+			// compressed system be relaxed in parallel
+			colors->assign(2, std::vector<size_t>());
+
 			size_t numRows = 0;
 			Array2<size_t> coordToIndex(size);
 			markers.ForEachIndex([&](size_t i, size_t j)
@@ -97,6 +102,7 @@ namespace CubbyFlow
 
 				if (markerAcc[cIdx] == FLUID)
 				{
+					(*colors)[(i + j) % 2].push_back(numRows);
 					coordToIndex[cIdx] = numRows++;
 				}
 			});
@@ -392,7 +398,7 @@ namespace CubbyFlow
 		{
 			if (useCompressed)
 			{
-				BuildSingleSystem(&m_compSystem.A, &m_compSystem.x, &m_compSystem.b, m_markers[0], *finer);
+				BuildSingleSystem(&m_compSystem.A, &m_compSystem.x, &m_compSystem.b, &m_compSystem.colors, m_markers[0], *finer);
 			}
 			else
 			{
@@ -10,6 +10,11 @@
 #include <Core/Solver/FDM/FDMICCGSolver3.h>
 #include <Core/Solver/Grid/GridBlockedBoundaryConditionSolver3.h>
 #include <Core/Solver/Grid/GridSinglePhasePressureSolver3.h>
+#include <Core/Utils/Parallel.h>
+
+#include <array>
+#include <functional>
+#include <numeric>
 
 namespace CubbyFlow
 {
@@ -92,6 +97,8 @@ namespace CubbyFlow
 		}
 
 		void BuildSingleSystem(MatrixCSRD* A, VectorND* x, VectorND* b,
+			std::vector<std::vector<size_t>>* colors,
+			std::vector<Point3UI>* rowToCoord,
 			const Array3<char>& markers,
 			const FaceCenteredGrid3& input)
 		{
@@ -104,103 +111,122 @@ namespace CubbyFlow
 			A->Clear();
 			b->Clear();
 
-			size_t numRows = 0;
+			// Number the fluid cells in the lexicographic order with a prefix
+			// sum of the fluid flags
+			const size_t numberOfCells = size.x * size.y * size.z;
 			Array3<size_t> coordToIndex(size);
-			markers.ForEachIndex([&](size_t i, size_t j, size_t k)
-			{
-				const size_t cIdx = markerAcc.Index(i, j, k);
+			size_t* coordToIndexData = coordToIndex.data();
 
-				if (markerAcc[cIdx] == FLUID)
-				{
-					coordToIndex[cIdx] = numRows++;
-				}
+			ParallelFor(ZERO_SIZE, numberOfCells, [&](size_t cIdx)
+			{
+				coordToIndexData[cIdx] = (markerAcc[cIdx] == FLUID) ? 1 : 0;
 			});
 
-			markers.ForEachIndex([&](size_t i, size_t j, size_t k)
+			const size_t numRows = ParallelExclusiveScan(coordToIndexData, coordToIndexData + numberOfCells,
+				coordToIndexData, ZERO_SIZE, std::plus<size_t>());
+
+			std::vector<Point3UI>& indexToCoord = *rowToCoord;
+			indexToCoord.resize(numRows);
+			markers.ParallelForEachIndex([&](size_t i, size_t j, size_t k)
 			{
 				const size_t cIdx = markerAcc.Index(i, j, k);
 
 				if (markerAcc[cIdx] == FLUID)
 				{
-					b->Append(input.DivergenceAtCellCenter(i, j, k));
-
-					std::vector<double> row(1, 0.0);
-					std::vector<size_t> colIdx(1, coordToIndex[cIdx]);
-
-					if (i + 1 < size.x && markers(i + 1, j, k) != BOUNDARY)
-					{
-						row[0] += invHSqr.x;
-						const size_t rIdx = markerAcc.Index(i + 1, j, k);
+					indexToCoord[coordToIndex[cIdx]] = Point3UI(i, j, k);
+				}
+			});
 
-						if (markers[rIdx] == FLUID)
-						{
-							row.push_back(-invHSqr.x);
-							colIdx.push_back(coordToIndex[rIdx]);
-						}
-					}
+			// Red-black ordering of the 7-point stencil, which lets the
+			// compressed system be relaxed in parallel
+			std::vector<size_t> rows(numRows);
+			std::iota(rows.begin(), rows.end(), ZERO_SIZE);
 
-					if (i > 0 && markers(i - 1, j, k) != BOUNDARY)
-					{
-						row[0] += invHSqr.x;
-						const size_t lIdx = markerAcc.Index(i - 1, j, k);
+			const size_t numberOfRedRows = ParallelPartition(rows.begin(), rows.end(), [&](size_t row)
+			{
+				const Point3UI& pt = indexToCoord[row];
+				return (pt.x + pt.y + pt.z) % 2 == 0;
+			});
 
-						if (markers[lIdx] == FLUID)
-						{
-							row.push_back(-invHSqr.x);
-							colIdx.push_back(coordToIndex[lIdx]);
-						}
-					}
+			colors->resize(2);
+			(*colors)[0].assign(rows.begin(), rows.begin() + numberOfRedRows);
+			(*colors)[1].assign(rows.begin() + numberOfRedRows, rows.end());
 
-					if (j + 1 < size.y && markers(i, j + 1, k) != BOUNDARY)
-					{
-						row[0] += invHSqr.y;
-						const size_t uIdx = markerAcc.Index(i, j + 1, k);
+			// Writes the row of the given cell with the diagonal first and
+			// returns the number of non-zeros
+			auto buildRow = [&](size_t row, double* values, size_t* columns) -> size_t
+			{
+				const Point3UI& pt = indexToCoord[row];
+				const size_t i = pt.x, j = pt.y, k = pt.z;
 
-						if (markers[uIdx] == FLUID)
-						{
-							row.push_back(-invHSqr.y);
-							colIdx.push_back(coordToIndex[uIdx]);
-						}
-					}
+				values[0] = 0.0;
+				columns[0] = row;
+				size_t count = 1;
 
-					if (j > 0 && markers(i, j - 1, k) != BOUNDARY)
+				auto addNeighbor = [&](size_t nIdx, double coefficient)
+				{
+					if (markers[nIdx] != BOUNDARY)
 					{
-						row[0] += invHSqr.y;
-						const size_t dIdx = markerAcc.Index(i, j - 1, k);
+						values[0] += coefficient;
 
-						if (markers[dIdx] == FLUID)
+						if (markers[nIdx] == FLUID)
 						{
-							row.push_back(-invHSqr.y);
-							colIdx.push_back(coordToIndex[dIdx]);
+							values[count] = -coefficient;
+							columns[count] = coordToIndex[nIdx];
+							++count;
 						}
 					}
+				};
 
-					if (k + 1 < size.z && markers(i, j, k + 1) != BOUNDARY)
-					{
-						row[0] += invHSqr.z;
-						const size_t fIdx = markerAcc.Index(i, j, k + 1);
-
-						if (markers[fIdx] == FLUID)
-						{
-							row.push_back(-invHSqr.z);
-							colIdx.push_back(coordToIndex[fIdx]);
-						}
-					}
+				if (i + 1 < size.x)
+				{
+					addNeighbor(markerAcc.Index(i + 1, j, k), invHSqr.x);
+				}
+				if (i > 0)
+				{
+					addNeighbor(markerAcc.Index(i - 1, j, k), invHSqr.x);
+				}
+				if (j + 1 < size.y)
+				{
+					addNeighbor(markerAcc.Index(i, j + 1, k), invHSqr.y);
+				}
+				if (j > 0)
+				{
+					addNeighbor(markerAcc.Index(i, j - 1, k), invHSqr.y);
+				}
+				if (k + 1 < size.z)
+				{
+					addNeighbor(markerAcc.Index(i, j, k + 1), invHSqr.z);
+				}
+				if (k > 0)
+				{
+					addNeighbor(markerAcc.Index(i, j, k - 1), invHSqr.z);
+				}
 
-					if (k > 0 && markers(i, j, k - 1) != BOUNDARY)
-					{
-						row[0] += invHSqr.z;
-						const size_t bIdx = markerAcc.Index(i, j, k - 1);
+				return count;
+			};
 
-						if (markers[bIdx] == FLUID)
-						{
-							row.push_back(-invHSqr.z);
-							colIdx.push_back(coordToIndex[bIdx]);
-						}
-					}
+			A->Build(numRows, numRows,
+				[&](size_t row)
+			{
+				std::array<double, 7> values;
+				std::array<size_t, 7> columns;
+				return buildRow(row, values.data(), columns.data());
+			},
+				[&](size_t row, MatrixCSRD::NonZeroIterator nonZeros, MatrixCSRD::IndexIterator columnIndices)
+			{
+				std::array<double, 7> values;
+				std::array<size_t, 7> columns;
+				const size_t count = buildRow(row, values.data(), columns.data());
+				std::copy(values.begin(), values.begin() + count, nonZeros);
+				std::copy(columns.begin(), columns.begin() + count, columnIndices);
+			});
 
-					A->AddRow(row, colIdx);
-				}
+			b->Resize(numRows);
+			ParallelFor(ZERO_SIZE, numRows, [&](size_t row)
+			{
+				const Point3UI& pt = indexToCoord[row];
+				(*b)[row] = input.DivergenceAtCellCenter(pt.x, pt.y, pt.z);
 			});
 
 			x->Resize(b->size(), 0.0);
@@ -226,7 +252,6 @@ namespace CubbyFlow
 		const ScalarField3& fluidSDF,
 		bool useCompressed)
 	{
-		UNUSED_VARIABLE(timeIntervalInSeconds);
 		UNUSED_VARIABLE(boundaryVelocity);
 
 		const auto pos = input.CellCenterPosition();
@@ -236,6 +261,16 @@ namespace CubbyFlow
 
 		if (m_systemSolver != nullptr)
 		{
+			// The warm start sets the flag of the linear system solver only
+			// for this solve
+			const bool useInitialGuess = m_systemSolver->GetUseInitialGuess();
+
+			if (m_useWarmStart)
+			{
+				BuildInitialGuess(timeIntervalInSeconds, useCompressed);
+				m_systemSolver->SetUseInitialGuess(true);
+			}
+
 			// Solve the system
 			if (m_mgSystemSolver == nullptr)
 			{
@@ -256,6 +291,14 @@ namespace CubbyFlow
 				m_mgSystemSolver->Solve(&m_mgSystem);
 			}
 
+			m_systemSolver->SetUseInitialGuess(useInitialGuess);
+
+			if (m_useWarmStart)
+			{
+				m_lastPressure.Set(GetPressure());
+				m_lastTimeIntervalInSeconds = timeIntervalInSeconds;
+			}
+
 			// Apply pressure gradient
 			ApplyPressureGradient(input, output);
 		}
@@ -299,6 +342,22 @@ namespace CubbyFlow
 		return m_mgSystem.x.levels.front();
 	}
 
+	bool GridSinglePhasePressureSolver3::GetUseWarmStart() const
+	{
+		return m_useWarmStart;
+	}
+
+	void GridSinglePhasePressureSolver3::SetUseWarmStart(bool useWarmStart)
+	{
+		m_useWarmStart = useWarmStart;
+
+		if (!m_useWarmStart)
+		{
+			m_lastPressure.Clear();
+			m_lastTimeIntervalInSeconds = 0.0;
+		}
+	}
+
 	void GridSinglePhasePressureSolver3::BuildMarkers(
 		const Size3& size,
 		const std::function<Vector3D(size_t, size_t, size_t)>& pos,
@@ -401,20 +460,56 @@ namespace CubbyFlow
 
 	void GridSinglePhasePressureSolver3::DecompressSolution()
 	{
-		const auto acc = m_markers[0].ConstAccessor();
-		m_system.x.Resize(acc.size());
+		m_system.x.Resize(m_markers[0].size());
+		m_system.x.Set(0.0);
 
-		size_t row = 0;
-		m_markers[0].ForEachIndex([&](size_t i, size_t j, size_t k)
+		ParallelFor(ZERO_SIZE, m_rowToCoord.size(), [&](size_t row)
 		{
-			if (acc(i, j, k) == FLUID)
-			{
-				m_system.x(i, j, k) = m_compSystem.x[row];
-				++row;
-			}
+			m_system.x(m_rowToCoord[row]) = m_compSystem.x[row];
 		});
 	}
 
+	void GridSinglePhasePressureSolver3::BuildInitialGuess(double timeIntervalInSeconds, bool useCompressed)
+	{
+		const Size3 size = m_markers[0].size();
+
+		// The pressure scales with the time interval. Without the pressure of
+		// the same resolution, the solve starts from zero as usual.
+		const bool hasLastPressure = m_lastPressure.size() == size && m_lastTimeIntervalInSeconds > 0.0;
+		const double scale = hasLastPressure ? timeIntervalInSeconds / m_lastTimeIntervalInSeconds : 0.0;
+
+		// The cells which were not fluid in the last step hold zero, which is
+		// also the pressure at the free surface.
+		auto initialGuess = [&](size_t i, size_t j, size_t k)
+		{
+			return (hasLastPressure && m_markers[0](i, j, k) == FLUID) ? scale * m_lastPressure(i, j, k) : 0.0;
+		};
+
+		if (m_mgSystemSolver != nullptr)
+		{
+			FDMVector3& x = m_mgSystem.x.levels.front();
+			x.ParallelForEachIndex([&](size_t i, size_t j, size_t k)
+			{
+				x(i, j, k) = initialGuess(i, j, k);
+			});
+		}
+		else if (useCompressed)
+		{
+			ParallelFor(ZERO_SIZE, m_rowToCoord.size(), [&](size_t row)
+			{
+				const Point3UI& pt = m_rowToCoord[row];
+				m_compSystem.x[row] = initialGuess(pt.x, pt.y, pt.z);
+			});
+		}
+		else
+		{
+			m_system.x.ParallelForEachIndex([&](size_t i, size_t j, size_t k)
+			{
+				m_system.x(i, j, k) = initialGuess(i, j, k);
+			});
+		}
+	}
+
 	void GridSinglePhasePressureSolver3::BuildSystem(const FaceCenteredGrid3& input, bool useCompressed)
 	{
 		const Size3 size = input.Resolution();
@@ -444,7 +539,7 @@ namespace CubbyFlow
 		{
 			if (useCompressed)
 			{
-				BuildSingleSystem(&m_compSystem.A, &m_compSystem.x, &m_compSystem.b, m_markers[0], *finer);
+				BuildSingleSystem(&m_compSystem.A, &m_compSystem.x, &m_compSystem.b, &m_compSystem.colors, &m_rowToCoord, m_markers[0], *finer);
 			}
 			else
 			{
@@ -119,8 +119,12 @@ namespace CubbyFlow
 		{
 			if (m_smokeDiffusionCoefficient > std::numeric_limits<double>::epsilon())
 			{
-				auto den = GetSmokeDensity();
-				const auto den0 = std::dynamic_pointer_cast<CellCenteredScalarGrid2>(den->Clone());
+				// The diffusion solver leaves collider cells untouched, so the
+				// source is copied into the back buffer and solved back in place
+				const auto den = std::dynamic_pointer_cast<CellCenteredScalarGrid2>(GetSmokeDensity());
+				const auto den0 = std::dynamic_pointer_cast<CellCenteredScalarGrid2>(
+					GetGridSystemData()->GetAdvectableScalarDataBackBufferAt(m_smokeDensityDataID));
+				den0->Set(*den);
 
 				GetDiffusionSolver()->Solve(
 					*den0,
@@ -133,8 +137,10 @@ namespace CubbyFlow
 
 			if (m_temperatureDiffusionCoefficient > std::numeric_limits<double>::epsilon())
 			{
-				auto temp = GetSmokeDensity();
-				const auto temp0 = std::dynamic_pointer_cast<CellCenteredScalarGrid2>(temp->Clone());
+				const auto temp = std::dynamic_pointer_cast<CellCenteredScalarGrid2>(GetTemperature());
+				const auto temp0 = std::dynamic_pointer_cast<CellCenteredScalarGrid2>(
+					GetGridSystemData()->GetAdvectableScalarDataBackBufferAt(m_temperatureDataID));
+				temp0->Set(*temp);
 
 				GetDiffusionSolver()->Solve(
 					*temp0,
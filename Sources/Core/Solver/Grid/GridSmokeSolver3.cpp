@@ -117,31 +117,69 @@ namespace CubbyFlow
 	{
 		if (GetDiffusionSolver() != nullptr)
 		{
-			if (m_smokeDiffusionCoefficient > std::numeric_limits<double>::epsilon())
+			const bool diffuseSmoke = m_smokeDiffusionCoefficient > std::numeric_limits<double>::epsilon();
+			const bool diffuseTemperature = m_temperatureDiffusionCoefficient > std::numeric_limits<double>::epsilon();
+
+			// The diffusion solver leaves collider cells untouched, so the
+			// sources are copied into the back buffers and solved back in place
+			const auto den = std::dynamic_pointer_cast<CellCenteredScalarGrid3>(GetSmokeDensity());
+			const auto temp = std::dynamic_pointer_cast<CellCenteredScalarGrid3>(GetTemperature());
+
+			if (diffuseSmoke && diffuseTemperature && m_smokeDiffusionCoefficient == m_temperatureDiffusionCoefficient)
 			{
-				auto den = GetSmokeDensity();
-				const auto den0 = std::dynamic_pointer_cast<CellCenteredScalarGrid3>(den->Clone());
+				// Both fields share the linear system
+				const auto den0 = std::dynamic_pointer_cast<CellCenteredScalarGrid3>(
+					GetGridSystemData()->GetAdvectableScalarDataBackBufferAt(m_smokeDensityDataID));
+				const auto temp0 = std::dynamic_pointer_cast<CellCenteredScalarGrid3>(
+					GetGridSystemData()->GetAdvectableScalarDataBackBufferAt(m_temperatureDataID));
+				den0->Set(*den);
+				temp0->Set(*temp);
 
 				GetDiffusionSolver()->Solve(
-					*den0,
+					std::vector<const ScalarGrid3*>{ den0.get(), temp0.get() },
 					m_smokeDiffusionCoefficient,
 					timeIntervalInSeconds,
-					den.get(),
+					std::vector<ScalarGrid3*>{ den.get(), temp.get() },
 					*GetColliderSDF());
-				ExtrapolateIntoCollider(den.get());
+			}
+			else
+			{
+				if (diffuseSmoke)
+				{
+					const auto den0 = std::dynamic_pointer_cast<CellCenteredScalarGrid3>(
+						GetGridSystemData()->GetAdvectableScalarDataBackBufferAt(m_smokeDensityDataID));
+					den0->Set(*den);
+
+					GetDiffusionSolver()->Solve(
+						*den0,
+						m_smokeDiffusionCoefficient,
+						timeIntervalInSeconds,
+						den.get(),
+						*GetColliderSDF());
+				}
+
+				if (diffuseTemperature)
+				{
+					const auto temp0 = std::dynamic_pointer_cast<CellCenteredScalarGrid3>(
+						GetGridSystemData()->GetAdvectableScalarDataBackBufferAt(m_temperatureDataID));
+					temp0->Set(*temp);
+
+					GetDiffusionSolver()->Solve(
+						*temp0,
+						m_temperatureDiffusionCoefficient,
+						timeIntervalInSeconds,
+						temp.get(),
+						*GetColliderSDF());
+				}
 			}
 
-			if (m_temperatureDiffusionCoefficient > std::numeric_limits<double>::epsilon())
+			if (diffuseSmoke)
 			{
-				auto temp = GetSmokeDensity();
-				const auto temp0 = std::dynamic_pointer_cast<CellCenteredScalarGrid3>(temp->Clone());
+				ExtrapolateIntoCollider(den.get());
+			}
 
-				GetDiffusionSolver()->Solve(
-					*temp0,
-					m_temperatureDiffusionCoefficient,
-					timeIntervalInSeconds,
-					temp.get(),
-					*GetColliderSDF());
+			if (diffuseTemperature)
+			{
 				ExtrapolateIntoCollider(temp.get());
 			}
 		}
@@ -124,8 +124,6 @@ namespace CubbyFlow
         auto positions = particles->GetPositions();
         auto velocities = particles->GetVelocities();
         const size_t numberOfParticles = particles->GetNumberOfParticles();
-        const auto hh = flow->GridSpacing() / 2.0;
-        const auto bbox = flow->BoundingBox();
 
         // Allocate buffers
         m_cX.Resize(numberOfParticles);
@@ -133,38 +131,44 @@ namespace CubbyFlow
         m_cX.Set(Vector2D());
         m_cY.Set(Vector2D());
 
-        auto u = flow->GetUAccessor();
-        auto v = flow->GetVAccessor();
+        auto u = flow->GetUConstAccessor();
+        auto v = flow->GetVConstAccessor();
 
         LinearArraySampler2<double, double> uSampler(u, flow->GridSpacing(), flow->GetUOrigin());
         LinearArraySampler2<double, double> vSampler(v, flow->GridSpacing(), flow->GetVOrigin());
 
+        // The velocity and the affine term share the same stencil, so the
+        // indices and weights are computed once per face component. Positions
+        // outside the data region are clamped by the sampler, which gives the
+        // same stencil as clamping the position to the face-center region.
         ParallelFor(ZERO_SIZE, numberOfParticles, [&](size_t i)
         {
-            velocities[i] = flow->Sample(positions[i]);
-
             std::array<Point2UI, 4> indices;
+            std::array<double, 4> weights;
             std::array<Vector2D, 4> gradWeights;
+            Vector2D velocity;
 
             // x
-            auto uPosClamped = positions[i];
-            uPosClamped.y = std::clamp(uPosClamped.y, bbox.lowerCorner.y + hh.y, bbox.upperCorner.y - hh.y);
-            uSampler.GetCoordinatesAndGradientWeights(uPosClamped, &indices, &gradWeights);
+            uSampler.GetCoordinatesWeightsAndGradientWeights(positions[i], &indices, &weights, &gradWeights);
 
             for (int j = 0; j < 4; ++j)
             {
-                m_cX[i] += gradWeights[j] * u(indices[j]);
+                const double value = u(indices[j]);
+                velocity.x += weights[j] * value;
+                m_cX[i] += gradWeights[j] * value;
             }
 
             // y
-            auto vPosClamped = positions[i];
-            vPosClamped.x = std::clamp(vPosClamped.x, bbox.lowerCorner.x + hh.x, bbox.upperCorner.x - hh.x);
-            vSampler.GetCoordinatesAndGradientWeights(vPosClamped, &indices, &gradWeights);
+            vSampler.GetCoordinatesWeightsAndGradientWeights(positions[i], &indices, &weights, &gradWeights);
 
             for (int j = 0; j < 4; ++j)
             {
-                m_cY[i] += gradWeights[j] * v(indices[j]);
+                const double value = v(indices[j]);
+                velocity.y += weights[j] * value;
+                m_cY[i] += gradWeights[j] * value;
             }
+
+            velocities[i] = velocity;
         });
     }
 
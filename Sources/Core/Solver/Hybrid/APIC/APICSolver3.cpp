@@ -21,7 +21,10 @@ namespace CubbyFlow
         const Vector3D& gridOrigin) :
         PICSolver3(resolution, GridSpacing, gridOrigin)
     {
-        // Do nothing
+        const auto particles = GetParticleSystemData();
+        m_cXIdx = particles->AddVectorData();
+        m_cYIdx = particles->AddVectorData();
+        m_cZIdx = particles->AddVectorData();
     }
 
     APICSolver3::~APICSolver3()
@@ -38,11 +41,9 @@ namespace CubbyFlow
         const size_t numberOfParticles = particles->GetNumberOfParticles();
         const auto hh = flow->GridSpacing() / 2.0;
         const auto bbox = flow->BoundingBox();
-
-        // Allocate buffers
-        m_cX.Resize(numberOfParticles);
-        m_cY.Resize(numberOfParticles);
-        m_cZ.Resize(numberOfParticles);
+        const auto cX = particles->VectorDataAt(m_cXIdx);
+        const auto cY = particles->VectorDataAt(m_cYIdx);
+        const auto cZ = particles->VectorDataAt(m_cZIdx);
 
         // Clear velocity to zero
         flow->Fill(Vector3D());
@@ -90,7 +91,7 @@ namespace CubbyFlow
             for (int j = 0; j < 8; ++j)
             {
                 Vector3D gridPos = uPos(indices[j].x, indices[j].y, indices[j].z);
-                double apicTerm = m_cX[i].Dot(gridPos - uPosClamped);
+                double apicTerm = cX[i].Dot(gridPos - uPosClamped);
                 
                 u(indices[j]) += weights[j] * (velocities[i].x + apicTerm);
                 uWeight(indices[j]) += weights[j];
@@ -105,7 +106,7 @@ namespace CubbyFlow
             for (int j = 0; j < 8; ++j)
             {
                 Vector3D gridPos = vPos(indices[j].x, indices[j].y, indices[j].z);
-                double apicTerm = m_cY[i].Dot(gridPos - vPosClamped);
+                double apicTerm = cY[i].Dot(gridPos - vPosClamped);
                 
                 v(indices[j]) += weights[j] * (velocities[i].y + apicTerm);
                 vWeight(indices[j]) += weights[j];
@@ -120,7 +121,7 @@ namespace CubbyFlow
             for (int j = 0; j < 8; ++j)
             {
                 Vector3D gridPos = wPos(indices[j].x, indices[j].y, indices[j].z);
-                double apicTerm = m_cZ[i].Dot(gridPos - wPosClamped);
+                double apicTerm = cZ[i].Dot(gridPos - wPosClamped);
 
                 w(indices[j]) += weights[j] * (velocities[i].z + apicTerm);
                 wWeight(indices[j]) += weights[j];
@@ -158,64 +159,66 @@ namespace CubbyFlow
         auto positions = particles->GetPositions();
         auto velocities = particles->GetVelocities();
         const size_t numberOfParticles = particles->GetNumberOfParticles();
-        const auto hh = flow->GridSpacing() / 2.0;
-        const auto bbox = flow->BoundingBox();
-
-        // Allocate buffers
-        m_cX.Resize(numberOfParticles);
-        m_cY.Resize(numberOfParticles);
-        m_cZ.Resize(numberOfParticles);
-        m_cX.Set(Vector3D());
-        m_cY.Set(Vector3D());
-        m_cZ.Set(Vector3D());
+        auto cX = particles->VectorDataAt(m_cXIdx);
+        auto cY = particles->VectorDataAt(m_cYIdx);
+        auto cZ = particles->VectorDataAt(m_cZIdx);
 
-        auto u = flow->GetUAccessor();
-        auto v = flow->GetVAccessor();
-        auto w = flow->GetWAccessor();
+        auto u = flow->GetUConstAccessor();
+        auto v = flow->GetVConstAccessor();
+        auto w = flow->GetWConstAccessor();
 
         LinearArraySampler3<double, double> uSampler(u, flow->GridSpacing(), flow->GetUOrigin());
         LinearArraySampler3<double, double> vSampler(v, flow->GridSpacing(), flow->GetVOrigin());
         LinearArraySampler3<double, double> wSampler(w, flow->GridSpacing(), flow->GetWOrigin());
 
+        // The velocity and the affine term share the same stencil, so the
+        // indices and weights are computed once per face component. Positions
+        // outside the data region are clamped by the sampler, which gives the
+        // same stencil as clamping the position to the face-center region.
         ParallelFor(ZERO_SIZE, numberOfParticles, [&](size_t i)
         {
-            velocities[i] = flow->Sample(positions[i]);
-
             std::array<Point3UI, 8> indices;
+            std::array<double, 8> weights;
             std::array<Vector3D, 8> gradWeights;
+            Vector3D velocity;
+            Vector3D affineX;
+            Vector3D affineY;
+            Vector3D affineZ;
 
             // x
-            auto uPosClamped = positions[i];
-            uPosClamped.y = std::clamp(uPosClamped.y, bbox.lowerCorner.y + hh.y, bbox.upperCorner.y - hh.y);
-            uPosClamped.z = std::clamp(uPosClamped.z, bbox.lowerCorner.z + hh.z, bbox.upperCorner.z - hh.z);
-            uSampler.GetCoordinatesAndGradientWeights(uPosClamped, &indices, &gradWeights);
-            
+            uSampler.GetCoordinatesWeightsAndGradientWeights(positions[i], &indices, &weights, &gradWeights);
+
             for (int j = 0; j < 8; ++j)
             {
-                m_cX[i] += gradWeights[j] * u(indices[j]);
+                const double value = u(indices[j]);
+                velocity.x += weights[j] * value;
+                affineX += gradWeights[j] * value;
             }
 
             // y
-            auto vPosClamped = positions[i];
-            vPosClamped.x = std::clamp(vPosClamped.x, bbox.lowerCorner.x + hh.x, bbox.upperCorner.x - hh.x);
-            vPosClamped.z = std::clamp(vPosClamped.z, bbox.lowerCorner.z + hh.z, bbox.upperCorner.z - hh.z);
-            vSampler.GetCoordinatesAndGradientWeights(vPosClamped, &indices, &gradWeights);
-            
+            vSampler.GetCoordinatesWeightsAndGradientWeights(positions[i], &indices, &weights, &gradWeights);
+
             for (int j = 0; j < 8; ++j)
             {
-                m_cY[i] += gradWeights[j] * v(indices[j]);
+                const double value = v(indices[j]);
+                velocity.y += weights[j] * value;
+                affineY += gradWeights[j] * value;
             }
 
             // z
-            auto wPosClamped = positions[i];
-            wPosClamped.x = std::clamp(wPosClamped.x, bbox.lowerCorner.x + hh.x, bbox.upperCorner.x - hh.x);
-            wPosClamped.y = std::clamp(wPosClamped.y, bbox.lowerCorner.y + hh.y, bbox.upperCorner.y - hh.y);
-            wSampler.GetCoordinatesAndGradientWeights(wPosClamped, &indices, &gradWeights);
-            
+            wSampler.GetCoordinatesWeightsAndGradientWeights(positions[i], &indices, &weights, &gradWeights);
+
             for (int j = 0; j < 8; ++j)
             {
-                m_cZ[i] += gradWeights[j] * w(indices[j]);
+                const double value = w(indices[j]);
+                velocity.z += weights[j] * value;
+                affineZ += gradWeights[j] * value;
             }
+
+            velocities[i] = velocity;
+            cX[i] = affineX;
+            cY[i] = affineY;
+            cZ[i] = affineZ;
         });
     }
 
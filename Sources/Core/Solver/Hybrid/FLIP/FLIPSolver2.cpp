@@ -79,31 +79,40 @@ namespace CubbyFlow
 			m_vDelta(i, j) = static_cast<float>(flow->GetV(i, j)) - m_vDelta(i, j);
 		});
 
-		LinearArraySampler2<float, float> uSampler(
-			m_uDelta.ConstAccessor(),
-			flow->GridSpacing().CastTo<float>(),
-			flow->GetUOrigin().CastTo<float>());
-		LinearArraySampler2<float, float> vSampler(
-			m_vDelta.ConstAccessor(),
-			flow->GridSpacing().CastTo<float>(),
-			flow->GetVOrigin().CastTo<float>());
-
-		auto sampler = [uSampler, vSampler](const Vector2D& x)
-		{
-			const auto xf = x.CastTo<float>();
-			double u = uSampler(xf);
-			double v = vSampler(xf);
-			return Vector2D(u, v);
-		};
+		auto u = flow->GetUConstAccessor();
+		auto v = flow->GetVConstAccessor();
+
+		LinearArraySampler2<double, double> uSampler(u, flow->GridSpacing(), flow->GetUOrigin());
+		LinearArraySampler2<double, double> vSampler(v, flow->GridSpacing(), flow->GetVOrigin());
 
-		// Transfer delta to the particles
+		// Transfer delta to the particles. The delta grids have the same layout
+		// as the velocity grid, so a single stencil per face component gathers
+		// both the new velocity (PIC) and the delta (FLIP).
 		ParallelFor(ZERO_SIZE, numberOfParticles, [&](size_t i)
 		{
-			Vector2D flipVel = velocities[i] + sampler(positions[i]);
-			
+			std::array<Point2UI, 4> indices;
+			std::array<double, 4> weights;
+			Vector2D picVel;
+			Vector2D delta;
+
+			uSampler.GetCoordinatesAndWeights(positions[i], &indices, &weights);
+			for (int j = 0; j < 4; ++j)
+			{
+				picVel.x += weights[j] * u(indices[j]);
+				delta.x += weights[j] * m_uDelta(indices[j]);
+			}
+
+			vSampler.GetCoordinatesAndWeights(positions[i], &indices, &weights);
+			for (int j = 0; j < 4; ++j)
+			{
+				picVel.y += weights[j] * v(indices[j]);
+				delta.y += weights[j] * m_vDelta(indices[j]);
+			}
+
+			Vector2D flipVel = velocities[i] + delta;
+
 			if (m_picBlendingFactor > 0.0)
 			{
-				Vector2D picVel = flow->Sample(positions[i]);
 				flipVel = Lerp(flipVel, picVel, m_picBlendingFactor);
 			}
 
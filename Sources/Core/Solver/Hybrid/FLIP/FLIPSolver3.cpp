@@ -90,36 +90,49 @@ namespace CubbyFlow
 			m_wDelta(i, j, k) = static_cast<float>(flow->GetW(i, j, k)) - m_wDelta(i, j, k);
 		});
 
-		LinearArraySampler3<float, float> uSampler(
-			m_uDelta.ConstAccessor(),
-			flow->GridSpacing().CastTo<float>(),
-			flow->GetUOrigin().CastTo<float>());
-		LinearArraySampler3<float, float> vSampler(
-			m_vDelta.ConstAccessor(),
-			flow->GridSpacing().CastTo<float>(),
-			flow->GetVOrigin().CastTo<float>());
-		LinearArraySampler3<float, float> wSampler(
-			m_wDelta.ConstAccessor(),
-			flow->GridSpacing().CastTo<float>(),
-			flow->GetWOrigin().CastTo<float>());
-
-		auto sampler = [uSampler, vSampler, wSampler](const Vector3D& x)
-		{
-			const auto xf = x.CastTo<float>();
-			double u = uSampler(xf);
-			double v = vSampler(xf);
-			double w = wSampler(xf);
-			return Vector3D(u, v, w);
-		};
-
-		// Transfer delta to the particles
+		auto u = flow->GetUConstAccessor();
+		auto v = flow->GetVConstAccessor();
+		auto w = flow->GetWConstAccessor();
+
+		LinearArraySampler3<double, double> uSampler(u, flow->GridSpacing(), flow->GetUOrigin());
+		LinearArraySampler3<double, double> vSampler(v, flow->GridSpacing(), flow->GetVOrigin());
+		LinearArraySampler3<double, double> wSampler(w, flow->GridSpacing(), flow->GetWOrigin());
+
+		// Transfer delta to the particles. The delta grids have the same layout
+		// as the velocity grid, so a single stencil per face component gathers
+		// both the new velocity (PIC) and the delta (FLIP).
 		ParallelFor(ZERO_SIZE, numberOfParticles, [&](size_t i)
 		{
-			Vector3D flipVel = velocities[i] + sampler(positions[i]);
+			std::array<Point3UI, 8> indices;
+			std::array<double, 8> weights;
+			Vector3D picVel;
+			Vector3D delta;
+
+			uSampler.GetCoordinatesAndWeights(positions[i], &indices, &weights);
+			for (int j = 0; j < 8; ++j)
+			{
+				picVel.x += weights[j] * u(indices[j]);
+				delta.x += weights[j] * m_uDelta(indices[j]);
+			}
+
+			vSampler.GetCoordinatesAndWeights(positions[i], &indices, &weights);
+			for (int j = 0; j < 8; ++j)
+			{
+				picVel.y += weights[j] * v(indices[j]);
+				delta.y += weights[j] * m_vDelta(indices[j]);
+			}
+
+			wSampler.GetCoordinatesAndWeights(positions[i], &indices, &weights);
+			for (int j = 0; j < 8; ++j)
+			{
+				picVel.z += weights[j] * w(indices[j]);
+				delta.z += weights[j] * m_wDelta(indices[j]);
+			}
+
+			Vector3D flipVel = velocities[i] + delta;
 
 			if (m_picBlendingFactor > 0.0) 
 			{
-				Vector3D picVel = flow->Sample(positions[i]);
 				flipVel = Lerp(flipVel, picVel, m_picBlendingFactor);
 			}
 
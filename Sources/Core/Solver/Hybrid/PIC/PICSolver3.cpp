@@ -8,6 +8,7 @@
 *************************************************************************/
 #include <Core/Array/ArrayUtils.h>
 #include <Core/Grid/CellCenteredScalarGrid3.h>
+#include <Core/Math/MathUtils.h>
 #include <Core/Solver/Hybrid/PIC/PICSolver3.h>
 #include <Core/Utils/Logging.h>
 #include <Core/Utils/Timer.h>
@@ -57,6 +58,26 @@ namespace CubbyFlow
 		newEmitter->SetTarget(m_particles);
 	}
 
+	const ImplicitSurface3Ptr& PICSolver3::GetKillVolume() const
+	{
+		return m_killVolume;
+	}
+
+	void PICSolver3::SetKillVolume(const ImplicitSurface3Ptr& newKillVolume)
+	{
+		m_killVolume = newKillVolume;
+	}
+
+	bool PICSolver3::GetIsRemovingParticlesOutOfDomain() const
+	{
+		return m_isRemovingParticlesOutOfDomain;
+	}
+
+	void PICSolver3::SetIsRemovingParticlesOutOfDomain(bool isRemoving)
+	{
+		m_isRemovingParticlesOutOfDomain = isRemoving;
+	}
+
 	void PICSolver3::OnInitialize()
 	{
 		GridFluidSolver3::OnInitialize();
@@ -116,6 +137,10 @@ namespace CubbyFlow
 		MoveParticles(timeIntervalInSeconds);
 		CUBBYFLOW_INFO << "MoveParticles took "
 			<< timer.DurationInSeconds() << " seconds";
+		timer.Reset();
+		RemoveParticles();
+		CUBBYFLOW_INFO << "RemoveParticles took "
+			<< timer.DurationInSeconds() << " seconds";
 	}
 
 	ScalarField3Ptr PICSolver3::GetFluidSDF() const
@@ -216,12 +241,8 @@ namespace CubbyFlow
 		auto flow = GetGridSystemData()->GetVelocity();
 		auto positions = m_particles->GetPositions();
 		auto velocities = m_particles->GetVelocities();
-		size_t numberOfParticles = m_particles->GetNumberOfParticles();
 
-		ParallelFor(ZERO_SIZE, numberOfParticles, [&](size_t i)
-		{
-			velocities[i] = flow->Sample(positions[i]);
-		});
+		flow->BatchSample(ConstArrayAccessor1<Vector3D>(positions), velocities);
 	}
 
 	void PICSolver3::MoveParticles(double timeIntervalInSeconds)
@@ -233,27 +254,100 @@ namespace CubbyFlow
 		int domainBoundaryFlag = GetClosedDomainBoundaryFlag();
 		BoundingBox3D boundingBox = flow->BoundingBox();
 
+		// Per-particle adaptive time-stepping: each particle takes just enough
+		// sub-steps to travel at most one grid cell per sub-step, bounded by the
+		// max CFL number.
+		const unsigned int maxSubSteps = static_cast<unsigned int>(std::max(GetMaxCFL(), 1.0));
+		const double minGridSize = flow->GridSpacing().Min();
+
+		Array1<Vector3D> sampledVelocities(numberOfParticles);
+		Array1<unsigned int> numSubSteps(numberOfParticles);
+		flow->BatchSample(ConstArrayAccessor1<Vector3D>(positions), sampledVelocities.Accessor());
 		ParallelFor(ZERO_SIZE, numberOfParticles, [&](size_t i)
 		{
-			Vector3D pt0 = positions[i];
-			Vector3D pt1 = pt0;
-			Vector3D vel = velocities[i];
+			const double cfl = sampledVelocities[i].Length() * timeIntervalInSeconds / minGridSize;
+			numSubSteps[i] = static_cast<unsigned int>(Clamp(std::ceil(cfl), 1.0, static_cast<double>(maxSubSteps)));
+		});
+
+		// Order the particles by descending number of sub-steps (counting sort)
+		// so that the particles still moving at any sub-step form a prefix.
+		std::vector<size_t> offsets(maxSubSteps + 1, 0);
+		for (size_t i = 0; i < numberOfParticles; ++i)
+		{
+			++offsets[maxSubSteps - numSubSteps[i] + 1];
+		}
+		for (unsigned int n = 1; n <= maxSubSteps; ++n)
+		{
+			offsets[n] += offsets[n - 1];
+		}
 
-			// Adaptive time-stepping
-			unsigned int numSubSteps = static_cast<unsigned int>(std::max(GetMaxCFL(), 1.0));
-			double dt = timeIntervalInSeconds / numSubSteps;
-			for (unsigned int t = 0; t < numSubSteps; ++t)
+		Array1<size_t> order(numberOfParticles);
+		for (size_t i = 0; i < numberOfParticles; ++i)
+		{
+			order[offsets[maxSubSteps - numSubSteps[i]]++] = i;
+		}
+
+		Array1<Vector3D> x(numberOfParticles);
+		Array1<Vector3D> v(numberOfParticles);
+		Array1<Vector3D> midPoints(numberOfParticles);
+		Array1<double> dt(numberOfParticles);
+		ParallelFor(ZERO_SIZE, numberOfParticles, [&](size_t k)
+		{
+			const size_t i = order[k];
+			x[k] = positions[i];
+			v[k] = sampledVelocities[i];
+			dt[k] = timeIntervalInSeconds / numSubSteps[i];
+		});
+
+		// Mid-point rule, advancing the active particles together so that the
+		// flow is sampled in batches
+		size_t numberOfActiveParticles = numberOfParticles;
+		size_t totalSubSteps = 0;
+		for (unsigned int t = 0; t < maxSubSteps; ++t)
+		{
+			while (numberOfActiveParticles > 0 && numSubSteps[order[numberOfActiveParticles - 1]] <= t)
 			{
-				Vector3D vel0 = flow->Sample(pt0);
+				--numberOfActiveParticles;
+			}
 
-				// Mid-point rule
-				Vector3D midPt = pt0 + 0.5 * dt * vel0;
-				Vector3D midVel = flow->Sample(midPt);
-				pt1 = pt0 + dt * midVel;
+			if (numberOfActiveParticles == 0)
+			{
+				break;
+			}
 
-				pt0 = pt1;
+			ArrayAccessor1<Vector3D> activeVelocities(numberOfActiveParticles, v.data());
+			if (t > 0)
+			{
+				flow->BatchSample(ConstArrayAccessor1<Vector3D>(numberOfActiveParticles, x.data()), activeVelocities);
 			}
 
+			ParallelFor(ZERO_SIZE, numberOfActiveParticles, [&](size_t k)
+			{
+				midPoints[k] = x[k] + 0.5 * dt[k] * v[k];
+			});
+
+			flow->BatchSample(ConstArrayAccessor1<Vector3D>(numberOfActiveParticles, midPoints.data()), activeVelocities);
+			ParallelFor(ZERO_SIZE, numberOfActiveParticles, [&](size_t k)
+			{
+				x[k] = x[k] + dt[k] * v[k];
+			});
+
+			totalSubSteps += numberOfActiveParticles;
+		}
+
+		ParallelFor(ZERO_SIZE, numberOfParticles, [&](size_t k)
+		{
+			positions[order[k]] = x[k];
+		});
+
+		CUBBYFLOW_INFO << "Particle sub-steps: " << totalSubSteps
+			<< " (uniform sub-stepping: " << numberOfParticles * maxSubSteps << ")";
+
+		ParallelFor(ZERO_SIZE, numberOfParticles, [&](size_t i)
+		{
+			Vector3D pt1 = positions[i];
+			Vector3D vel = velocities[i];
+
 			if ((domainBoundaryFlag & DIRECTION_LEFT) && pt1.x <= boundingBox.lowerCorner.x)
 			{
 				pt1.x = boundingBox.lowerCorner.x;
@@ -337,6 +431,30 @@ namespace CubbyFlow
 		ExtrapolateIntoCollider(sdf.get());
 	}
 
+	void PICSolver3::RemoveParticles()
+	{
+		if (m_killVolume == nullptr && !m_isRemovingParticlesOutOfDomain)
+		{
+			return;
+		}
+
+		auto positions = m_particles->GetPositions();
+		const BoundingBox3D boundingBox = GetGridSystemData()->GetVelocity()->BoundingBox();
+
+		const size_t numberOfRemovedParticles = m_particles->RemoveParticles([&](size_t i)
+		{
+			if (m_isRemovingParticlesOutOfDomain && !boundingBox.Contains(positions[i]))
+			{
+				return true;
+			}
+
+			return m_killVolume != nullptr && m_killVolume->SignedDistance(positions[i]) < 0.0;
+		});
+
+		CUBBYFLOW_INFO << "Number of removed PIC-type particles: "
+			<< numberOfRemovedParticles;
+	}
+
 	void PICSolver3::UpdateParticleEmitter(double timeIntervalInSeconds) const
 	{
 		if (m_particleEmitter != nullptr)
@@ -0,0 +1,642 @@
+/*************************************************************************
+> File Name: FSMLevelSetSolver3.cpp
+> Project Name: CubbyFlow
+> Author: Chan-Ho Chris Ohk
+> Purpose: Three-dimensional parallel fast sweeping method (FSM) implementation.
+> Created Time: 2026/10/19
+> Copyright (c) 2018, Chan-Ho Chris Ohk
+*************************************************************************/
+#include <Core/FDM/FDMUtils.h>
+#include <Core/LevelSet/LevelSetUtils.h>
+#include <Core/Solver/LevelSet/FSMLevelSetSolver3.h>
+#include <Core/Utils/Constants.h>
+#include <Core/Utils/Parallel.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace CubbyFlow
+{
+	namespace
+	{
+		// Number of cells per block axis. Blocks on the same diagonal wavefront are
+		// swept in parallel.
+		const size_t BLOCK_SIZE = 8;
+
+		// Number of sweep directions in a round
+		const int NUMBER_OF_DIRECTIONS = 8;
+
+		// Sweep index which marks a block as unchanged since forever
+		const int NEVER_CHANGED = -2 * NUMBER_OF_DIRECTIONS;
+
+		// Relative (to the grid spacing) change of the distance which is considered
+		// as converged
+		const double CONVERGENCE_TOLERANCE = 1e-6;
+
+		//
+		// Calls func(i, j, k) for every cell in the order of a Gauss-Seidel sweep
+		// in direction (dirX, dirY, dirZ), so that the upwind neighbors of a cell are
+		// always visited before the cell itself. A block is skipped if neither it
+		// nor its face neighbors changed during the last round of sweeps, because
+		// it is already converged for every direction. If any call of func in a
+		// block returns true, the block is stamped with sweepIndex. Returns true if
+		// any block changed.
+		//
+		template <typename Callback>
+		bool SweepBlocks(const Size3& size, int dirX, int dirY, int dirZ, int sweepIndex, Array3<int>* lastChanged, const Callback& func)
+		{
+			const Size3 numBlocks = lastChanged->size();
+
+			if (numBlocks.x == 0 || numBlocks.y == 0 || numBlocks.z == 0)
+			{
+				return false;
+			}
+
+			const size_t numWavefronts = numBlocks.x + numBlocks.y + numBlocks.z - 2;
+			const int oldestActiveSweep = sweepIndex - NUMBER_OF_DIRECTIONS;
+			Array3<int>& stamps = *lastChanged;
+
+			std::vector<char> changed(numBlocks.x, 0);
+
+			auto isActive = [&](size_t gi, size_t gj, size_t gk) -> bool
+			{
+				int latest = stamps(gi, gj, gk);
+
+				if (gi > 0)
+				{
+					latest = std::max(latest, stamps(gi - 1, gj, gk));
+				}
+				if (gi + 1 < numBlocks.x)
+				{
+					latest = std::max(latest, stamps(gi + 1, gj, gk));
+				}
+				if (gj > 0)
+				{
+					latest = std::max(latest, stamps(gi, gj - 1, gk));
+				}
+				if (gj + 1 < numBlocks.y)
+				{
+					latest = std::max(latest, stamps(gi, gj + 1, gk));
+				}
+				if (gk > 0)
+				{
+					latest = std::max(latest, stamps(gi, gj, gk - 1));
+				}
+				if (gk + 1 < numBlocks.z)
+				{
+					latest = std::max(latest, stamps(gi, gj, gk + 1));
+				}
+
+				return latest >= oldestActiveSweep;
+			};
+
+			auto sweepBlock = [&](size_t bi, size_t bj, size_t bk) -> bool
+			{
+				// Block index in the grid
+				const size_t gi = (dirX > 0) ? bi : numBlocks.x - 1 - bi;
+				const size_t gj = (dirY > 0) ? bj : numBlocks.y - 1 - bj;
+				const size_t gk = (dirZ > 0) ? bk : numBlocks.z - 1 - bk;
+
+				if (!isActive(gi, gj, gk))
+				{
+					return false;
+				}
+
+				const size_t iBegin = gi * BLOCK_SIZE;
+				const size_t jBegin = gj * BLOCK_SIZE;
+				const size_t kBegin = gk * BLOCK_SIZE;
+				const size_t iEnd = std::min(iBegin + BLOCK_SIZE, size.x);
+				const size_t jEnd = std::min(jBegin + BLOCK_SIZE, size.y);
+				const size_t kEnd = std::min(kBegin + BLOCK_SIZE, size.z);
+
+				bool result = false;
+
+				for (size_t kk = kBegin; kk < kEnd; ++kk)
+				{
+					const size_t k = (dirZ > 0) ? kk : kBegin + kEnd - 1 - kk;
+
+					for (size_t jj = jBegin; jj < jEnd; ++jj)
+					{
+						const size_t j = (dirY > 0) ? jj : jBegin + jEnd - 1 - jj;
+
+						for (size_t ii = iBegin; ii < iEnd; ++ii)
+						{
+							const size_t i = (dirX > 0) ? ii : iBegin + iEnd - 1 - ii;
+
+							if (func(i, j, k))
+							{
+								result = true;
+							}
+						}
+					}
+				}
+
+				if (result)
+				{
+					stamps(gi, gj, gk) = sweepIndex;
+				}
+
+				return result;
+			};
+
+			for (size_t s = 0; s < numWavefronts; ++s)
+			{
+				// Blocks with bi + bj + bk == s do not share any face, and their
+				// upwind neighbors belong to the previous wavefront.
+				const size_t jkMax = (numBlocks.y - 1) + (numBlocks.z - 1);
+				const size_t biBegin = (s > jkMax) ? s - jkMax : 0;
+				const size_t biEnd = std::min(numBlocks.x - 1, s) + 1;
+
+				ParallelFor(biBegin, biEnd, [&](size_t bi)
+				{
+					const size_t rest = s - bi;
+					const size_t bjBegin = (rest > numBlocks.z - 1) ? rest - (numBlocks.z - 1) : 0;
+					const size_t bjEnd = std::min(numBlocks.y - 1, rest) + 1;
+
+					for (size_t bj = bjBegin; bj < bjEnd; ++bj)
+					{
+						if (sweepBlock(bi, bj, rest - bj))
+						{
+							changed[bi] = 1;
+						}
+					}
+				});
+			}
+
+			for (char c : changed)
+			{
+				if (c)
+				{
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+		// Returns the block grid which covers the given cell grid.
+		Size3 NumberOfBlocks(const Size3& size)
+		{
+			return Size3(
+				(size.x + BLOCK_SIZE - 1) / BLOCK_SIZE,
+				(size.y + BLOCK_SIZE - 1) / BLOCK_SIZE,
+				(size.z + BLOCK_SIZE - 1) / BLOCK_SIZE);
+		}
+
+		//
+		// Sweeps in all eight directions until a round makes no change or the max
+		// number of rounds is reached. Returns the number of rounds.
+		//
+		template <typename Callback>
+		unsigned int SweepUntilConverged(const Size3& size, unsigned int maxNumberOfIterations, Array3<int>* lastChanged, const Callback& func)
+		{
+			unsigned int numberOfIterations = 0;
+			int sweepIndex = 0;
+
+			for (unsigned int iter = 0; iter < maxNumberOfIterations; ++iter)
+			{
+				bool changed = false;
+
+				for (int dir = 0; dir < NUMBER_OF_DIRECTIONS; ++dir)
+				{
+					changed |= SweepBlocks(size, (dir & 1) ? -1 : 1, (dir & 2) ? -1 : 1, (dir & 4) ? -1 : 1, sweepIndex, lastChanged, func);
+					++sweepIndex;
+				}
+
+				++numberOfIterations;
+
+				if (!changed)
+				{
+					break;
+				}
+			}
+
+			return numberOfIterations;
+		}
+	}
+
+	FSMLevelSetSolver3::FSMLevelSetSolver3()
+	{
+		// Do nothing
+	}
+
+	void FSMLevelSetSolver3::Reinitialize(
+		const ScalarGrid3& inputSDF,
+		double maxDistance,
+		ScalarGrid3* outputSDF)
+	{
+		if (!inputSDF.HasSameShape(*outputSDF))
+		{
+			throw std::invalid_argument("inputSDF and outputSDF have not same shape.");
+		}
+
+		const Size3 size = inputSDF.GetDataSize();
+		const Vector3D gridSpacing = inputSDF.GridSpacing();
+		const auto input = inputSDF.GetConstDataAccessor();
+		auto output = outputSDF->GetDataAccessor();
+
+		// Unsigned distance to the interface
+		Array3<double> dist(size, std::numeric_limits<double>::max());
+		Array3<char> frozen(size, 0);
+
+		// Solve geometrically near the boundary
+		dist.ParallelForEachIndex([&](size_t i, size_t j, size_t k)
+		{
+			const double phi = input(i, j, k);
+			const bool inside = IsInsideSDF(phi);
+
+			auto distToBoundary = [&](double phiNeighbor, double h, double* minDist)
+			{
+				if (IsInsideSDF(phiNeighbor) != inside)
+				{
+					*minDist = std::min(*minDist, h * std::abs(phi) / (std::abs(phi) + std::abs(phiNeighbor)));
+				}
+			};
+
+			Vector3D minDist(
+				std::numeric_limits<double>::max(),
+				std::numeric_limits<double>::max(),
+				std::numeric_limits<double>::max());
+
+			if (i > 0)
+			{
+				distToBoundary(input(i - 1, j, k), gridSpacing.x, &minDist.x);
+			}
+			if (i + 1 < size.x)
+			{
+				distToBoundary(input(i + 1, j, k), gridSpacing.x, &minDist.x);
+			}
+			if (j > 0)
+			{
+				distToBoundary(input(i, j - 1, k), gridSpacing.y, &minDist.y);
+			}
+			if (j + 1 < size.y)
+			{
+				distToBoundary(input(i, j + 1, k), gridSpacing.y, &minDist.y);
+			}
+			if (k > 0)
+			{
+				distToBoundary(input(i, j, k - 1), gridSpacing.z, &minDist.z);
+			}
+			if (k + 1 < size.z)
+			{
+				distToBoundary(input(i, j, k + 1), gridSpacing.z, &minDist.z);
+			}
+
+			double denomSqr = 0.0;
+			bool isNearBoundary = false;
+
+			for (size_t n = 0; n < 3; ++n)
+			{
+				if (minDist[n] < std::numeric_limits<double>::max())
+				{
+					denomSqr += 1.0 / Square(minDist[n]);
+					isNearBoundary = true;
+				}
+			}
+
+			if (isNearBoundary)
+			{
+				dist(i, j, k) = 1.0 / std::sqrt(denomSqr);
+				frozen(i, j, k) = 1;
+			}
+		});
+
+		// Decreases smaller than this are roundoff and do not keep the sweeps going
+		const double tolerance = CONVERGENCE_TOLERANCE * std::min({ gridSpacing.x, gridSpacing.y, gridSpacing.z });
+
+		const Vector3D invGridSpacingSqr = 1.0 / (gridSpacing * gridSpacing);
+		const double minIncrement = 1.0 / std::sqrt(invGridSpacingSqr.x + invGridSpacingSqr.y + invGridSpacingSqr.z);
+
+		double* distData = dist.data();
+		const char* frozenData = frozen.data();
+		const size_t strideY = size.x;
+		const size_t strideZ = size.x * size.y;
+
+		auto update = [&](size_t i, size_t j, size_t k) -> bool
+		{
+			const size_t idx = i + strideY * j + strideZ * k;
+
+			if (frozenData[idx])
+			{
+				return false;
+			}
+
+			double phiX = std::numeric_limits<double>::max();
+			double phiY = std::numeric_limits<double>::max();
+			double phiZ = std::numeric_limits<double>::max();
+
+			if (i > 0)
+			{
+				phiX = std::min(phiX, distData[idx - 1]);
+			}
+			if (i + 1 < size.x)
+			{
+				phiX = std::min(phiX, distData[idx + 1]);
+			}
+			if (j > 0)
+			{
+				phiY = std::min(phiY, distData[idx - strideY]);
+			}
+			if (j + 1 < size.y)
+			{
+				phiY = std::min(phiY, distData[idx + strideY]);
+			}
+			if (k > 0)
+			{
+				phiZ = std::min(phiZ, distData[idx - strideZ]);
+			}
+			if (k + 1 < size.z)
+			{
+				phiZ = std::min(phiZ, distData[idx + strideZ]);
+			}
+
+			// The solution is at least minNeighbor + minIncrement, so skip the
+			// cells which cannot be improved or fall outside of the band.
+			const double current = distData[idx];
+			const double lowerBound = std::min({ phiX, phiY, phiZ }) + minIncrement;
+
+			if (lowerBound >= current || lowerBound > maxDistance)
+			{
+				return false;
+			}
+
+			const double solution = SolveEikonal(phiX, phiY, phiZ, gridSpacing, invGridSpacingSqr);
+
+			if (solution < current && solution <= maxDistance)
+			{
+				distData[idx] = solution;
+				return current - solution > tolerance;
+			}
+
+			return false;
+		};
+
+		// Start from the blocks around the interface
+		Array3<int> lastChanged(NumberOfBlocks(size), NEVER_CHANGED);
+		frozen.ForEachIndex([&](size_t i, size_t j, size_t k)
+		{
+			if (frozen(i, j, k))
+			{
+				lastChanged(i / BLOCK_SIZE, j / BLOCK_SIZE, k / BLOCK_SIZE) = -1;
+			}
+		});
+
+		m_lastNumberOfIterations = SweepUntilConverged(size, m_maxNumberOfIterations, &lastChanged, update);
+
+		// Restore the sign and keep the input beyond the max distance
+		dist.ParallelForEachIndex([&](size_t i, size_t j, size_t k)
+		{
+			const double d = dist(i, j, k);
+
+			if (d < std::numeric_limits<double>::max())
+			{
+				output(i, j, k) = IsInsideSDF(input(i, j, k)) ? -d : d;
+			}
+			else
+			{
+				output(i, j, k) = input(i, j, k);
+			}
+		});
+	}
+
+	void FSMLevelSetSolver3::Extrapolate(
+		const ScalarGrid3& input,
+		const ScalarField3& sdf,
+		double maxDistance,
+		ScalarGrid3* output)
+	{
+		if (!input.HasSameShape(*output))
+		{
+			throw std::invalid_argument("input and output have not same shape.");
+		}
+
+		Array3<double> sdfGrid(input.GetDataSize());
+		auto pos = input.GetDataPosition();
+		sdfGrid.ParallelForEachIndex([&](size_t i, size_t j, size_t k)
+		{
+			sdfGrid(i, j, k) = sdf.Sample(pos(i, j, k));
+		});
+
+		Extrapolate(
+			input.GetConstDataAccessor(),
+			sdfGrid.ConstAccessor(),
+			input.GridSpacing(),
+			maxDistance,
+			output->GetDataAccessor());
+	}
+
+	void FSMLevelSetSolver3::Extrapolate(
+		const CollocatedVectorGrid3& input,
+		const ScalarField3& sdf,
+		double maxDistance,
+		CollocatedVectorGrid3* output)
+	{
+		if (!input.HasSameShape(*output))
+		{
+			throw std::invalid_argument("input and output have not same shape.");
+		}
+
+		Array3<double> sdfGrid(input.GetDataSize());
+		auto pos = input.GetDataPosition();
+		sdfGrid.ParallelForEachIndex([&](size_t i, size_t j, size_t k)
+		{
+			sdfGrid(i, j, k) = sdf.Sample(pos(i, j, k));
+		});
+
+		const Vector3D gridSpacing = input.GridSpacing();
+
+		Array3<double> u(input.GetDataSize());
+		Array3<double> u0(input.GetDataSize());
+		Array3<double> v(input.GetDataSize());
+		Array3<double> v0(input.GetDataSize());
+		Array3<double> w(input.GetDataSize());
+		Array3<double> w0(input.GetDataSize());
+
+		input.ParallelForEachDataPointIndex([&](size_t i, size_t j, size_t k)
+		{
+			u(i, j, k) = input(i, j, k).x;
+			v(i, j, k) = input(i, j, k).y;
+			w(i, j, k) = input(i, j, k).z;
+		});
+
+		Extrapolate(u, sdfGrid.ConstAccessor(), gridSpacing, maxDistance, u0);
+		Extrapolate(v, sdfGrid.ConstAccessor(), gridSpacing, maxDistance, v0);
+		Extrapolate(w, sdfGrid.ConstAccessor(), gridSpacing, maxDistance, w0);
+
+		output->ParallelForEachDataPointIndex([&](size_t i, size_t j, size_t k)
+		{
+			(*output)(i, j, k).x = u0(i, j, k);
+			(*output)(i, j, k).y = v0(i, j, k);
+			(*output)(i, j, k).z = w0(i, j, k);
+		});
+	}
+
+	void FSMLevelSetSolver3::Extrapolate(
+		const FaceCenteredGrid3& input,
+		const ScalarField3& sdf,
+		double maxDistance,
+		FaceCenteredGrid3* output)
+	{
+		if (!input.HasSameShape(*output))
+		{
+			throw std::invalid_argument("inputSDF and outputSDF have not same shape.");
+		}
+
+		const Vector3D gridSpacing = input.GridSpacing();
+
+		auto u = input.GetUConstAccessor();
+		auto uPos = input.GetUPosition();
+		Array3<double> sdfAtU(u.size());
+		input.ParallelForEachUIndex([&](size_t i, size_t j, size_t k)
+		{
+			sdfAtU(i, j, k) = sdf.Sample(uPos(i, j, k));
+		});
+
+		Extrapolate(u, sdfAtU, gridSpacing, maxDistance, output->GetUAccessor());
+
+		auto v = input.GetVConstAccessor();
+		auto vPos = input.GetVPosition();
+		Array3<double> sdfAtV(v.size());
+		input.ParallelForEachVIndex([&](size_t i, size_t j, size_t k)
+		{
+			sdfAtV(i, j, k) = sdf.Sample(vPos(i, j, k));
+		});
+
+		Extrapolate(v, sdfAtV, gridSpacing, maxDistance, output->GetVAccessor());
+
+		auto w = input.GetWConstAccessor();
+		auto wPos = input.GetWPosition();
+		Array3<double> sdfAtW(w.size());
+		input.ParallelForEachWIndex([&](size_t i, size_t j, size_t k)
+		{
+			sdfAtW(i, j, k) = sdf.Sample(wPos(i, j, k));
+		});
+
+		Extrapolate(w, sdfAtW, gridSpacing, maxDistance, output->GetWAccessor());
+	}
+
+	unsigned int FSMLevelSetSolver3::GetMaxNumberOfIterations() const
+	{
+		return m_maxNumberOfIterations;
+	}
+
+	void FSMLevelSetSolver3::SetMaxNumberOfIterations(unsigned int numberOfIterations)
+	{
+		m_maxNumberOfIterations = std::max(numberOfIterations, 1u);
+	}
+
+	unsigned int FSMLevelSetSolver3::GetLastNumberOfIterations() const
+	{
+		return m_lastNumberOfIterations;
+	}
+
+	void FSMLevelSetSolver3::Extrapolate(
+		const ConstArrayAccessor3<double>& input,
+		const ConstArrayAccessor3<double>& sdf,
+		const Vector3D& gridSpacing,
+		double maxDistance,
+		ArrayAccessor3<double> output)
+	{
+		const Size3 size = input.size();
+		const Vector3D invGridSpacing = 1.0 / gridSpacing;
+
+		// Build markers
+		Array3<char> known(size, 0);
+		known.ParallelForEachIndex([&](size_t i, size_t j, size_t k)
+		{
+			if (IsInsideSDF(sdf(i, j, k)))
+			{
+				known(i, j, k) = 1;
+			}
+			output(i, j, k) = input(i, j, k);
+		});
+
+		// Each cell is the weighted average of the known neighbors that are
+		// closer to the interface, which is the same stencil FMM evaluates in
+		// the order of increasing distance.
+		auto update = [&](size_t i, size_t j, size_t k) -> bool
+		{
+			const double phi = sdf(i, j, k);
+
+			if (IsInsideSDF(phi) || phi > maxDistance)
+			{
+				return false;
+			}
+
+			const Vector3D grad = Gradient3(sdf, gridSpacing, i, j, k).Normalized();
+
+			double sum = 0.0;
+			double count = 0.0;
+
+			auto accumulate = [&](size_t ni, size_t nj, size_t nk, double weight)
+			{
+				if (known(ni, nj, nk) && sdf(ni, nj, nk) < phi)
+				{
+					// If gradient is zero, then just assign 1 to weight
+					if (weight < std::numeric_limits<double>::epsilon())
+					{
+						weight = 1.0;
+					}
+
+					sum += weight * output(ni, nj, nk);
+					count += weight;
+				}
+			};
+
+			if (i > 0)
+			{
+				accumulate(i - 1, j, k, std::max(grad.x, 0.0) * invGridSpacing.x);
+			}
+			if (i + 1 < size.x)
+			{
+				accumulate(i + 1, j, k, -std::min(grad.x, 0.0) * invGridSpacing.x);
+			}
+			if (j > 0)
+			{
+				accumulate(i, j - 1, k, std::max(grad.y, 0.0) * invGridSpacing.y);
+			}
+			if (j + 1 < size.y)
+			{
+				accumulate(i, j + 1, k, -std::min(grad.y, 0.0) * invGridSpacing.y);
+			}
+			if (k > 0)
+			{
+				accumulate(i, j, k - 1, std::max(grad.z, 0.0) * invGridSpacing.z);
+			}
+			if (k + 1 < size.z)
+			{
+				accumulate(i, j, k + 1, -std::min(grad.z, 0.0) * invGridSpacing.z);
+			}
+
+			if (count <= 0.0)
+			{
+				return false;
+			}
+
+			const double value = sum / count;
+
+			if (known(i, j, k) && output(i, j, k) == value)
+			{
+				return false;
+			}
+
+			output(i, j, k) = value;
+			known(i, j, k) = 1;
+
+			return true;
+		};
+
+		// Start from the blocks which contain known cells
+		Array3<int> lastChanged(NumberOfBlocks(size), NEVER_CHANGED);
+		known.ForEachIndex([&](size_t i, size_t j, size_t k)
+		{
+			if (known(i, j, k))
+			{
+				lastChanged(i / BLOCK_SIZE, j / BLOCK_SIZE, k / BLOCK_SIZE) = -1;
+			}
+		});
+
+		m_lastNumberOfIterations = SweepUntilConverged(size, m_maxNumberOfIterations, &lastChanged, update);
+	}
+}
@@ -137,7 +137,7 @@ namespace CubbyFlow
 		if (m_levelSetSolver != nullptr)
 		{
 			auto sdf = GetSignedDistanceField();
-			auto sdf0 = sdf->Clone();
+			const auto& sdf1 = GetGridSystemData()->GetAdvectableScalarDataBackBufferAt(m_signedDistanceFieldId);
 
 			const Vector2D gridSpacing = sdf->GridSpacing();
 			const double h = std::max(gridSpacing.x, gridSpacing.y);
@@ -145,7 +145,8 @@ namespace CubbyFlow
 
 			CUBBYFLOW_INFO << "Max reinitialize distance: " << maxReinitDist;
 
-			m_levelSetSolver->Reinitialize(*sdf0, maxReinitDist, sdf.get());
+			m_levelSetSolver->Reinitialize(*sdf, maxReinitDist, sdf1.get());
+			sdf->Swap(sdf1.get());
 			ExtrapolateIntoCollider(sdf.get());
 		}
 	}
@@ -11,11 +11,153 @@
 #include <Core/Solver/LevelSet/ENOLevelSetSolver3.h>
 #include <Core/Solver/LevelSet/FMMLevelSetSolver3.h>
 #include <Core/Solver/LevelSet/LevelSetLiquidSolver3.h>
+#include <Core/Utils/Constants.h>
 #include <Core/Utils/Logging.h>
+#include <Core/Utils/Parallel.h>
 #include <Core/Utils/Timer.h>
 
+#include <algorithm>
+#include <functional>
+#include <numeric>
+
 namespace CubbyFlow
 {
+	namespace
+	{
+		// Extrapolates one component of the face-centered velocity from the liquid
+		// faces to the air faces which touch the cells in the band. The faces are
+		// resolved layer by layer, each one taking the average of its already known
+		// neighbors.
+		void ExtrapolateFaceComponentInNarrowBand(
+			const Array1<Point3UI>& band,
+			const ConstArrayAccessor3<double>& sdf,
+			size_t axis,
+			ArrayAccessor3<double> vel,
+			Array3<char>* marker)
+		{
+			const Size3 size = vel.size();
+			const Size3 sdfSize = sdf.size();
+
+			// 0: not in the list, 1: unknown, 2: known
+			Array3<char>& faceMarker = *marker;
+			if (faceMarker.size() != size)
+			{
+				faceMarker.Resize(size, 0);
+			}
+
+			auto phiAtFace = [&](const Point3UI& f)
+			{
+				Point3UI c0 = f;
+				Point3UI c1 = f;
+				c0[axis] = (f[axis] > 0) ? f[axis] - 1 : 0;
+				c1[axis] = std::min(f[axis], sdfSize[axis] - 1);
+
+				return 0.5 * (sdf(c0) + sdf(c1));
+			};
+
+			// Collect the faces of the cells in the band
+			Array1<Point3UI> faces;
+			for (size_t n = 0; n < band.size(); ++n)
+			{
+				for (size_t offset = 0; offset < 2; ++offset)
+				{
+					Point3UI f = band[n];
+					f[axis] += offset;
+
+					if (f[axis] < size[axis] && faceMarker(f) == 0)
+					{
+						faceMarker(f) = 1;
+						faces.Append(f);
+					}
+				}
+			}
+
+			ParallelFor(ZERO_SIZE, faces.size(), [&](size_t n)
+			{
+				const Point3UI& f = faces[n];
+
+				if (IsInsideSDF(phiAtFace(f)))
+				{
+					faceMarker(f) = 2;
+				}
+				else
+				{
+					vel(f) = 0.0;
+				}
+			});
+
+			Array1<double> newValues(faces.size());
+			Array1<char> isResolved(faces.size());
+
+			bool hasChanged = true;
+			while (hasChanged)
+			{
+				ParallelFor(ZERO_SIZE, faces.size(), [&](size_t n)
+				{
+					const Point3UI& f = faces[n];
+					isResolved[n] = 0;
+
+					if (faceMarker(f) != 1)
+					{
+						return;
+					}
+
+					double sum = 0.0;
+					size_t count = 0;
+
+					auto accumulate = [&](const Point3UI& nf)
+					{
+						const char m = faceMarker(nf);
+						if (m == 2 || (m == 0 && IsInsideSDF(phiAtFace(nf))))
+						{
+							sum += vel(nf);
+							++count;
+						}
+					};
+
+					for (size_t d = 0; d < 3; ++d)
+					{
+						if (f[d] > 0)
+						{
+							Point3UI nf = f;
+							--nf[d];
+							accumulate(nf);
+						}
+						if (f[d] + 1 < size[d])
+						{
+							Point3UI nf = f;
+							++nf[d];
+							accumulate(nf);
+						}
+					}
+
+					if (count > 0)
+					{
+						newValues[n] = sum / static_cast<double>(count);
+						isResolved[n] = 1;
+					}
+				});
+
+				hasChanged = false;
+				for (size_t n = 0; n < faces.size(); ++n)
+				{
+					if (isResolved[n])
+					{
+						vel(faces[n]) = newValues[n];
+						faceMarker(faces[n]) = 2;
+						hasChanged = true;
+					}
+				}
+			}
+
+			// Leave the marker clean for the next step
+			ParallelFor(ZERO_SIZE, faces.size(), [&](size_t n)
+			{
+				faceMarker(faces[n]) = 0;
+			});
+		}
+	}
+
 	LevelSetLiquidSolver3::LevelSetLiquidSolver3() :
 		LevelSetLiquidSolver3({ 1, 1, 1 }, { 1, 1, 1 }, { 0, 0, 0 })
 	{
@@ -63,6 +205,28 @@ namespace CubbyFlow
 		m_isGlobalCompensationEnabled = isEnabled;
 	}
 
+	size_t LevelSetLiquidSolver3::GetNarrowBandWidth() const
+	{
+		return m_narrowBandWidth;
+	}
+
+	void LevelSetLiquidSolver3::SetNarrowBandWidth(size_t numberOfCells)
+	{
+		if (numberOfCells != m_narrowBandWidth)
+		{
+			m_narrowBandWidth = numberOfCells;
+
+			// The band will be rebuilt at the beginning of the next time-step
+			m_narrowBand.Clear();
+			m_narrowBandMarker.Clear();
+		}
+	}
+
+	size_t LevelSetLiquidSolver3::GetNumberOfNarrowBandCells() const
+	{
+		return m_narrowBand.size();
+	}
+
 	double LevelSetLiquidSolver3::ComputeVolume() const
 	{
 		auto sdf = GetSignedDistanceField();
@@ -70,6 +234,30 @@ namespace CubbyFlow
 		const double cellVolume = gridSpacing.x * gridSpacing.y * gridSpacing.z;
 		const double h = gridSpacing.Max();
 
+		if (IsNarrowBandBuilt())
+		{
+			// The cells outside of the band hold +/- the band width, so only
+			// their number is needed.
+			const auto sdfAcc = sdf->GetConstDataAccessor();
+			const double bandDist = static_cast<double>(m_narrowBandWidth) * h;
+			const size_t numberOfOuterCells = sdfAcc.size().x * sdfAcc.size().y * sdfAcc.size().z - m_narrowBand.size();
+
+			double volume = ParallelReduce(ZERO_SIZE, m_narrowBand.size(), 0.0,
+				[&](size_t begin, size_t end, double result)
+			{
+				for (size_t n = begin; n < end; ++n)
+				{
+					result += 1.0 - SmearedHeavisideSDF(sdfAcc(m_narrowBand[n]) / h);
+				}
+
+				return result;
+			}, std::plus<double>());
+			volume += static_cast<double>(m_numberOfInsideOuterCells) * (1.0 - SmearedHeavisideSDF(-bandDist / h));
+			volume += static_cast<double>(numberOfOuterCells - m_numberOfInsideOuterCells) * (1.0 - SmearedHeavisideSDF(bandDist / h));
+
+			return volume * cellVolume;
+		}
+
 		double volume = 0.0;
 		sdf->ForEachDataPointIndex([&](size_t i, size_t j, size_t k)
 		{
@@ -84,6 +272,14 @@ namespace CubbyFlow
 	{
 		UNUSED_VARIABLE(timeIntervalInSeconds);
 
+		// The emitter may have changed the field outside of the band, so the cells
+		// it has touched are added to the band in that case.
+		if (m_narrowBandWidth > 0 &&
+			(m_narrowBand.size() == 0 || !IsNarrowBandBuilt() || GetEmitter() != nullptr))
+		{
+			BuildNarrowBand();
+		}
+
 		// Measure current volume
 		m_lastKnownVolume = ComputeVolume();
 
@@ -95,7 +291,14 @@ namespace CubbyFlow
 		double currentCfl = GetCFL(timeIntervalInSeconds);
 
 		Timer timer;
-		Reinitialize(currentCfl);
+		if (m_narrowBandWidth > 0)
+		{
+			ReinitializeNarrowBand(currentCfl);
+		}
+		else
+		{
+			Reinitialize(currentCfl);
+		}
 		CUBBYFLOW_INFO << "reinitializing level set field took "
 			<< timer.DurationInSeconds() << " seconds";
 
@@ -120,13 +323,58 @@ namespace CubbyFlow
 		double currentCFL = GetCFL(timeIntervalInSeconds);
 
 		Timer timer;
-		ExtrapolateVelocityToAir(currentCFL);
+		if (m_narrowBandWidth > 0)
+		{
+			ExtrapolateVelocityToAirInNarrowBand();
+		}
+		else
+		{
+			ExtrapolateVelocityToAir(currentCFL);
+		}
 		CUBBYFLOW_INFO << "velocity extrapolation took "
 			<< timer.DurationInSeconds() << " seconds";
 
 		GridFluidSolver3::ComputeAdvection(timeIntervalInSeconds);
 	}
 
+	void LevelSetLiquidSolver3::ComputeScalarDataAdvection(const std::vector<size_t>& indices, double timeIntervalInSeconds)
+	{
+		auto iter = std::find(indices.begin(), indices.end(), m_signedDistanceFieldId);
+
+		if (m_narrowBandWidth == 0 || iter == indices.end())
+		{
+			GridFluidSolver3::ComputeScalarDataAdvection(indices, timeIntervalInSeconds);
+			return;
+		}
+
+		// The other fields are advected over the whole grid
+		std::vector<size_t> otherIndices(indices.begin(), iter);
+		otherIndices.insert(otherIndices.end(), iter + 1, indices.end());
+		GridFluidSolver3::ComputeScalarDataAdvection(otherIndices, timeIntervalInSeconds);
+
+		auto sdf = GetSignedDistanceField();
+		Array1<double> newValues(m_narrowBand.size());
+
+		GetAdvectionSolver()->Advect(
+			*sdf,
+			*GetVelocity(),
+			timeIntervalInSeconds,
+			m_narrowBand.ConstAccessor(),
+			newValues.Accessor(),
+			*GetColliderSDF());
+
+		auto sdfAcc = sdf->GetDataAccessor();
+		ParallelFor(ZERO_SIZE, m_narrowBand.size(), [&](size_t n)
+		{
+			sdfAcc(m_narrowBand[n]) = newValues[n];
+		});
+
+		if (GetCollider() != nullptr)
+		{
+			ExtrapolateIntoColliderInNarrowBand();
+		}
+	}
+
 	ScalarField3Ptr LevelSetLiquidSolver3::GetFluidSDF() const
 	{
 		return GetSignedDistanceField();
@@ -137,7 +385,7 @@ namespace CubbyFlow
 		if (m_levelSetSolver != nullptr)
 		{
 			auto sdf = GetSignedDistanceField();
-			auto sdf0 = sdf->Clone();
+			const auto& sdf1 = GetGridSystemData()->GetAdvectableScalarDataBackBufferAt(m_signedDistanceFieldId);
 
 			const Vector3D gridSpacing = sdf->GridSpacing();
 			const double h = gridSpacing.Max();
@@ -145,7 +393,8 @@ namespace CubbyFlow
 
 			CUBBYFLOW_INFO << "Max reinitialize distance: " << maxReinitDist;
 
-			m_levelSetSolver->Reinitialize(*sdf0, maxReinitDist, sdf.get());
+			m_levelSetSolver->Reinitialize(*sdf, maxReinitDist, sdf1.get());
+			sdf->Swap(sdf1.get());
 			ExtrapolateIntoCollider(sdf.get());
 		}
 	}
@@ -217,6 +466,405 @@ namespace CubbyFlow
 		ApplyBoundaryCondition();
 	}
 
+	bool LevelSetLiquidSolver3::IsNarrowBandBuilt() const
+	{
+		return m_narrowBandWidth > 0 && m_narrowBandMarker.size() == GetSignedDistanceField()->GetDataSize();
+	}
+
+	void LevelSetLiquidSolver3::BuildNarrowBand()
+	{
+		auto sdf = GetSignedDistanceField();
+		auto sdfAcc = sdf->GetDataAccessor();
+		const Size3 size = sdf->GetDataSize();
+		const double bandDist = static_cast<double>(m_narrowBandWidth) * sdf->GridSpacing().Max();
+
+		if (!IsNarrowBandBuilt())
+		{
+			m_narrowBand.Clear();
+			m_narrowBandMarker.Clear();
+			m_narrowBandMarker.Resize(size, 0);
+		}
+
+		// The cells outside of the band hold +/- the band width unless something
+		// else, such as an emitter, has changed them. Such cells either join the
+		// band (marked as 2 for now) or are clamped again. The existing band is
+		// kept, and the new cells are appended slice by slice in the grid order.
+		Array1<size_t> sliceStarts(size.z);
+		Array1<size_t> sliceInsideCounts(size.z);
+
+		ParallelFor(ZERO_SIZE, size.z, [&](size_t k)
+		{
+			size_t numberOfNewCells = 0;
+			size_t numberOfInsideCells = 0;
+
+			for (size_t j = 0; j < size.y; ++j)
+			{
+				for (size_t i = 0; i < size.x; ++i)
+				{
+					if (m_narrowBandMarker(i, j, k) != 0)
+					{
+						continue;
+					}
+
+					double& phi = sdfAcc(i, j, k);
+
+					if (std::abs(phi) < bandDist)
+					{
+						m_narrowBandMarker(i, j, k) = 2;
+						++numberOfNewCells;
+					}
+					else
+					{
+						phi = (phi < 0.0) ? -bandDist : bandDist;
+
+						if (phi < 0.0)
+						{
+							++numberOfInsideCells;
+						}
+					}
+				}
+			}
+
+			sliceStarts[k] = numberOfNewCells;
+			sliceInsideCounts[k] = numberOfInsideCells;
+		});
+
+		const size_t numberOfOldCells = m_narrowBand.size();
+		const size_t numberOfNewCells = ParallelExclusiveScan(sliceStarts.begin(), sliceStarts.end(),
+			sliceStarts.begin(), ZERO_SIZE, std::plus<size_t>());
+		m_numberOfInsideOuterCells = std::accumulate(sliceInsideCounts.begin(), sliceInsideCounts.end(), ZERO_SIZE);
+
+		m_narrowBand.Resize(numberOfOldCells + numberOfNewCells);
+
+		ParallelFor(ZERO_SIZE, size.z, [&](size_t k)
+		{
+			size_t n = numberOfOldCells + sliceStarts[k];
+
+			for (size_t j = 0; j < size.y; ++j)
+			{
+				for (size_t i = 0; i < size.x; ++i)
+				{
+					if (m_narrowBandMarker(i, j, k) == 2)
+					{
+						m_narrowBandMarker(i, j, k) = 1;
+						m_narrowBand[n++] = Point3UI(i, j, k);
+					}
+				}
+			}
+		});
+
+		if (numberOfNewCells > 0)
+		{
+			CUBBYFLOW_INFO << "Number of narrow band cells: " << m_narrowBand.size();
+		}
+	}
+
+	void LevelSetLiquidSolver3::ReinitializeNarrowBand(double currentCFL)
+	{
+		auto sdf = GetSignedDistanceField();
+		auto sdfAcc = sdf->GetDataAccessor();
+		const Size3 size = sdf->GetDataSize();
+		const Vector3D gridSpacing = sdf->GridSpacing();
+		const double bandDist = static_cast<double>(m_narrowBandWidth) * gridSpacing.Max();
+
+		// The interface moved at most the CFL number of cells during the step, so
+		// the new band is within the dilation of the previous one.
+		const size_t numberOfDilations = static_cast<size_t>(std::ceil(currentCFL)) + 1;
+
+		Array1<Point3UI> candidates(m_narrowBand);
+		size_t frontBegin = 0;
+
+		for (size_t d = 0; d < numberOfDilations; ++d)
+		{
+			const size_t frontEnd = candidates.size();
+
+			for (size_t n = frontBegin; n < frontEnd; ++n)
+			{
+				const Point3UI pt = candidates[n];
+
+				for (size_t axis = 0; axis < 3; ++axis)
+				{
+					if (pt[axis] > 0)
+					{
+						Point3UI nb = pt;
+						--nb[axis];
+						if (m_narrowBandMarker(nb) == 0)
+						{
+							m_narrowBandMarker(nb) = 1;
+							candidates.Append(nb);
+						}
+					}
+					if (pt[axis] + 1 < size[axis])
+					{
+						Point3UI nb = pt;
+						++nb[axis];
+						if (m_narrowBandMarker(nb) == 0)
+						{
+							m_narrowBandMarker(nb) = 1;
+							candidates.Append(nb);
+						}
+					}
+				}
+			}
+
+			frontBegin = frontEnd;
+		}
+
+		const size_t numberOfCandidates = candidates.size();
+		Array1<char> isInside(numberOfCandidates);
+		Array1<char> isFrozen(numberOfCandidates);
+		Array1<double> dist(numberOfCandidates);
+
+		// The cells next to the interface keep their advected values, so the
+		// reinitialization does not move the surface. The cells outside of the
+		// candidates are clamped, so they never cross the interface.
+		ParallelFor(ZERO_SIZE, numberOfCandidates, [&](size_t n)
+		{
+			const Point3UI& pt = candidates[n];
+			const double phi = sdfAcc(pt);
+			const bool inside = IsInsideSDF(phi);
+			bool isNearInterface = false;
+
+			for (size_t axis = 0; axis < 3; ++axis)
+			{
+				if (pt[axis] > 0)
+				{
+					Point3UI nb = pt;
+					--nb[axis];
+					isNearInterface |= (IsInsideSDF(sdfAcc(nb)) != inside);
+				}
+				if (pt[axis] + 1 < size[axis])
+				{
+					Point3UI nb = pt;
+					++nb[axis];
+					isNearInterface |= (IsInsideSDF(sdfAcc(nb)) != inside);
+				}
+			}
+
+			isInside[n] = inside ? 1 : 0;
+			isFrozen[n] = isNearInterface ? 1 : 0;
+			dist[n] = isNearInterface ? std::min(std::abs(phi), bandDist) : bandDist;
+		});
+
+		// Store the unsigned distance in place so the upwind update can read the
+		// neighbors. The cells outside of the candidates already hold bandDist.
+		ParallelFor(ZERO_SIZE, numberOfCandidates, [&](size_t n)
+		{
+			sdfAcc(candidates[n]) = dist[n];
+		});
+
+		// Jacobi iterations of the upwind update. The information travels one
+		// cell per iteration, so the band width bounds the number of iterations.
+		const size_t maxNumberOfIterations = static_cast<size_t>(std::ceil(std::sqrt(3.0) * static_cast<double>(m_narrowBandWidth))) + 2;
+		const double tolerance = 1e-6 * std::min({ gridSpacing.x, gridSpacing.y, gridSpacing.z });
+		const Vector3D invGridSpacingSqr = 1.0 / (gridSpacing * gridSpacing);
+
+		for (size_t iter = 0; iter < maxNumberOfIterations; ++iter)
+		{
+			const double maxChange = ParallelReduce(ZERO_SIZE, numberOfCandidates, 0.0,
+				[&](size_t begin, size_t end, double result)
+			{
+				for (size_t n = begin; n < end; ++n)
+				{
+					if (isFrozen[n])
+					{
+						continue;
+					}
+
+					const Point3UI& pt = candidates[n];
+					double phiMin[3];
+
+					for (size_t axis = 0; axis < 3; ++axis)
+					{
+						phiMin[axis] = bandDist;
+
+						if (pt[axis] > 0)
+						{
+							Point3UI nb = pt;
+							--nb[axis];
+							phiMin[axis] = std::min(phiMin[axis], std::abs(sdfAcc(nb)));
+						}
+						if (pt[axis] + 1 < size[axis])
+						{
+							Point3UI nb = pt;
+							++nb[axis];
+							phiMin[axis] = std::min(phiMin[axis], std::abs(sdfAcc(nb)));
+						}
+					}
+
+					const double solution = std::min(
+						SolveEikonal(phiMin[0], phiMin[1], phiMin[2], gridSpacing, invGridSpacingSqr),
+						dist[n]);
+					result = std::max(result, dist[n] - solution);
+					dist[n] = solution;
+				}
+
+				return result;
+			},
+				[](double a, double b)
+			{
+				return std::max(a, b);
+			});
+
+			ParallelFor(ZERO_SIZE, numberOfCandidates, [&](size_t n)
+			{
+				sdfAcc(candidates[n]) = dist[n];
+			});
+
+			if (maxChange <= tolerance)
+			{
+				break;
+			}
+		}
+
+		// Restore the signs and rebuild the band from the candidates. The
+		// candidates after the previous band came from the outside of it.
+		const size_t numberOfOldCells = m_narrowBand.size();
+		m_narrowBand.Clear();
+
+		for (size_t n = 0; n < numberOfCandidates; ++n)
+		{
+			const Point3UI& pt = candidates[n];
+
+			if (n >= numberOfOldCells && isInside[n])
+			{
+				--m_numberOfInsideOuterCells;
+			}
+
+			if (dist[n] < bandDist)
+			{
+				sdfAcc(pt) = isInside[n] ? -dist[n] : dist[n];
+				m_narrowBand.Append(pt);
+			}
+			else
+			{
+				sdfAcc(pt) = isInside[n] ? -bandDist : bandDist;
+				m_narrowBandMarker(pt) = 0;
+
+				if (isInside[n])
+				{
+					++m_numberOfInsideOuterCells;
+				}
+			}
+		}
+
+		CUBBYFLOW_INFO << "Number of narrow band cells: " << m_narrowBand.size();
+
+		if (GetCollider() != nullptr)
+		{
+			ExtrapolateIntoColliderInNarrowBand();
+		}
+	}
+
+	void LevelSetLiquidSolver3::ExtrapolateVelocityToAirInNarrowBand()
+	{
+		auto sdf = GetSignedDistanceField();
+		auto vel = GetGridSystemData()->GetVelocity();
+		const auto sdfAcc = sdf->GetConstDataAccessor();
+
+		ExtrapolateFaceComponentInNarrowBand(m_narrowBand, sdfAcc, 0, vel->GetUAccessor(), &m_uMarker);
+		ExtrapolateFaceComponentInNarrowBand(m_narrowBand, sdfAcc, 1, vel->GetVAccessor(), &m_vMarker);
+		ExtrapolateFaceComponentInNarrowBand(m_narrowBand, sdfAcc, 2, vel->GetWAccessor(), &m_wMarker);
+
+		ApplyBoundaryCondition();
+	}
+
+	void LevelSetLiquidSolver3::ExtrapolateIntoColliderInNarrowBand()
+	{
+		auto sdf = GetSignedDistanceField();
+		auto sdfAcc = sdf->GetDataAccessor();
+		auto pos = sdf->GetDataPosition();
+		const Size3 size = sdf->GetDataSize();
+		const ScalarField3Ptr colliderSDF = GetColliderSDF();
+
+		auto isInsideCollider = [&](const Point3UI& pt)
+		{
+			return IsInsideSDF(colliderSDF->Sample(pos(pt.x, pt.y, pt.z)));
+		};
+
+		// The band cells inside the collider are unknown (marked as 2) and are
+		// resolved layer by layer, each one taking the average of its valid
+		// neighbors like ExtrapolateToRegion. The cells outside of the band keep
+		// their clamped values.
+		Array1<Point3UI> unknowns(m_narrowBand.size());
+		const size_t numberOfUnknowns = ParallelCompact(m_narrowBand.begin(), m_narrowBand.end(),
+			unknowns.begin(), isInsideCollider);
+		unknowns.Resize(numberOfUnknowns);
+
+		ParallelFor(ZERO_SIZE, numberOfUnknowns, [&](size_t n)
+		{
+			m_narrowBandMarker(unknowns[n]) = 2;
+		});
+
+		Array1<double> newValues(numberOfUnknowns);
+		Array1<char> isResolved(numberOfUnknowns);
+		const unsigned int depth = static_cast<unsigned int>(std::ceil(GetMaxCFL()));
+
+		for (unsigned int iter = 0; iter < depth; ++iter)
+		{
+			ParallelFor(ZERO_SIZE, numberOfUnknowns, [&](size_t n)
+			{
+				const Point3UI& pt = unknowns[n];
+				isResolved[n] = 0;
+
+				if (m_narrowBandMarker(pt) != 2)
+				{
+					return;
+				}
+
+				double sum = 0.0;
+				size_t count = 0;
+
+				auto accumulate = [&](const Point3UI& nb)
+				{
+					const char m = m_narrowBandMarker(nb);
+					if (m == 1 || (m == 0 && !isInsideCollider(nb)))
+					{
+						sum += sdfAcc(nb);
+						++count;
+					}
+				};
+
+				for (size_t axis = 0; axis < 3; ++axis)
+				{
+					if (pt[axis] > 0)
+					{
+						Point3UI nb = pt;
+						--nb[axis];
+						accumulate(nb);
+					}
+					if (pt[axis] + 1 < size[axis])
+					{
+						Point3UI nb = pt;
+						++nb[axis];
+						accumulate(nb);
+					}
+				}
+
+				if (count > 0)
+				{
+					newValues[n] = sum / static_cast<double>(count);
+					isResolved[n] = 1;
+				}
+			});
+
+			ParallelFor(ZERO_SIZE, numberOfUnknowns, [&](size_t n)
+			{
+				if (isResolved[n])
+				{
+					sdfAcc(unknowns[n]) = newValues[n];
+					m_narrowBandMarker(unknowns[n]) = 1;
+				}
+			});
+		}
+
+		// Leave the marker clean for the next step
+		ParallelFor(ZERO_SIZE, numberOfUnknowns, [&](size_t n)
+		{
+			m_narrowBandMarker(unknowns[n]) = 1;
+		});
+	}
+
 	void LevelSetLiquidSolver3::AddVolume(double volDiff)
 	{
 		auto sdf = GetSignedDistanceField();
@@ -224,6 +872,39 @@ namespace CubbyFlow
 		const double cellVolume = gridSpacing.x * gridSpacing.y * gridSpacing.z;
 		const double h = gridSpacing.Max();
 
+		if (IsNarrowBandBuilt())
+		{
+			// Only the band is shifted, so the clamped cells outside of it do not
+			// change the volume.
+			auto sdfAcc = sdf->GetDataAccessor();
+
+			const double dVolume = ParallelReduce(ZERO_SIZE, m_narrowBand.size(), 0.0,
+				[&](size_t begin, size_t end, double result)
+			{
+				for (size_t n = begin; n < end; ++n)
+				{
+					const double phi = sdfAcc(m_narrowBand[n]) / h;
+					result += SmearedHeavisideSDF(phi) - SmearedHeavisideSDF(phi + 1.0);
+				}
+
+				return result;
+			}, std::plus<double>());
+
+			const double dVdh = dVolume * cellVolume / h;
+
+			if (std::abs(dVdh) > 0.0)
+			{
+				const double dist = volDiff / dVdh;
+
+				ParallelFor(ZERO_SIZE, m_narrowBand.size(), [&](size_t n)
+				{
+					sdfAcc(m_narrowBand[n]) += dist;
+				});
+			}
+
+			return;
+		}
+
 		double volume0 = 0.0;
 		double volume1 = 0.0;
 		sdf->ForEachDataPointIndex([&](size_t i, size_t j, size_t k)
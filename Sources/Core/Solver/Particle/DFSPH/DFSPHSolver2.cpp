@@ -0,0 +1,382 @@
+/*************************************************************************
+> File Name: DFSPHSolver2.cpp
+> Project Name: CubbyFlow
+> Author: Chan-Ho Chris Ohk
+> Purpose: 2-D DFSPH solver.
+> Created Time: 2026/10/19
+> Copyright (c) 2018, Chan-Ho Chris Ohk
+*************************************************************************/
+#include <Core/Solver/Particle/DFSPH/DFSPHSolver2.h>
+#include <Core/SPH/SPHStdKernel2.h>
+#include <Core/Utils/Logging.h>
+
+#include <functional>
+
+namespace CubbyFlow
+{
+	// Fraction of the particle spacing a particle may travel in one sub-step
+	const double CFL_FACTOR = 0.4;
+
+	// Stiffness factors of particles with a smaller denominator are zeroed
+	const double ALPHA_DENOMINATOR_EPSILON = 1e-6;
+
+	DFSPHSolver2::DFSPHSolver2()
+	{
+		// Do nothing
+	}
+
+	DFSPHSolver2::DFSPHSolver2(double targetDensity, double targetSpacing, double relativeKernelRadius) :
+		SPHSolver2(targetDensity, targetSpacing, relativeKernelRadius)
+	{
+		// Do nothing
+	}
+
+	DFSPHSolver2::~DFSPHSolver2()
+	{
+		// Do nothing
+	}
+
+	double DFSPHSolver2::GetMaxDensityErrorRatio() const
+	{
+		return m_maxDensityErrorRatio;
+	}
+
+	void DFSPHSolver2::SetMaxDensityErrorRatio(double ratio)
+	{
+		m_maxDensityErrorRatio = std::max(ratio, 0.0);
+	}
+
+	double DFSPHSolver2::GetMaxDivergenceErrorRatio() const
+	{
+		return m_maxDivergenceErrorRatio;
+	}
+
+	void DFSPHSolver2::SetMaxDivergenceErrorRatio(double ratio)
+	{
+		m_maxDivergenceErrorRatio = std::max(ratio, 0.0);
+	}
+
+	unsigned int DFSPHSolver2::GetMaxNumberOfIterations() const
+	{
+		return m_maxNumberOfIterations;
+	}
+
+	void DFSPHSolver2::SetMaxNumberOfIterations(unsigned int n)
+	{
+		m_maxNumberOfIterations = n;
+	}
+
+	unsigned int DFSPHSolver2::GetNumberOfSubTimeSteps(double timeIntervalInSeconds) const
+	{
+		auto particles = GetSPHSystemData();
+		const size_t numberOfParticles = particles->GetNumberOfParticles();
+		auto v = particles->GetVelocities();
+		const Vector2D gravityVelocity = timeIntervalInSeconds * GetGravity();
+
+		const double maxSpeed = ParallelReduce(ZERO_SIZE, numberOfParticles, 0.0,
+			[&](size_t begin, size_t end, double init)
+		{
+			double result = init;
+
+			for (size_t i = begin; i < end; ++i)
+			{
+				result = std::max(result, (v[i] + gravityVelocity).Length());
+			}
+
+			return result;
+		}, [](double a, double b) { return std::max(a, b); });
+
+		if (maxSpeed <= 0.0)
+		{
+			return 1;
+		}
+
+		const double desiredTimeStep = GetTimeStepLimitScale() * CFL_FACTOR * particles->GetTargetSpacing() / maxSpeed;
+
+		return std::max(static_cast<unsigned int>(std::ceil(timeIntervalInSeconds / desiredTimeStep)), 1u);
+	}
+
+	void DFSPHSolver2::AccumulatePressureForce(double timeIntervalInSeconds)
+	{
+		auto particles = GetSPHSystemData();
+		const size_t numberOfParticles = particles->GetNumberOfParticles();
+		const double mass = particles->GetMass();
+
+		auto p = particles->GetPressures();
+		auto v = particles->GetVelocities();
+		auto f = particles->GetForces();
+
+		if (numberOfParticles == 0)
+		{
+			return;
+		}
+
+		ComputeAlphas();
+
+		// Make the current velocity field divergence-free
+		ParallelFor(ZERO_SIZE, numberOfParticles, [&](size_t i)
+		{
+			m_tempVelocities[i] = v[i];
+		});
+
+		const unsigned int numDivergenceIter = CorrectDivergenceError(timeIntervalInSeconds);
+
+		// Predict the velocity with the non-pressure forces and remove the
+		// density error it would cause
+		ParallelFor(ZERO_SIZE, numberOfParticles, [&](size_t i)
+		{
+			m_tempVelocities[i] += timeIntervalInSeconds / mass * f[i];
+		});
+
+		const unsigned int numDensityIter = CorrectDensityError(timeIntervalInSeconds);
+
+		CUBBYFLOW_INFO << "Number of DFSPH divergence iterations: " << numDivergenceIter;
+		CUBBYFLOW_INFO << "Number of DFSPH density iterations: " << numDensityIter;
+
+		// Express the corrected velocity as the total force for the integrator.
+		// The stiffness of the density solve is kept as the particle pressure.
+		ParallelFor(ZERO_SIZE, numberOfParticles, [&](size_t i)
+		{
+			f[i] = mass * (m_tempVelocities[i] - v[i]) / timeIntervalInSeconds;
+			p[i] = m_kappas[i];
+		});
+	}
+
+	void DFSPHSolver2::OnBeginAdvanceTimeStep(double timeStepInSeconds)
+	{
+		SPHSolver2::OnBeginAdvanceTimeStep(timeStepInSeconds);
+
+		// Allocate temp buffers
+		size_t numberOfParticles = GetParticleSystemData()->GetNumberOfParticles();
+		m_tempPositions.Resize(numberOfParticles);
+		m_tempVelocities.Resize(numberOfParticles);
+		m_alphas.Resize(numberOfParticles);
+		m_kappas.Resize(numberOfParticles);
+	}
+
+	void DFSPHSolver2::ComputeAlphas()
+	{
+		auto particles = GetSPHSystemData();
+		const size_t numberOfParticles = particles->GetNumberOfParticles();
+		const double mass = particles->GetMass();
+
+		auto x = particles->GetPositions();
+		auto d = particles->GetDensities();
+
+		const SPHSpikyKernel2 kernel(particles->GetKernelRadius());
+
+		// See Equation 11 from Bender and Koschier's 2015 paper
+		ParallelFor(ZERO_SIZE, numberOfParticles, [&](size_t i)
+		{
+			Vector2D gradSum;
+			double gradSquaredSum = 0.0;
+
+			const auto& neighbors = particles->GetNeighborLists()[i];
+			for (size_t j : neighbors)
+			{
+				double dist = x[i].DistanceTo(x[j]);
+				if (dist > 0.0 && dist < kernel.h)
+				{
+					Vector2D grad = mass * kernel.Gradient(dist, (x[j] - x[i]) / dist);
+					gradSum += grad;
+					gradSquaredSum += grad.Dot(grad);
+				}
+			}
+
+			double denom = gradSum.Dot(gradSum) + gradSquaredSum;
+			m_alphas[i] = (denom > ALPHA_DENOMINATOR_EPSILON) ? d[i] / denom : 0.0;
+		});
+	}
+
+	unsigned int DFSPHSolver2::CorrectDivergenceError(double timeIntervalInSeconds)
+	{
+		auto particles = GetSPHSystemData();
+		const size_t numberOfParticles = particles->GetNumberOfParticles();
+		const double targetDensity = particles->GetTargetDensity();
+
+		double averageErrorRatio = 0.0;
+		unsigned int numIter = 0;
+
+		for (; numIter < m_maxNumberOfIterations; ++numIter)
+		{
+			ResolvePredictedCollision(timeIntervalInSeconds);
+
+			// Only compression is corrected, so the free surface stays free
+			const double errorSum = ParallelReduce(ZERO_SIZE, numberOfParticles, 0.0,
+				[&](size_t begin, size_t end, double init)
+			{
+				double result = init;
+
+				for (size_t i = begin; i < end; ++i)
+				{
+					const double densityChangeRate = std::max(ComputeDensityChangeRate(*particles, i), 0.0);
+					m_kappas[i] = densityChangeRate * m_alphas[i] / timeIntervalInSeconds;
+					result += densityChangeRate;
+				}
+
+				return result;
+			}, std::plus<double>());
+
+			averageErrorRatio = errorSum / numberOfParticles * timeIntervalInSeconds / targetDensity;
+			if (averageErrorRatio < m_maxDivergenceErrorRatio)
+			{
+				break;
+			}
+
+			ApplyKappas(timeIntervalInSeconds);
+		}
+
+		if (averageErrorRatio > m_maxDivergenceErrorRatio)
+		{
+			CUBBYFLOW_WARN << "Average divergence error ratio is greater than the threshold!";
+			CUBBYFLOW_WARN << "Ratio: " << averageErrorRatio
+				<< " Threshold: " << m_maxDivergenceErrorRatio;
+		}
+
+		return numIter;
+	}
+
+	unsigned int DFSPHSolver2::CorrectDensityError(double timeIntervalInSeconds)
+	{
+		auto particles = GetSPHSystemData();
+		const size_t numberOfParticles = particles->GetNumberOfParticles();
+		const double targetDensity = particles->GetTargetDensity();
+		auto d = particles->GetDensities();
+
+		const double squaredTimeInterval = Square(timeIntervalInSeconds);
+
+		double averageErrorRatio = 0.0;
+		unsigned int numIter = 0;
+
+		for (; numIter < m_maxNumberOfIterations; ++numIter)
+		{
+			ResolvePredictedCollision(timeIntervalInSeconds);
+
+			// Predicted density error, clamped at the rest density like the
+			// divergence solve
+			const double errorSum = ParallelReduce(ZERO_SIZE, numberOfParticles, 0.0,
+				[&](size_t begin, size_t end, double init)
+			{
+				double result = init;
+
+				for (size_t i = begin; i < end; ++i)
+				{
+					const double predictedDensity = d[i] + timeIntervalInSeconds * ComputeDensityChangeRate(*particles, i);
+					const double densityError = std::max(predictedDensity - targetDensity, 0.0);
+					m_kappas[i] = densityError * m_alphas[i] / squaredTimeInterval;
+					result += densityError;
+				}
+
+				return result;
+			}, std::plus<double>());
+
+			averageErrorRatio = errorSum / numberOfParticles / targetDensity;
+			if (averageErrorRatio < m_maxDensityErrorRatio)
+			{
+				break;
+			}
+
+			ApplyKappas(timeIntervalInSeconds);
+		}
+
+		if (averageErrorRatio > m_maxDensityErrorRatio)
+		{
+			CUBBYFLOW_WARN << "Average density error ratio is greater than the threshold!";
+			CUBBYFLOW_WARN << "Ratio: " << averageErrorRatio
+				<< " Threshold: " << m_maxDensityErrorRatio;
+		}
+
+		return numIter;
+	}
+
+	void DFSPHSolver2::ResolvePredictedCollision(double timeIntervalInSeconds)
+	{
+		auto particles = GetSPHSystemData();
+		const size_t numberOfParticles = particles->GetNumberOfParticles();
+		auto x = particles->GetPositions();
+
+		// There are no boundary particles, so the velocities that would push
+		// the particles into the collider are removed before they are measured
+		ParallelFor(ZERO_SIZE, numberOfParticles, [&](size_t i)
+		{
+			m_tempPositions[i] = x[i] + timeIntervalInSeconds * m_tempVelocities[i];
+		});
+
+		ResolveCollision(m_tempPositions, m_tempVelocities);
+	}
+
+	double DFSPHSolver2::ComputeDensityChangeRate(const SPHSystemData2& particles, size_t i) const
+	{
+		const double mass = particles.GetMass();
+		auto x = particles.GetPositions();
+
+		const SPHSpikyKernel2 kernel(particles.GetKernelRadius());
+
+		double densityChangeRate = 0.0;
+
+		const auto& neighbors = particles.GetNeighborLists()[i];
+		for (size_t j : neighbors)
+		{
+			double dist = x[i].DistanceTo(x[j]);
+			if (dist > 0.0 && dist < kernel.h)
+			{
+				densityChangeRate += mass * (m_tempVelocities[i] - m_tempVelocities[j]).Dot(
+					kernel.Gradient(dist, (x[j] - x[i]) / dist));
+			}
+		}
+
+		return densityChangeRate;
+	}
+
+	void DFSPHSolver2::ApplyKappas(double timeIntervalInSeconds)
+	{
+		auto particles = GetSPHSystemData();
+		const size_t numberOfParticles = particles->GetNumberOfParticles();
+		const double mass = particles->GetMass();
+
+		auto x = particles->GetPositions();
+		auto d = particles->GetDensities();
+
+		const SPHSpikyKernel2 kernel(particles->GetKernelRadius());
+
+		// See Equation 9 from Bender and Koschier's 2015 paper
+		ParallelFor(ZERO_SIZE, numberOfParticles, [&](size_t i)
+		{
+			const double kappaI = m_kappas[i] / d[i];
+			Vector2D deltaVelocity;
+
+			const auto& neighbors = particles->GetNeighborLists()[i];
+			for (size_t j : neighbors)
+			{
+				double dist = x[i].DistanceTo(x[j]);
+				if (dist > 0.0 && dist < kernel.h)
+				{
+					deltaVelocity -= timeIntervalInSeconds * mass * (kappaI + m_kappas[j] / d[j])
+						* kernel.Gradient(dist, (x[j] - x[i]) / dist);
+				}
+			}
+
+			m_tempVelocities[i] += deltaVelocity;
+		});
+	}
+
+	DFSPHSolver2::Builder DFSPHSolver2::GetBuilder()
+	{
+		return Builder();
+	}
+
+	DFSPHSolver2 DFSPHSolver2::Builder::Build() const
+	{
+		return DFSPHSolver2(m_targetDensity, m_targetSpacing, m_relativeKernelRadius);
+	}
+
+	DFSPHSolver2Ptr DFSPHSolver2::Builder::MakeShared() const
+	{
+		return std::shared_ptr<DFSPHSolver2>(
+			new DFSPHSolver2(m_targetDensity, m_targetSpacing, m_relativeKernelRadius),
+			[](DFSPHSolver2* obj)
+		{
+			delete obj;
+		});
+	}
+}
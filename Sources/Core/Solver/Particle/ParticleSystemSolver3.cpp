@@ -102,6 +102,16 @@ namespace CubbyFlow
 		m_wind = newWind;
 	}
 
+	const ImplicitSurface3Ptr& ParticleSystemSolver3::GetKillVolume() const
+	{
+		return m_killVolume;
+	}
+
+	void ParticleSystemSolver3::SetKillVolume(const ImplicitSurface3Ptr& newKillVolume)
+	{
+		m_killVolume = newKillVolume;
+	}
+
 	void ParticleSystemSolver3::OnInitialize()
 	{
 		// When initializing the solver, update the collider and emitter state as
@@ -186,6 +196,8 @@ namespace CubbyFlow
 		});
 
 		OnEndAdvanceTimeStep(timeStepInSeconds);
+
+		RemoveParticlesInKillVolume();
 	}
 
 	void ParticleSystemSolver3::OnBeginAdvanceTimeStep(double timeStepInSeconds)
@@ -285,6 +297,25 @@ namespace CubbyFlow
 		}
 	}
 
+	void ParticleSystemSolver3::RemoveParticlesInKillVolume()
+	{
+		if (m_killVolume == nullptr)
+		{
+			return;
+		}
+
+		Timer timer;
+		auto positions = m_particleSystemData->GetPositions();
+
+		const size_t numberOfRemovedParticles = m_particleSystemData->RemoveParticles([&](size_t i)
+		{
+			return m_killVolume->SignedDistance(positions[i]) < 0.0;
+		});
+
+		CUBBYFLOW_INFO << "Removing " << numberOfRemovedParticles
+			<< " particles took " << timer.DurationInSeconds() << " seconds";
+	}
+
 	ParticleSystemSolver3::Builder ParticleSystemSolver3::GetBuilder()
 	{
 		return Builder();
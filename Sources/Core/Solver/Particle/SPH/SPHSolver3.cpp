@@ -140,8 +140,7 @@ namespace CubbyFlow
 		auto particles = GetSPHSystemData();
 
 		Timer timer;
-		particles->BuildNeighborSearcher();
-		particles->BuildNeighborLists();
+		particles->UpdateNeighborLists();
 		particles->UpdateDensities();
 
 		CUBBYFLOW_INFO << "Building neighbor lists and updating densities took "
@@ -224,7 +223,7 @@ namespace CubbyFlow
 			for (size_t j : neighbors)
 			{
 				double dist = positions[i].DistanceTo(positions[j]);
-				if (dist > 0.0)
+				if (dist > 0.0 && dist < kernel.h)
 				{
 					Vector3D dir = (positions[j] - positions[i]) / dist;
 					pressureForces[i] -= massSquared * (pressures[i] / (densities[i] * densities[i])
@@ -252,8 +251,10 @@ namespace CubbyFlow
 			for (size_t j : neighbors)
 			{
 				double dist = x[i].DistanceTo(x[j]);
-
-				f[i] += GetViscosityCoefficient() * massSquared * (v[j] - v[i]) / d[j] * kernel.SecondDerivative(dist);
+				if (dist < kernel.h)
+				{
+					f[i] += GetViscosityCoefficient() * massSquared * (v[j] - v[i]) / d[j] * kernel.SecondDerivative(dist);
+				}
 			}
 		});
 	}
@@ -280,9 +281,12 @@ namespace CubbyFlow
 			for (size_t j : neighbors)
 			{
 				double dist = x[i].DistanceTo(x[j]);
-				double wj = mass / d[j] * kernel(dist);
-				weightSum += wj;
-				smoothedVelocity += wj * v[j];
+				if (dist < kernel.h)
+				{
+					double wj = mass / d[j] * kernel(dist);
+					weightSum += wj;
+					smoothedVelocity += wj * v[j];
+				}
 			}
 
 			double wi = mass / d[i];
@@ -15,13 +15,90 @@
 #include <omp.h>
 #endif
 
+#include <algorithm>
 #include <memory>
 #include <thread>
 
 static unsigned int MAX_NUMBER_OF_THREADS = std::thread::hardware_concurrency();
+static size_t PARALLEL_FOR_TILE_SIZE[3] = { 1024, 8, 8 };
+static thread_local CubbyFlow::ParallelExecutor* CURRENT_EXECUTOR = nullptr;
 
 namespace CubbyFlow
 {
+	struct ParallelExecutor::Arena
+	{
+#if defined(CUBBYFLOW_TASKING_TBB)
+		explicit Arena(unsigned int numThreads) : arena(static_cast<int>(numThreads))
+		{
+			// Do nothing
+		}
+
+		tbb::task_arena arena;
+#else
+		explicit Arena(unsigned int numThreads)
+		{
+			(void)numThreads;
+		}
+#endif
+	};
+
+	ParallelExecutor::ParallelExecutor(unsigned int numThreads) :
+		m_numThreads(std::max(numThreads, 1u)), m_arena(new Arena(m_numThreads))
+	{
+		// Do nothing
+	}
+
+	ParallelExecutor::~ParallelExecutor()
+	{
+		// Do nothing
+	}
+
+	unsigned int ParallelExecutor::GetNumberOfThreads() const
+	{
+		return m_numThreads;
+	}
+
+	void ParallelExecutor::Execute(const std::function<void()>& function)
+	{
+		Scope scope(this);
+
+#if defined(CUBBYFLOW_TASKING_TBB)
+		m_arena->arena.execute(function);
+#elif defined(CUBBYFLOW_TASKING_OPENMP)
+		const int oldNumThreads = omp_get_max_threads();
+		omp_set_num_threads(static_cast<int>(m_numThreads));
+
+		try
+		{
+			function();
+		}
+		catch (...)
+		{
+			omp_set_num_threads(oldNumThreads);
+			throw;
+		}
+
+		omp_set_num_threads(oldNumThreads);
+#else
+		function();
+#endif
+	}
+
+	ParallelExecutor* ParallelExecutor::GetCurrent()
+	{
+		return CURRENT_EXECUTOR;
+	}
+
+	ParallelExecutor::Scope::Scope(ParallelExecutor* executor) : m_previous(CURRENT_EXECUTOR)
+	{
+		CURRENT_EXECUTOR = executor;
+	}
+
+	ParallelExecutor::Scope::~Scope()
+	{
+		CURRENT_EXECUTOR = m_previous;
+	}
+
 	void SetMaxNumberOfThreads(unsigned int numThreads)
 	{
 #if defined(CUBBYFLOW_TASKING_TBB)
@@ -44,6 +121,25 @@ namespace CubbyFlow
 
 	unsigned int GetMaxNumberOfThreads()
 	{
+		if (CURRENT_EXECUTOR != nullptr)
+		{
+			return CURRENT_EXECUTOR->GetNumberOfThreads();
+		}
+
 		return MAX_NUMBER_OF_THREADS;
 	}
+
+	void SetParallelForTileSize(size_t tileSizeX, size_t tileSizeY, size_t tileSizeZ)
+	{
+		PARALLEL_FOR_TILE_SIZE[0] = std::max(tileSizeX, static_cast<size_t>(1));
+		PARALLEL_FOR_TILE_SIZE[1] = std::max(tileSizeY, static_cast<size_t>(1));
+		PARALLEL_FOR_TILE_SIZE[2] = std::max(tileSizeZ, static_cast<size_t>(1));
+	}
+
+	void GetParallelForTileSize(size_t* tileSizeX, size_t* tileSizeY, size_t* tileSizeZ)
+	{
+		*tileSizeX = PARALLEL_FOR_TILE_SIZE[0];
+		*tileSizeY = PARALLEL_FOR_TILE_SIZE[1];
+		*tileSizeZ = PARALLEL_FOR_TILE_SIZE[2];
+	}
 }
\ No newline at end of file
@@ -28,6 +28,8 @@ CUBBYFLOW_BEGIN_TEST_F(PointHashGridSearcher2, Build)
 	PointHashGridSearcher2 pointSearcher(4, 4, 0.18);
 	pointSearcher.Build(ArrayAccessor1<Vector2D>(points.size(), points.data()));
 
+	const auto& bucketStarts = pointSearcher.GetBucketStarts();
+
 	Array2<double> grid(4, 4, 0.0);
 
 	for (size_t j = 0; j < grid.size().y; ++j)
@@ -35,7 +37,7 @@ CUBBYFLOW_BEGIN_TEST_F(PointHashGridSearcher2, Build)
 		for (size_t i = 0; i < grid.size().x; ++i)
 		{
 			size_t key = pointSearcher.GetHashKeyFromBucketIndex(Point2I(static_cast<ssize_t>(i), static_cast<ssize_t>(j)));
-			size_t value = pointSearcher.GetBuckets()[key].size();
+			size_t value = bucketStarts[key + 1] - bucketStarts[key];
 			grid(i, j) += static_cast<double>(value);
 		}
 	}
@@ -58,6 +60,8 @@ CUBBYFLOW_BEGIN_TEST_F(PointHashGridSearcher3, Build)
 	PointHashGridSearcher3 pointSearcher(4, 4, 4, 0.18);
 	pointSearcher.Build(ArrayAccessor1<Vector3D>(points.size(), points.data()));
 
+	const auto& bucketStarts = pointSearcher.GetBucketStarts();
+
 	Array2<double> grid(4, 4, 0.0);
 
 	for (size_t j = 0; j < grid.size().y; ++j)
@@ -65,7 +69,7 @@ CUBBYFLOW_BEGIN_TEST_F(PointHashGridSearcher3, Build)
 		for (size_t i = 0; i < grid.size().x; ++i)
 		{
 			size_t key = pointSearcher.GetHashKeyFromBucketIndex(Point3I(static_cast<ssize_t>(i), static_cast<ssize_t>(j), 0));
-			size_t value = pointSearcher.GetBuckets()[key].size();
+			size_t value = bucketStarts[key + 1] - bucketStarts[key];
 			grid(i, j) += static_cast<double>(value);
 		}
 	}
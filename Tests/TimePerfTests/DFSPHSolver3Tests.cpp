@@ -0,0 +1,100 @@
+#include "benchmark/benchmark.h"
+
+#include <Core/Collider/RigidBodyCollider3.h>
+#include <Core/Emitter/VolumeParticleEmitter3.h>
+#include <Core/Geometry/Box3.h>
+#include <Core/Solver/Particle/DFSPH/DFSPHSolver3.h>
+#include <Core/Solver/Particle/PCISPH/PCISPHSolver3.h>
+
+using CubbyFlow::BoundingBox3D;
+using CubbyFlow::Box3;
+using CubbyFlow::Frame;
+using CubbyFlow::RigidBodyCollider3;
+using CubbyFlow::SPHSolver3Ptr;
+using CubbyFlow::Vector3D;
+using CubbyFlow::VolumeParticleEmitter3;
+
+namespace
+{
+    const double TARGET_SPACING = 0.05;
+
+    // Small version of the dam-breaking scene of the SPHSim example
+    void BuildDamBreakingScene(const SPHSolver3Ptr& solver)
+    {
+        const BoundingBox3D domain(Vector3D(), Vector3D(1.5, 1, 0.5));
+
+        BoundingBox3D sourceBound(domain);
+        sourceBound.Expand(-TARGET_SPACING);
+
+        const auto column = Box3::GetBuilder()
+            .WithLowerCorner({ 0, 0, 0 })
+            .WithUpperCorner({ 0.5, 0.75, 0.5 })
+            .MakeShared();
+
+        const auto emitter = VolumeParticleEmitter3::GetBuilder()
+            .WithSurface(column)
+            .WithMaxRegion(sourceBound)
+            .WithSpacing(TARGET_SPACING)
+            .MakeShared();
+        solver->SetEmitter(emitter);
+
+        const auto box = Box3::GetBuilder()
+            .WithIsNormalFlipped(true)
+            .WithBoundingBox(domain)
+            .MakeShared();
+        solver->SetCollider(RigidBodyCollider3::GetBuilder().WithSurface(box).MakeShared());
+
+        solver->SetPseudoViscosityCoefficient(0.0);
+    }
+
+    void RunFrames(const SPHSolver3Ptr& solver, int numberOfFrames)
+    {
+        for (Frame frame(0, 1.0 / 60.0); frame.index < numberOfFrames; ++frame)
+        {
+            solver->Update(frame);
+        }
+    }
+}
+
+static void PCISPHSolver3DamBreaking(benchmark::State& state)
+{
+    const int numberOfFrames = static_cast<int>(state.range(0));
+
+    while (state.KeepRunning())
+    {
+        auto solver = CubbyFlow::PCISPHSolver3::GetBuilder()
+            .WithTargetDensity(1000.0)
+            .WithTargetSpacing(TARGET_SPACING)
+            .MakeShared();
+        solver->SetTimeStepLimitScale(10.0);
+        BuildDamBreakingScene(solver);
+
+        RunFrames(solver, numberOfFrames);
+    }
+}
+
+BENCHMARK(PCISPHSolver3DamBreaking)
+->Unit(benchmark::kMillisecond)
+->UseRealTime()
+->Arg(30);
+
+static void DFSPHSolver3DamBreaking(benchmark::State& state)
+{
+    const int numberOfFrames = static_cast<int>(state.range(0));
+
+    while (state.KeepRunning())
+    {
+        auto solver = CubbyFlow::DFSPHSolver3::GetBuilder()
+            .WithTargetDensity(1000.0)
+            .WithTargetSpacing(TARGET_SPACING)
+            .MakeShared();
+        BuildDamBreakingScene(solver);
+
+        RunFrames(solver, numberOfFrames);
+    }
+}
+
+BENCHMARK(DFSPHSolver3DamBreaking)
+->Unit(benchmark::kMillisecond)
+->UseRealTime()
+->Arg(30);
@@ -0,0 +1,71 @@
+#include "benchmark/benchmark.h"
+
+#include <Core/Array/Array1.h>
+#include <Core/Grid/FaceCenteredGrid3.h>
+#include <Core/Utils/Constants.h>
+#include <Core/Utils/Parallel.h>
+
+#include <random>
+
+using CubbyFlow::Array1;
+using CubbyFlow::Vector3D;
+
+class FaceCenteredGrid3 : public ::benchmark::Fixture
+{
+protected:
+    std::mt19937 rng{ 0 };
+    std::uniform_real_distribution<> dist{ 0.0, 1.0 };
+    CubbyFlow::FaceCenteredGrid3 grid;
+    Array1<Vector3D> points;
+    Array1<Vector3D> results;
+
+    void SetUp(const ::benchmark::State& state)
+    {
+        int N = state.range(0);
+
+        grid.Resize(CubbyFlow::Size3(64, 64, 64), Vector3D(1.0, 1.0, 1.0) / 64.0);
+        grid.Fill([](const Vector3D& x)
+        {
+            return Vector3D(x.y, -x.x, x.z * x.x);
+        });
+
+        points.Clear();
+        for (int i = 0; i < N; ++i)
+        {
+            points.Append(Vector3D(dist(rng), dist(rng), dist(rng)));
+        }
+
+        results.Resize(points.size());
+    }
+};
+
+BENCHMARK_DEFINE_F(FaceCenteredGrid3, Sample)(benchmark::State& state)
+{
+    while (state.KeepRunning())
+    {
+        CubbyFlow::ParallelFor(CubbyFlow::ZERO_SIZE, points.size(), [&](size_t i)
+        {
+            results[i] = grid.Sample(points[i]);
+        });
+    }
+}
+
+BENCHMARK_REGISTER_F(FaceCenteredGrid3, Sample)
+->UseRealTime()
+->Arg(1 << 10)
+->Arg(1 << 16)
+->Arg(1 << 20);
+
+BENCHMARK_DEFINE_F(FaceCenteredGrid3, BatchSample)(benchmark::State& state)
+{
+    while (state.KeepRunning())
+    {
+        grid.BatchSample(points.ConstAccessor(), results.Accessor());
+    }
+}
+
+BENCHMARK_REGISTER_F(FaceCenteredGrid3, BatchSample)
+->UseRealTime()
+->Arg(1 << 10)
+->Arg(1 << 16)
+->Arg(1 << 20);
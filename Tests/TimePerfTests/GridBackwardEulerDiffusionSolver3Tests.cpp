@@ -0,0 +1,71 @@
+#include "benchmark/benchmark.h"
+
+#include <Core/Grid/CellCenteredScalarGrid3.h>
+#include <Core/Grid/CellCenteredVectorGrid3.h>
+#include <Core/Solver/Grid/GridBackwardEulerDiffusionSolver3.h>
+
+using CubbyFlow::CellCenteredScalarGrid3;
+using CubbyFlow::CellCenteredVectorGrid3;
+using CubbyFlow::Vector3D;
+
+class GridBackwardEulerDiffusionSolver3 : public ::benchmark::Fixture
+{
+protected:
+    CubbyFlow::GridBackwardEulerDiffusionSolver3 solver;
+    CellCenteredVectorGrid3 source;
+    CellCenteredVectorGrid3 dest;
+    CellCenteredScalarGrid3 components[3];
+    CellCenteredScalarGrid3 componentsDest[3];
+
+    void SetUp(const ::benchmark::State& state)
+    {
+        const size_t n = static_cast<size_t>(state.range(0));
+        const double h = 1.0 / static_cast<double>(n);
+
+        source.Resize(n, n, n, h, h, h);
+        dest.Resize(n, n, n, h, h, h);
+        source.Fill([](const Vector3D& x)
+        {
+            return Vector3D(x.x * x.y, x.z, 1.0 - x.y);
+        });
+
+        for (size_t c = 0; c < 3; ++c)
+        {
+            components[c].Resize(n, n, n, h, h, h);
+            componentsDest[c].Resize(n, n, n, h, h, h);
+            components[c].Fill([&](const Vector3D& x)
+            {
+                return source.Sample(x)[c];
+            });
+        }
+    }
+};
+
+BENCHMARK_DEFINE_F(GridBackwardEulerDiffusionSolver3, SolveComponentsSeparately)(benchmark::State& state)
+{
+    while (state.KeepRunning())
+    {
+        for (size_t c = 0; c < 3; ++c)
+        {
+            solver.Solve(components[c], 0.01, 0.1, &componentsDest[c]);
+        }
+    }
+}
+
+BENCHMARK_REGISTER_F(GridBackwardEulerDiffusionSolver3, SolveComponentsSeparately)
+->Unit(benchmark::kMillisecond)
+->UseRealTime()
+->Arg(64);
+
+BENCHMARK_DEFINE_F(GridBackwardEulerDiffusionSolver3, SolveCollocated)(benchmark::State& state)
+{
+    while (state.KeepRunning())
+    {
+        solver.Solve(source, 0.01, 0.1, &dest);
+    }
+}
+
+BENCHMARK_REGISTER_F(GridBackwardEulerDiffusionSolver3, SolveCollocated)
+->Unit(benchmark::kMillisecond)
+->UseRealTime()
+->Arg(64);
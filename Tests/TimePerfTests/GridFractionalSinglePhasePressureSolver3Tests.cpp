@@ -4,6 +4,10 @@
 #include <Core/Field/ConstantVectorField3.h>
 #include <Core/Grid/CellCenteredScalarGrid3.h>
 #include <Core/Grid/FaceCenteredGrid3.h>
+#include <Core/Solver/FDM/FDMAMGPCGSolver3.h>
+#include <Core/Solver/FDM/FDMCGSolver3.h>
+#include <Core/Solver/FDM/FDMICCGSolver3.h>
+#include <Core/Solver/FDM/FDMMGPCGSolver3.h>
 #include <Core/Solver/Grid/GridFractionalSinglePhasePressureSolver3.h>
 #include <Core/Vector/Vector3.h>
 
@@ -12,6 +16,11 @@ using CubbyFlow::FaceCenteredGrid3;
 using CubbyFlow::CellCenteredScalarGrid3;
 using CubbyFlow::ConstantScalarField3;
 using CubbyFlow::ConstantVectorField3;
+using CubbyFlow::FDMAMGPCGSolver3;
+using CubbyFlow::FDMCGSolver3;
+using CubbyFlow::FDMICCGSolver3;
+using CubbyFlow::FDMLinearSystemSolver3Ptr;
+using CubbyFlow::FDMMGPCGSolver3;
 
 class GridFractionalSinglePhasePressureSolver3 : public ::benchmark::Fixture
 {
@@ -72,4 +81,181 @@ BENCHMARK_REGISTER_F(GridFractionalSinglePhasePressureSolver3, Solve)
 ->Args({ 128, 64, 0 })
 ->Args({ 128, 64, 1 })
 ->Args({ 128, 32, 0 })
-->Args({ 128, 32, 1 });
\ No newline at end of file
+->Args({ 128, 32, 1 });
+
+BENCHMARK_DEFINE_F(GridFractionalSinglePhasePressureSolver3, SolveICCG)(benchmark::State& state)
+{
+    auto iccg = std::make_shared<FDMICCGSolver3>(1000, 1e-6);
+    solver.SetLinearSystemSolver(iccg);
+
+    while (state.KeepRunning())
+    {
+        solver.Solve(vel, 1.0, &vel,
+            ConstantScalarField3(std::numeric_limits<double>::max()),
+            ConstantVectorField3({ 0, 0, 0 }),
+            fluidSDF, true);
+    }
+
+    state.counters["iterations"] = iccg->GetLastNumberOfIterations();
+}
+
+BENCHMARK_REGISTER_F(GridFractionalSinglePhasePressureSolver3, SolveICCG)
+->UseRealTime()
+->Args({ 64, 64 })
+->Args({ 64, 16 })
+->Args({ 128, 32 })
+->Args({ 128, 8 });
+
+BENCHMARK_DEFINE_F(GridFractionalSinglePhasePressureSolver3, SolveAMGPCG)(benchmark::State& state)
+{
+    auto amgpcg = std::make_shared<FDMAMGPCGSolver3>(1000, 1e-6);
+    solver.SetLinearSystemSolver(amgpcg);
+
+    while (state.KeepRunning())
+    {
+        solver.Solve(vel, 1.0, &vel,
+            ConstantScalarField3(std::numeric_limits<double>::max()),
+            ConstantVectorField3({ 0, 0, 0 }),
+            fluidSDF, true);
+    }
+
+    state.counters["iterations"] = amgpcg->GetLastNumberOfIterations();
+    state.counters["levels"] = static_cast<double>(amgpcg->GetLastNumberOfLevels());
+}
+
+BENCHMARK_REGISTER_F(GridFractionalSinglePhasePressureSolver3, SolveAMGPCG)
+->UseRealTime()
+->Args({ 64, 64 })
+->Args({ 64, 16 })
+->Args({ 128, 32 })
+->Args({ 128, 8 });
+
+// Runs a sequence of time-steps of a sloshing tank under gravity, so that the
+// pressure changes only a little between the solves. The second argument turns
+// the warm start on and off.
+static void SolveSloshingTank(
+    benchmark::State& state,
+    const FDMLinearSystemSolver3Ptr& linearSolver,
+    const std::function<unsigned int()>& lastNumberOfIterations,
+    bool compressed)
+{
+    const auto n = static_cast<size_t>(state.range(0));
+    const double dx = 1.0 / static_cast<double>(n);
+    const double dt = 1.0 / 60.0;
+    const size_t numberOfSteps = 10;
+
+    FaceCenteredGrid3 input(n, n, n, dx, dx, dx);
+    FaceCenteredGrid3 output(n, n, n, dx, dx, dx);
+    CellCenteredScalarGrid3 sdf(n, n, n, dx, dx, dx);
+
+    double totalIterations = 0.0;
+    double numberOfSolves = 0.0;
+
+    while (state.KeepRunning())
+    {
+        CubbyFlow::GridFractionalSinglePhasePressureSolver3 solver;
+        solver.SetLinearSystemSolver(linearSolver);
+        solver.SetUseWarmStart(state.range(1) == 1);
+
+        for (size_t step = 0; step < numberOfSteps; ++step)
+        {
+            const double tilt = 0.1 * std::sin(0.05 * static_cast<double>(step));
+            sdf.Fill([&](const Vector3D& x)
+            {
+                return x.y - 0.5 - tilt * (x.x - 0.5);
+            });
+
+            input.Fill([&](const Vector3D& x)
+            {
+                return Vector3D(tilt * x.x * (1.0 - x.x), -9.8 * dt, 0.0);
+            });
+            input.ForEachVIndex([&](size_t i, size_t j, size_t k)
+            {
+                if (j == 0 || j == n)
+                {
+                    input.GetV(i, j, k) = 0.0;
+                }
+            });
+
+            solver.Solve(input, dt, &output,
+                ConstantScalarField3(std::numeric_limits<double>::max()),
+                ConstantVectorField3({ 0, 0, 0 }),
+                sdf, compressed);
+
+            totalIterations += lastNumberOfIterations();
+            numberOfSolves += 1.0;
+        }
+    }
+
+    state.counters["iterations"] = totalIterations / numberOfSolves;
+}
+
+BENCHMARK_DEFINE_F(GridFractionalSinglePhasePressureSolver3, WarmStartCG)(benchmark::State& state)
+{
+    auto cg = std::make_shared<FDMCGSolver3>(1000, 1e-6);
+    SolveSloshingTank(state, cg, [&]() { return cg->GetLastNumberOfIterations(); }, true);
+}
+
+BENCHMARK_REGISTER_F(GridFractionalSinglePhasePressureSolver3, WarmStartCG)
+->Unit(benchmark::kMillisecond)
+->UseRealTime()
+->Args({ 32, 0 })
+->Args({ 32, 1 });
+
+BENCHMARK_DEFINE_F(GridFractionalSinglePhasePressureSolver3, WarmStartICCG)(benchmark::State& state)
+{
+    auto iccg = std::make_shared<FDMICCGSolver3>(1000, 1e-6);
+    SolveSloshingTank(state, iccg, [&]() { return iccg->GetLastNumberOfIterations(); }, true);
+}
+
+BENCHMARK_REGISTER_F(GridFractionalSinglePhasePressureSolver3, WarmStartICCG)
+->Unit(benchmark::kMillisecond)
+->UseRealTime()
+->Args({ 32, 0 })
+->Args({ 32, 1 });
+
+BENCHMARK_DEFINE_F(GridFractionalSinglePhasePressureSolver3, WarmStartMGPCG)(benchmark::State& state)
+{
+    auto mgpcg = std::make_shared<FDMMGPCGSolver3>(1000, 5, 5, 5, 20, 20, 1e-6);
+    SolveSloshingTank(state, mgpcg, [&]() { return mgpcg->GetLastNumberOfIterations(); }, false);
+}
+
+BENCHMARK_REGISTER_F(GridFractionalSinglePhasePressureSolver3, WarmStartMGPCG)
+->Unit(benchmark::kMillisecond)
+->UseRealTime()
+->Args({ 32, 0 })
+->Args({ 32, 1 });
+
+BENCHMARK_DEFINE_F(GridFractionalSinglePhasePressureSolver3, AssembleCompressed)(benchmark::State& state)
+{
+    // Without the linear system solver, Solve only builds the weights and the
+    // compressed system.
+    solver.SetLinearSystemSolver(nullptr);
+
+    // The surface alternates between two heights when the third argument is
+    // one, so a layer of cells enters and leaves the fluid at every step.
+    CellCenteredScalarGrid3 movedSDF(fluidSDF.Resolution(), fluidSDF.GridSpacing());
+    const double offset = (state.range(2) == 1) ? 0.5 : 0.0;
+    movedSDF.Fill([&](const Vector3D& x)
+    {
+        return fluidSDF.Sample(x) - offset;
+    });
+
+    size_t step = 0;
+    while (state.KeepRunning())
+    {
+        solver.Solve(vel, 1.0, &vel,
+            ConstantScalarField3(std::numeric_limits<double>::max()),
+            ConstantVectorField3({ 0, 0, 0 }),
+            (step % 2 == 0) ? fluidSDF : movedSDF, true);
+        ++step;
+    }
+}
+
+BENCHMARK_REGISTER_F(GridFractionalSinglePhasePressureSolver3, AssembleCompressed)
+->Unit(benchmark::kMillisecond)
+->UseRealTime()
+->Args({ 64, 32, 0 })
+->Args({ 64, 32, 1 })
+->Args({ 128, 64, 0 })
+->Args({ 128, 64, 1 });
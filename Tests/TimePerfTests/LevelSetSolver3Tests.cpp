@@ -0,0 +1,121 @@
+#include "benchmark/benchmark.h"
+
+#include <Core/Grid/CellCenteredScalarGrid3.h>
+#include <Core/Solver/LevelSet/FMMLevelSetSolver3.h>
+#include <Core/Solver/LevelSet/FSMLevelSetSolver3.h>
+
+#include <limits>
+
+using CubbyFlow::Vector3D;
+
+class LevelSetSolver3 : public ::benchmark::Fixture
+{
+protected:
+    CubbyFlow::CellCenteredScalarGrid3 sdf;
+    CubbyFlow::CellCenteredScalarGrid3 output;
+    double maxDistance = std::numeric_limits<double>::max();
+
+    void SetUp(const ::benchmark::State& state)
+    {
+        const size_t n = static_cast<size_t>(state.range(0));
+        const double h = 1.0 / static_cast<double>(n);
+
+        sdf.Resize(n, n, n, h, h, h);
+        output.Resize(n, n, n, h, h, h);
+
+        // Two overlapping spheres with a distorted (non-unit gradient) field
+        sdf.Fill([](const Vector3D& x)
+        {
+            const double phi1 = (x - Vector3D(0.35, 0.4, 0.5)).Length() - 0.2;
+            const double phi2 = (x - Vector3D(0.65, 0.55, 0.5)).Length() - 0.25;
+            return 3.0 * std::min(phi1, phi2);
+        });
+
+        // Zero means the whole grid, otherwise the band width in cells
+        maxDistance = (state.range(1) == 0)
+            ? std::numeric_limits<double>::max()
+            : static_cast<double>(state.range(1)) * h;
+    }
+};
+
+BENCHMARK_DEFINE_F(LevelSetSolver3, ReinitializeFMM)(benchmark::State& state)
+{
+    CubbyFlow::FMMLevelSetSolver3 solver;
+
+    while (state.KeepRunning())
+    {
+        solver.Reinitialize(sdf, maxDistance, &output);
+    }
+}
+
+BENCHMARK_REGISTER_F(LevelSetSolver3, ReinitializeFMM)
+->Unit(benchmark::kMillisecond)
+->UseRealTime()
+->Args({ 64, 0 })
+->Args({ 64, 5 })
+->Args({ 128, 0 })
+->Args({ 128, 5 });
+
+BENCHMARK_DEFINE_F(LevelSetSolver3, ReinitializeFSM)(benchmark::State& state)
+{
+    CubbyFlow::FSMLevelSetSolver3 solver;
+
+    while (state.KeepRunning())
+    {
+        solver.Reinitialize(sdf, maxDistance, &output);
+    }
+
+    state.counters["iterations"] = solver.GetLastNumberOfIterations();
+}
+
+BENCHMARK_REGISTER_F(LevelSetSolver3, ReinitializeFSM)
+->Unit(benchmark::kMillisecond)
+->UseRealTime()
+->Args({ 64, 0 })
+->Args({ 64, 5 })
+->Args({ 128, 0 })
+->Args({ 128, 5 });
+
+BENCHMARK_DEFINE_F(LevelSetSolver3, ExtrapolateFMM)(benchmark::State& state)
+{
+    CubbyFlow::FMMLevelSetSolver3 solver;
+    CubbyFlow::CellCenteredScalarGrid3 field(sdf.Resolution(), sdf.GridSpacing());
+    field.Fill([](const Vector3D& x)
+    {
+        return x.x + x.y * x.z;
+    });
+
+    while (state.KeepRunning())
+    {
+        solver.Extrapolate(field, sdf, maxDistance, &output);
+    }
+}
+
+BENCHMARK_REGISTER_F(LevelSetSolver3, ExtrapolateFMM)
+->Unit(benchmark::kMillisecond)
+->UseRealTime()
+->Args({ 64, 5 })
+->Args({ 128, 5 });
+
+BENCHMARK_DEFINE_F(LevelSetSolver3, ExtrapolateFSM)(benchmark::State& state)
+{
+    CubbyFlow::FSMLevelSetSolver3 solver;
+    CubbyFlow::CellCenteredScalarGrid3 field(sdf.Resolution(), sdf.GridSpacing());
+    field.Fill([](const Vector3D& x)
+    {
+        return x.x + x.y * x.z;
+    });
+
+    while (state.KeepRunning())
+    {
+        solver.Extrapolate(field, sdf, maxDistance, &output);
+    }
+
+    state.counters["iterations"] = solver.GetLastNumberOfIterations();
+}
+
+BENCHMARK_REGISTER_F(LevelSetSolver3, ExtrapolateFSM)
+->Unit(benchmark::kMillisecond)
+->UseRealTime()
+->Args({ 64, 5 })
+->Args({ 128, 5 });
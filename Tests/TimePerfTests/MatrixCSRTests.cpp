@@ -0,0 +1,234 @@
+#include "benchmark/benchmark.h"
+
+#include <Core/Matrix/MatrixCSR.h>
+#include <Core/Utils/Parallel.h>
+#include <Core/Vector/VectorN.h>
+
+#include <array>
+#include <random>
+
+using CubbyFlow::MatrixCSRD;
+using CubbyFlow::VectorND;
+
+namespace
+{
+    // 7-point Laplacian row of cell (i, j, k) on n^3 grid, diagonal first
+    size_t LaplacianRow(size_t n, size_t row, double* values, size_t* columns)
+    {
+        const size_t i = row % n;
+        const size_t j = (row / n) % n;
+        const size_t k = row / (n * n);
+
+        values[0] = 0.0;
+        columns[0] = row;
+        size_t count = 1;
+
+        auto add = [&](bool valid, size_t column)
+        {
+            if (valid)
+            {
+                values[0] += 1.0;
+                values[count] = -1.0;
+                columns[count] = column;
+                ++count;
+            }
+        };
+
+        add(i > 0, row - 1);
+        add(i + 1 < n, row + 1);
+        add(j > 0, row - n);
+        add(j + 1 < n, row + n);
+        add(k > 0, row - n * n);
+        add(k + 1 < n, row + n * n);
+
+        return count;
+    }
+}
+
+class MatrixCSR : public ::benchmark::Fixture
+{
+public:
+    MatrixCSRD mat;
+    VectorND x;
+    VectorND y;
+
+    void SetUp(const ::benchmark::State& state)
+    {
+        const auto n = static_cast<size_t>(state.range(0));
+        const size_t numRows = n * n * n;
+
+        if (state.range(1) == 0)
+        {
+            mat.Build(numRows, numRows,
+                [&](size_t row)
+            {
+                std::array<double, 7> values;
+                std::array<size_t, 7> columns;
+                return LaplacianRow(n, row, values.data(), columns.data());
+            },
+                [&](size_t row, MatrixCSRD::NonZeroIterator nonZeros, MatrixCSRD::IndexIterator columnIndices)
+            {
+                std::array<double, 7> values;
+                std::array<size_t, 7> columns;
+                const size_t count = LaplacianRow(n, row, values.data(), columns.data());
+                std::copy(values.begin(), values.begin() + count, nonZeros);
+                std::copy(columns.begin(), columns.begin() + count, columnIndices);
+            });
+        }
+        else
+        {
+            // Skewed matrix where the first rows are much longer than the
+            // rest, like the coarse levels of an algebraic multigrid
+            mat.Build(numRows, numRows,
+                [&](size_t row)
+            {
+                return (row < numRows / 64) ? 256 : size_t(2);
+            },
+                [&](size_t row, MatrixCSRD::NonZeroIterator nonZeros, MatrixCSRD::IndexIterator columnIndices)
+            {
+                const size_t count = (row < numRows / 64) ? 256 : 2;
+                const size_t stride = numRows / count;
+
+                for (size_t jj = 0; jj < count; ++jj)
+                {
+                    nonZeros[jj] = 1.0;
+                    columnIndices[jj] = (row + jj * stride) % numRows;
+                }
+            });
+        }
+
+        std::mt19937 rng;
+        std::uniform_real_distribution<> d(0.0, 1.0);
+
+        x.Resize(numRows);
+        y.Resize(numRows);
+        x.ForEachIndex([&](size_t i)
+        {
+            x[i] = d(rng);
+        });
+    }
+};
+
+BENCHMARK_DEFINE_F(MatrixCSR, BuildByAddRow)(benchmark::State& state)
+{
+    const auto n = static_cast<size_t>(state.range(0));
+    const size_t numRows = n * n * n;
+
+    while (state.KeepRunning())
+    {
+        MatrixCSRD m;
+
+        for (size_t row = 0; row < numRows; ++row)
+        {
+            std::array<double, 7> values;
+            std::array<size_t, 7> columns;
+            const size_t count = LaplacianRow(n, row, values.data(), columns.data());
+
+            m.AddRow({ values.begin(), values.begin() + count }, { columns.begin(), columns.begin() + count });
+        }
+
+        benchmark::DoNotOptimize(m.NumberOfNonZeros());
+    }
+}
+
+BENCHMARK_REGISTER_F(MatrixCSR, BuildByAddRow)
+->Unit(benchmark::kMillisecond)
+->UseRealTime()
+->Args({ 64, 0 })
+->Args({ 128, 0 });
+
+BENCHMARK_DEFINE_F(MatrixCSR, BuildInParallel)(benchmark::State& state)
+{
+    const auto n = static_cast<size_t>(state.range(0));
+    const size_t numRows = n * n * n;
+
+    while (state.KeepRunning())
+    {
+        MatrixCSRD m(numRows, numRows,
+            [&](size_t row)
+        {
+            std::array<double, 7> values;
+            std::array<size_t, 7> columns;
+            return LaplacianRow(n, row, values.data(), columns.data());
+        },
+            [&](size_t row, MatrixCSRD::NonZeroIterator nonZeros, MatrixCSRD::IndexIterator columnIndices)
+        {
+            std::array<double, 7> values;
+            std::array<size_t, 7> columns;
+            const size_t count = LaplacianRow(n, row, values.data(), columns.data());
+            std::copy(values.begin(), values.begin() + count, nonZeros);
+            std::copy(columns.begin(), columns.begin() + count, columnIndices);
+        });
+
+        benchmark::DoNotOptimize(m.NumberOfNonZeros());
+    }
+}
+
+BENCHMARK_REGISTER_F(MatrixCSR, BuildInParallel)
+->Unit(benchmark::kMillisecond)
+->UseRealTime()
+->Args({ 64, 0 })
+->Args({ 128, 0 });
+
+BENCHMARK_DEFINE_F(MatrixCSR, MulByRow)(benchmark::State& state)
+{
+    const auto rp = mat.RowPointersBegin();
+    const auto ci = mat.ColumnIndicesBegin();
+    const auto nnz = mat.NonZeroBegin();
+
+    while (state.KeepRunning())
+    {
+        x.ParallelForEachIndex([&](size_t i)
+        {
+            double sum = 0.0;
+
+            for (size_t jj = rp[i]; jj < rp[i + 1]; ++jj)
+            {
+                sum += nnz[jj] * x[ci[jj]];
+            }
+
+            y[i] = sum;
+        });
+    }
+}
+
+BENCHMARK_REGISTER_F(MatrixCSR, MulByRow)
+->Unit(benchmark::kMillisecond)
+->UseRealTime()
+->Args({ 64, 0 })
+->Args({ 128, 0 })
+->Args({ 64, 1 });
+
+BENCHMARK_DEFINE_F(MatrixCSR, MulByRowBlock)(benchmark::State& state)
+{
+    const size_t* rp = mat.RowPointersData();
+    const size_t* ci = mat.ColumnIndicesData();
+    const double* nnz = mat.NonZeroData();
+    const double* xp = x.data();
+    double* yp = y.data();
+
+    while (state.KeepRunning())
+    {
+        mat.ParallelForEachRowBlock([&](size_t rowBegin, size_t rowEnd)
+        {
+            for (size_t i = rowBegin; i < rowEnd; ++i)
+            {
+                double sum = 0.0;
+
+                for (size_t jj = rp[i]; jj < rp[i + 1]; ++jj)
+                {
+                    sum += nnz[jj] * xp[ci[jj]];
+                }
+
+                yp[i] = sum;
+            }
+        });
+    }
+}
+
+BENCHMARK_REGISTER_F(MatrixCSR, MulByRowBlock)
+->Unit(benchmark::kMillisecond)
+->UseRealTime()
+->Args({ 64, 0 })
+->Args({ 128, 0 })
+->Args({ 64, 1 });
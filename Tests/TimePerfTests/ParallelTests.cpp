@@ -1,8 +1,12 @@
 #include "benchmark/benchmark.h"
 
+#include <Core/Array/Array3.h>
 #include <Core/Utils/Constants.h>
 #include <Core/Utils/Parallel.h>
 
+#include <functional>
+#include <limits>
+#include <numeric>
 #include <random>
 
 class Parallel : public ::benchmark::Fixture
@@ -89,4 +93,268 @@ BENCHMARK_REGISTER_F(Parallel, ParallelRangeFor)
 ->Args({ 1 << 24, 1 })
 ->Args({ 1 << 24, 2 })
 ->Args({ 1 << 24, 4 })
-->Args({ 1 << 24, 8 });
\ No newline at end of file
+->Args({ 1 << 24, 8 });
+
+class ParallelSort : public ::benchmark::Fixture
+{
+public:
+    std::vector<size_t> keys, sortedKeys, indices;
+    size_t n = 0;
+    unsigned int numThreads = 1;
+
+    std::mt19937 rng{ 0 };
+
+    void SetUp(const ::benchmark::State& state)
+    {
+        n = static_cast<size_t>(state.range(0));
+        numThreads = static_cast<unsigned int>(state.range(1));
+
+        // Hash keys of a 64^3 grid
+        std::uniform_int_distribution<size_t> d(0, 64 * 64 * 64 - 1);
+
+        keys.resize(n);
+        for (size_t i = 0; i < n; ++i)
+        {
+            keys[i] = d(rng);
+        }
+
+        sortedKeys.resize(n);
+        indices.resize(n);
+    }
+};
+
+BENCHMARK_DEFINE_F(ParallelSort, MergeSort)(benchmark::State& state)
+{
+    const unsigned int oldNumThreads = CubbyFlow::GetMaxNumberOfThreads();
+    CubbyFlow::SetMaxNumberOfThreads(numThreads);
+
+    while (state.KeepRunning())
+    {
+        sortedKeys = keys;
+        CubbyFlow::ParallelSort(sortedKeys.begin(), sortedKeys.end(), std::less<size_t>());
+    }
+
+    CubbyFlow::SetMaxNumberOfThreads(oldNumThreads);
+}
+
+BENCHMARK_REGISTER_F(ParallelSort, MergeSort)
+->UseRealTime()
+->Args({ 1 << 20, 1 })
+->Args({ 1 << 20, 8 })
+->Args({ 1 << 23, 1 })
+->Args({ 1 << 23, 8 });
+
+BENCHMARK_DEFINE_F(ParallelSort, RadixSort)(benchmark::State& state)
+{
+    const unsigned int oldNumThreads = CubbyFlow::GetMaxNumberOfThreads();
+    CubbyFlow::SetMaxNumberOfThreads(numThreads);
+
+    while (state.KeepRunning())
+    {
+        sortedKeys = keys;
+        CubbyFlow::ParallelRadixSort(sortedKeys.begin(), sortedKeys.end());
+    }
+
+    CubbyFlow::SetMaxNumberOfThreads(oldNumThreads);
+}
+
+BENCHMARK_REGISTER_F(ParallelSort, RadixSort)
+->UseRealTime()
+->Args({ 1 << 20, 1 })
+->Args({ 1 << 20, 8 })
+->Args({ 1 << 23, 1 })
+->Args({ 1 << 23, 8 });
+
+BENCHMARK_DEFINE_F(ParallelSort, MergeSortIndices)(benchmark::State& state)
+{
+    const unsigned int oldNumThreads = CubbyFlow::GetMaxNumberOfThreads();
+    CubbyFlow::SetMaxNumberOfThreads(numThreads);
+
+    while (state.KeepRunning())
+    {
+        std::iota(indices.begin(), indices.end(), CubbyFlow::ZERO_SIZE);
+        CubbyFlow::ParallelSort(indices.begin(), indices.end(), [this](size_t a, size_t b)
+        {
+            return keys[a] < keys[b];
+        });
+    }
+
+    CubbyFlow::SetMaxNumberOfThreads(oldNumThreads);
+}
+
+BENCHMARK_REGISTER_F(ParallelSort, MergeSortIndices)
+->UseRealTime()
+->Args({ 1 << 20, 1 })
+->Args({ 1 << 20, 8 })
+->Args({ 1 << 23, 1 })
+->Args({ 1 << 23, 8 });
+
+BENCHMARK_DEFINE_F(ParallelSort, SortByKey)(benchmark::State& state)
+{
+    const unsigned int oldNumThreads = CubbyFlow::GetMaxNumberOfThreads();
+    CubbyFlow::SetMaxNumberOfThreads(numThreads);
+
+    while (state.KeepRunning())
+    {
+        sortedKeys = keys;
+        std::iota(indices.begin(), indices.end(), CubbyFlow::ZERO_SIZE);
+        CubbyFlow::ParallelSortByKey(sortedKeys.begin(), sortedKeys.end(), indices.begin());
+    }
+
+    CubbyFlow::SetMaxNumberOfThreads(oldNumThreads);
+}
+
+BENCHMARK_REGISTER_F(ParallelSort, SortByKey)
+->UseRealTime()
+->Args({ 1 << 20, 1 })
+->Args({ 1 << 20, 8 })
+->Args({ 1 << 23, 1 })
+->Args({ 1 << 23, 8 });
+
+BENCHMARK_DEFINE_F(Parallel, ParallelExclusiveScan)(benchmark::State& state)
+{
+    const unsigned int oldNumThreads = CubbyFlow::GetMaxNumberOfThreads();
+    CubbyFlow::SetMaxNumberOfThreads(numThreads);
+
+    while (state.KeepRunning())
+    {
+        CubbyFlow::ParallelExclusiveScan(a.begin(), a.end(), c.begin(), 0.0, std::plus<double>());
+    }
+
+    CubbyFlow::SetMaxNumberOfThreads(oldNumThreads);
+}
+
+BENCHMARK_REGISTER_F(Parallel, ParallelExclusiveScan)
+->UseRealTime()
+->Args({ 1 << 16, 1 })
+->Args({ 1 << 16, 8 })
+->Args({ 1 << 24, 1 })
+->Args({ 1 << 24, 8 });
+
+BENCHMARK_DEFINE_F(Parallel, ParallelCompact)(benchmark::State& state)
+{
+    const unsigned int oldNumThreads = CubbyFlow::GetMaxNumberOfThreads();
+    CubbyFlow::SetMaxNumberOfThreads(numThreads);
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        a[i] = d(rng);
+    }
+
+    while (state.KeepRunning())
+    {
+        CubbyFlow::ParallelCompact(a.begin(), a.end(), c.begin(), [](double x)
+        {
+            return x < 0.5;
+        });
+    }
+
+    CubbyFlow::SetMaxNumberOfThreads(oldNumThreads);
+}
+
+BENCHMARK_REGISTER_F(Parallel, ParallelCompact)
+->UseRealTime()
+->Args({ 1 << 16, 1 })
+->Args({ 1 << 16, 8 })
+->Args({ 1 << 24, 1 })
+->Args({ 1 << 24, 8 });
+
+
+class Parallel3D : public ::benchmark::Fixture
+{
+public:
+    CubbyFlow::Array3<double> x, y;
+    unsigned int numThreads = 1;
+
+    void SetUp(const ::benchmark::State& state)
+    {
+        x.Resize(
+            static_cast<size_t>(state.range(0)),
+            static_cast<size_t>(state.range(1)),
+            static_cast<size_t>(state.range(2)), 1.0);
+        y.Resize(x.size());
+        numThreads = static_cast<unsigned int>(state.range(3));
+    }
+
+    // 7-point Laplacian of x into y
+    void Laplacian()
+    {
+        const CubbyFlow::Size3 n = x.size();
+
+        CubbyFlow::ParallelFor(
+            CubbyFlow::ZERO_SIZE, n.x,
+            CubbyFlow::ZERO_SIZE, n.y,
+            CubbyFlow::ZERO_SIZE, n.z,
+            [&](size_t i, size_t j, size_t k)
+        {
+            const double center = x(i, j, k);
+            double sum = -6.0 * center;
+            sum += (i > 0) ? x(i - 1, j, k) : center;
+            sum += (i + 1 < n.x) ? x(i + 1, j, k) : center;
+            sum += (j > 0) ? x(i, j - 1, k) : center;
+            sum += (j + 1 < n.y) ? x(i, j + 1, k) : center;
+            sum += (k > 0) ? x(i, j, k - 1) : center;
+            sum += (k + 1 < n.z) ? x(i, j, k + 1) : center;
+            y(i, j, k) = sum;
+        });
+    }
+};
+
+BENCHMARK_DEFINE_F(Parallel3D, Tiles)(benchmark::State& state)
+{
+    const unsigned int oldNumThreads = CubbyFlow::GetMaxNumberOfThreads();
+    CubbyFlow::SetMaxNumberOfThreads(numThreads);
+
+    while (state.KeepRunning())
+    {
+        Laplacian();
+    }
+
+    CubbyFlow::SetMaxNumberOfThreads(oldNumThreads);
+}
+
+BENCHMARK_REGISTER_F(Parallel3D, Tiles)
+->UseRealTime()
+->Args({ 128, 128, 128, 1 })
+->Args({ 128, 128, 128, 8 })
+->Args({ 1024, 1024, 2, 1 })
+->Args({ 1024, 1024, 2, 8 })
+->Args({ 512, 512, 8, 1 })
+->Args({ 512, 512, 8, 8 })
+->Args({ 8, 512, 512, 1 })
+->Args({ 8, 512, 512, 8 })
+->Args({ 2048, 32, 32, 1 })
+->Args({ 2048, 32, 32, 8 });
+
+// One tile per Z slice, which is the schedule of the Z-only parallel loops
+BENCHMARK_DEFINE_F(Parallel3D, ZSlices)(benchmark::State& state)
+{
+    const unsigned int oldNumThreads = CubbyFlow::GetMaxNumberOfThreads();
+    CubbyFlow::SetMaxNumberOfThreads(numThreads);
+
+    size_t oldTileSizeX, oldTileSizeY, oldTileSizeZ;
+    CubbyFlow::GetParallelForTileSize(&oldTileSizeX, &oldTileSizeY, &oldTileSizeZ);
+    CubbyFlow::SetParallelForTileSize(
+        std::numeric_limits<size_t>::max(), std::numeric_limits<size_t>::max(), 1);
+
+    while (state.KeepRunning())
+    {
+        Laplacian();
+    }
+
+    CubbyFlow::SetParallelForTileSize(oldTileSizeX, oldTileSizeY, oldTileSizeZ);
+    CubbyFlow::SetMaxNumberOfThreads(oldNumThreads);
+}
+
+BENCHMARK_REGISTER_F(Parallel3D, ZSlices)
+->UseRealTime()
+->Args({ 128, 128, 128, 1 })
+->Args({ 128, 128, 128, 8 })
+->Args({ 1024, 1024, 2, 1 })
+->Args({ 1024, 1024, 2, 8 })
+->Args({ 512, 512, 8, 1 })
+->Args({ 512, 512, 8, 8 })
+->Args({ 8, 512, 512, 1 })
+->Args({ 8, 512, 512, 8 })
+->Args({ 2048, 32, 32, 1 })
+->Args({ 2048, 32, 32, 8 });
\ No newline at end of file
@@ -0,0 +1,118 @@
+#include "benchmark/benchmark.h"
+
+#include <Core/Emitter/VolumeGridEmitter3.h>
+#include <Core/Geometry/Box3.h>
+#include <Core/Solver/Grid/GridSmokeSolver3.h>
+#include <Core/Utils/Parallel.h>
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+using CubbyFlow::Box3;
+using CubbyFlow::Frame;
+using CubbyFlow::GridSmokeSolver3;
+using CubbyFlow::GridSmokeSolver3Ptr;
+using CubbyFlow::ParallelExecutor;
+using CubbyFlow::VolumeGridEmitter3;
+
+namespace
+{
+    const int NUMBER_OF_FRAMES = 10;
+
+    // Small version of the rising smoke scene of the manual tests
+    GridSmokeSolver3Ptr BuildRisingSmoke()
+    {
+        auto solver = GridSmokeSolver3::GetBuilder()
+            .WithResolution({ 20, 24, 10 })
+            .WithDomainSizeX(1.0)
+            .MakeShared();
+        solver->SetBuoyancyTemperatureFactor(2.0);
+
+        const auto box = Box3::GetBuilder()
+            .WithLowerCorner({ 0.45, 0.1, 0.2 })
+            .WithUpperCorner({ 0.55, 0.2, 0.3 })
+            .MakeShared();
+
+        const auto emitter = VolumeGridEmitter3::GetBuilder()
+            .WithSourceRegion(box)
+            .WithIsOneShot(false)
+            .MakeShared();
+        emitter->AddStepFunctionTarget(solver->GetSmokeDensity(), 0, 1);
+        emitter->AddStepFunctionTarget(solver->GetTemperature(), 0, 1);
+        solver->SetEmitter(emitter);
+
+        return solver;
+    }
+
+    void RunFrames(const GridSmokeSolver3Ptr& solver)
+    {
+        for (Frame frame(0, 1.0 / 60.0); frame.index < NUMBER_OF_FRAMES; ++frame)
+        {
+            solver->Update(frame);
+        }
+    }
+}
+
+// Runs the simulations one after another, each using all the threads
+static void PhysicsAnimationSequentialSims(benchmark::State& state)
+{
+    const int numberOfSims = static_cast<int>(state.range(0));
+    const unsigned int numThreads = static_cast<unsigned int>(state.range(1));
+
+    const unsigned int oldNumThreads = CubbyFlow::GetMaxNumberOfThreads();
+    CubbyFlow::SetMaxNumberOfThreads(numThreads);
+
+    while (state.KeepRunning())
+    {
+        for (int i = 0; i < numberOfSims; ++i)
+        {
+            RunFrames(BuildRisingSmoke());
+        }
+    }
+
+    CubbyFlow::SetMaxNumberOfThreads(oldNumThreads);
+    state.SetItemsProcessed(state.iterations() * numberOfSims * NUMBER_OF_FRAMES);
+}
+
+BENCHMARK(PhysicsAnimationSequentialSims)
+->Unit(benchmark::kMillisecond)
+->UseRealTime()
+->Args({ 8, 1 })
+->Args({ 8, 8 });
+
+// Runs the simulations concurrently, each with its own executor
+static void PhysicsAnimationConcurrentSims(benchmark::State& state)
+{
+    const int numberOfSims = static_cast<int>(state.range(0));
+    const unsigned int numThreadsPerSim = static_cast<unsigned int>(state.range(1));
+
+    while (state.KeepRunning())
+    {
+        std::vector<std::thread> sims;
+
+        for (int i = 0; i < numberOfSims; ++i)
+        {
+            sims.emplace_back([numThreadsPerSim]()
+            {
+                const auto solver = BuildRisingSmoke();
+                solver->SetExecutor(std::make_shared<ParallelExecutor>(numThreadsPerSim));
+
+                RunFrames(solver);
+            });
+        }
+
+        for (std::thread& sim : sims)
+        {
+            sim.join();
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * numberOfSims * NUMBER_OF_FRAMES);
+}
+
+BENCHMARK(PhysicsAnimationConcurrentSims)
+->Unit(benchmark::kMillisecond)
+->UseRealTime()
+->Args({ 8, 1 })
+->Args({ 8, 8 });
@@ -45,7 +45,8 @@ BENCHMARK_DEFINE_F(PointHashGridSearcher3, Build)(benchmark::State& state)
 BENCHMARK_REGISTER_F(PointHashGridSearcher3, Build)
 ->Arg(1 << 5)
 ->Arg(1 << 10)
-->Arg(1 << 20);
+->Arg(1 << 20)
+->Arg(1 << 23);
 
 BENCHMARK_DEFINE_F(PointHashGridSearcher3, ForEachNearbyPoints)(benchmark::State& state)
 {
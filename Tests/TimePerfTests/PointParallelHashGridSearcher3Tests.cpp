@@ -45,7 +45,8 @@ BENCHMARK_DEFINE_F(PointParallelHashGridSearcher3, Build)(benchmark::State& stat
 BENCHMARK_REGISTER_F(PointParallelHashGridSearcher3, Build)
 ->Arg(1 << 5)
 ->Arg(1 << 10)
-->Arg(1 << 20);
+->Arg(1 << 20)
+->Arg(1 << 23);
 
 BENCHMARK_DEFINE_F(PointParallelHashGridSearcher3, ForEachNearbyPoints)(benchmark::State& state)
 {
@@ -0,0 +1,125 @@
+#include "benchmark/benchmark.h"
+
+#include <Core/Math/Quaternion.h>
+#include <Core/Matrix/Matrix3x3.h>
+#include <Core/Transform/Transform3.h>
+#include <Core/Vector/Vector3.h>
+
+#include <random>
+#include <vector>
+
+using CubbyFlow::Matrix3x3D;
+using CubbyFlow::QuaternionD;
+using CubbyFlow::Transform3;
+using CubbyFlow::Vector3D;
+
+class SIMD : public ::benchmark::Fixture
+{
+public:
+    std::vector<Vector3D> a;
+    std::vector<Vector3D> b;
+    std::vector<Matrix3x3D> m;
+    std::vector<QuaternionD> q;
+
+    void SetUp(const ::benchmark::State& state)
+    {
+        const auto n = static_cast<size_t>(state.range(0));
+
+        std::mt19937 rng(0);
+        std::uniform_real_distribution<> d(-1.0, 1.0);
+
+        a.resize(n);
+        b.resize(n);
+        m.resize(n);
+        q.resize(n);
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            a[i] = Vector3D(d(rng), d(rng), d(rng));
+            b[i] = Vector3D(d(rng), d(rng), d(rng));
+            m[i] = Matrix3x3D(d(rng), d(rng), d(rng), d(rng), d(rng), d(rng), d(rng), d(rng), d(rng));
+            q[i] = QuaternionD(d(rng), d(rng), d(rng), d(rng)).Normalized();
+        }
+    }
+};
+
+BENCHMARK_DEFINE_F(SIMD, Dot)(benchmark::State& state)
+{
+    while (state.KeepRunning())
+    {
+        double sum = 0.0;
+
+        for (size_t i = 0; i < a.size(); ++i)
+        {
+            sum += a[i].Dot(b[i]);
+        }
+
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+BENCHMARK_REGISTER_F(SIMD, Dot)->Arg(1 << 16);
+
+BENCHMARK_DEFINE_F(SIMD, MatVec)(benchmark::State& state)
+{
+    while (state.KeepRunning())
+    {
+        for (size_t i = 0; i < a.size(); ++i)
+        {
+            b[i] = m[i] * a[i];
+        }
+
+        benchmark::ClobberMemory();
+    }
+}
+
+BENCHMARK_REGISTER_F(SIMD, MatVec)->Arg(1 << 16);
+
+BENCHMARK_DEFINE_F(SIMD, MatMat)(benchmark::State& state)
+{
+    std::vector<Matrix3x3D> products(m.size());
+
+    while (state.KeepRunning())
+    {
+        for (size_t i = 0; i + 1 < m.size(); ++i)
+        {
+            products[i] = m[i] * m[i + 1];
+        }
+
+        benchmark::ClobberMemory();
+    }
+}
+
+BENCHMARK_REGISTER_F(SIMD, MatMat)->Arg(1 << 16);
+
+BENCHMARK_DEFINE_F(SIMD, QuaternionRotate)(benchmark::State& state)
+{
+    while (state.KeepRunning())
+    {
+        for (size_t i = 0; i < a.size(); ++i)
+        {
+            b[i] = q[i] * a[i];
+        }
+
+        benchmark::ClobberMemory();
+    }
+}
+
+BENCHMARK_REGISTER_F(SIMD, QuaternionRotate)->Arg(1 << 16);
+
+BENCHMARK_DEFINE_F(SIMD, TransformToWorld)(benchmark::State& state)
+{
+    const Transform3 transform(Vector3D(1.0, 2.0, 3.0), q[0]);
+
+    while (state.KeepRunning())
+    {
+        for (size_t i = 0; i < a.size(); ++i)
+        {
+            b[i] = transform.ToWorld(transform.ToLocal(a[i]));
+        }
+
+        benchmark::ClobberMemory();
+    }
+}
+
+BENCHMARK_REGISTER_F(SIMD, TransformToWorld)->Arg(1 << 16);
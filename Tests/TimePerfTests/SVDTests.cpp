@@ -0,0 +1,68 @@
+#include "benchmark/benchmark.h"
+
+#include <Core/Math/SVD.h>
+
+#include <random>
+#include <vector>
+
+using CubbyFlow::Matrix3x3D;
+using CubbyFlow::Vector3D;
+
+class SVD : public ::benchmark::Fixture
+{
+public:
+    std::vector<Matrix3x3D> covariances;
+
+    void SetUp(const ::benchmark::State& state)
+    {
+        const auto n = static_cast<size_t>(state.range(0));
+
+        std::mt19937 rng(0);
+        std::uniform_real_distribution<> d(-1.0, 1.0);
+
+        // Symmetric positive semi-definite matrices like the covariance
+        // matrices of the anisotropic kernels
+        covariances.resize(n);
+        for (auto& cov : covariances)
+        {
+            const Matrix3x3D b(d(rng), d(rng), d(rng), d(rng), d(rng), d(rng), d(rng), d(rng), d(rng));
+            cov = b * b.Transposed();
+        }
+    }
+};
+
+BENCHMARK_DEFINE_F(SVD, Generic)(benchmark::State& state)
+{
+    while (state.KeepRunning())
+    {
+        for (const auto& cov : covariances)
+        {
+            Matrix3x3D u, v;
+            Vector3D w;
+            CubbyFlow::SVD(cov, u, w, v);
+
+            benchmark::DoNotOptimize(w);
+            benchmark::DoNotOptimize(v);
+        }
+    }
+}
+
+BENCHMARK_REGISTER_F(SVD, Generic)->Unit(benchmark::kMillisecond)->Arg(1 << 16);
+
+BENCHMARK_DEFINE_F(SVD, SymmetricEigenDecomposition)(benchmark::State& state)
+{
+    while (state.KeepRunning())
+    {
+        for (const auto& cov : covariances)
+        {
+            Matrix3x3D v;
+            Vector3D d;
+            CubbyFlow::SymmetricEigenDecomposition(cov, d, v);
+
+            benchmark::DoNotOptimize(d);
+            benchmark::DoNotOptimize(v);
+        }
+    }
+}
+
+BENCHMARK_REGISTER_F(SVD, SymmetricEigenDecomposition)->Unit(benchmark::kMillisecond)->Arg(1 << 16);
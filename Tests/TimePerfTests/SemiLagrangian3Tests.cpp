@@ -0,0 +1,73 @@
+#include "benchmark/benchmark.h"
+
+#include <Core/Grid/CellCenteredScalarGrid3.h>
+#include <Core/Grid/FaceCenteredGrid3.h>
+#include <Core/SemiLagrangian/CubicSemiLagrangian3.h>
+
+using CubbyFlow::CellCenteredScalarGrid3;
+using CubbyFlow::ScalarGrid3;
+using CubbyFlow::Vector3D;
+
+class SemiLagrangian3 : public ::benchmark::Fixture
+{
+protected:
+    CubbyFlow::CubicSemiLagrangian3 solver;
+    CubbyFlow::FaceCenteredGrid3 flow;
+
+    // Smoke density and temperature like fields of the same layout
+    CellCenteredScalarGrid3 density;
+    CellCenteredScalarGrid3 temperature;
+    CellCenteredScalarGrid3 density1;
+    CellCenteredScalarGrid3 temperature1;
+
+    void SetUp(const ::benchmark::State& state)
+    {
+        const size_t n = static_cast<size_t>(state.range(0));
+        const double h = 1.0 / static_cast<double>(n);
+
+        for (auto grid : { &density, &temperature, &density1, &temperature1 })
+        {
+            grid->Resize(n, n, n, h, h, h);
+        }
+
+        flow.Resize(n, n, n, h, h, h);
+        flow.Fill([](const Vector3D& x)
+        {
+            return Vector3D(0.5 - x.y, x.x - 0.5, 0.25);
+        });
+
+        density.Fill([](const Vector3D& x) { return x.x * x.y; });
+        temperature.Fill([](const Vector3D& x) { return x.z; });
+    }
+};
+
+BENCHMARK_DEFINE_F(SemiLagrangian3, AdvectSeparately)(benchmark::State& state)
+{
+    while (state.KeepRunning())
+    {
+        solver.Advect(density, flow, 0.01, &density1);
+        solver.Advect(temperature, flow, 0.01, &temperature1);
+    }
+}
+
+BENCHMARK_REGISTER_F(SemiLagrangian3, AdvectSeparately)
+->Unit(benchmark::kMillisecond)
+->UseRealTime()
+->Arg(64);
+
+BENCHMARK_DEFINE_F(SemiLagrangian3, AdvectTogether)(benchmark::State& state)
+{
+    while (state.KeepRunning())
+    {
+        solver.Advect(
+            std::vector<const ScalarGrid3*>{ &density, &temperature },
+            flow,
+            0.01,
+            std::vector<ScalarGrid3*>{ &density1, &temperature1 });
+    }
+}
+
+BENCHMARK_REGISTER_F(SemiLagrangian3, AdvectTogether)
+->Unit(benchmark::kMillisecond)
+->UseRealTime()
+->Arg(64);
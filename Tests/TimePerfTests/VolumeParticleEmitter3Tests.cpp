@@ -4,7 +4,9 @@
 #include <Core/Emitter/VolumeParticleEmitter3.h>
 #include <Core/Geometry/Box3.h>
 #include <Core/Particle/ParticleSystemData3.h>
+#include <Core/Geometry/Sphere3.h>
 #include <Core/Surface/ImplicitSurfaceSet3.h>
+#include <Core/Surface/SurfaceToImplicit3.h>
 
 #include <memory>
 
@@ -12,6 +14,9 @@ using CubbyFlow::Box3;
 using CubbyFlow::BoundingBox3D;
 using CubbyFlow::ImplicitSurfaceSet3;
 using CubbyFlow::ParticleSystemData3;
+using CubbyFlow::Sphere3;
+using CubbyFlow::SurfaceToImplicit3;
+using CubbyFlow::Vector3D;
 
 class VolumeParticleEmitter3 : public ::benchmark::Fixture
 {
@@ -61,4 +66,51 @@ BENCHMARK_DEFINE_F(VolumeParticleEmitter3, Update)(benchmark::State& state)
 	}
 }
 
-BENCHMARK_REGISTER_F(VolumeParticleEmitter3, Update);
\ No newline at end of file
+BENCHMARK_REGISTER_F(VolumeParticleEmitter3, Update);
+
+class VolumeParticleEmitter3Continuous : public ::benchmark::Fixture
+{
+protected:
+	CubbyFlow::VolumeParticleEmitter3Ptr emitter;
+	CubbyFlow::ParticleSystemData3Ptr particles;
+
+	void SetUp(const ::benchmark::State& state)
+	{
+		const auto numberOfParticles = static_cast<size_t>(state.range(0));
+
+		// Large pool of particles which are mostly away from the emitter
+		particles = std::make_shared<ParticleSystemData3>();
+		CubbyFlow::Array1<Vector3D> positions(numberOfParticles);
+		for (size_t i = 0; i < numberOfParticles; ++i)
+		{
+			positions[i] = Vector3D(
+				static_cast<double>(i % 100) * 0.05,
+				static_cast<double>((i / 100) % 100) * 0.05,
+				static_cast<double>(i / 10000) * 0.05);
+		}
+		particles->AddParticles(positions);
+
+		auto sphere = std::make_shared<SurfaceToImplicit3>(
+			std::make_shared<Sphere3>(Vector3D(2.5, 5.5, 2.5), 0.1));
+
+		emitter = CubbyFlow::VolumeParticleEmitter3::Builder()
+			.WithImplicitSurface(sphere)
+			.WithSpacing(0.05)
+			.WithIsOneShot(false)
+			.WithAllowOverlapping(false)
+			.MakeShared();
+		emitter->SetTarget(particles);
+	}
+};
+
+BENCHMARK_DEFINE_F(VolumeParticleEmitter3Continuous, Update)(benchmark::State& state)
+{
+	while (state.KeepRunning())
+	{
+		emitter->Update(0.0, 0.01);
+	}
+}
+
+BENCHMARK_REGISTER_F(VolumeParticleEmitter3Continuous, Update)
+->Arg(1 << 16)
+->Arg(1 << 20);
@@ -174,6 +174,49 @@ TEST(LinearArraySampler2, Sample)
 	}
 }
 
+TEST(LinearArraySampler2, GetCoordinatesWeightsAndGradientWeights)
+{
+	Array2<double> grid(
+	{
+		{ 1.0, 2.0, 3.0, 4.0 },
+		{ 2.0, 5.0, 4.0, 5.0 },
+		{ 3.0, 4.0, 1.0, 6.0 },
+		{ 4.0, 5.0, 6.0, 7.0 },
+		{ 5.0, 6.0, 7.0, 8.0 }
+	});
+	Vector2D gridSpacing(0.5, 0.25), gridOrigin(-1.0, -0.5);
+	LinearArraySampler2<double, double> sampler(
+		grid.ConstAccessor(), gridSpacing, gridOrigin);
+
+	const std::vector<Vector2D> points =
+	{
+		Vector2D(0.1, 0.2), Vector2D(-0.7, 0.05), Vector2D(0.3, 0.45), Vector2D(5.0, -3.0)
+	};
+
+	for (const Vector2D& pt : points)
+	{
+		std::array<Point2UI, 4> indices;
+		std::array<double, 4> weights;
+		std::array<Vector2D, 4> gradWeights;
+		sampler.GetCoordinatesWeightsAndGradientWeights(pt, &indices, &weights, &gradWeights);
+
+		std::array<Point2UI, 4> gradIndices;
+		std::array<Vector2D, 4> expectedGradWeights;
+		sampler.GetCoordinatesAndGradientWeights(pt, &gradIndices, &expectedGradWeights);
+
+		double value = 0.0;
+		for (int j = 0; j < 4; ++j)
+		{
+			value += weights[j] * grid(indices[j]);
+			EXPECT_EQ(gradIndices[j], indices[j]);
+			EXPECT_NEAR(expectedGradWeights[j].x, gradWeights[j].x, 1e-9);
+			EXPECT_NEAR(expectedGradWeights[j].y, gradWeights[j].y, 1e-9);
+		}
+
+		EXPECT_NEAR(sampler(pt), value, 1e-9);
+	}
+}
+
 TEST(CubicArraySampler2, Sample)
 {
 	Array2<double> grid(
@@ -214,4 +257,53 @@ TEST(CubicArraySampler3, Sample)
 	double s0 = sampler(Vector3D(1.5, 1.8, 1.2));
 	EXPECT_LT(3.0, s0);
 	EXPECT_GT(6.0, s0);
-}
\ No newline at end of file
+}
+
+TEST(LinearArraySampler3, GetCoordinatesWeightsAndGradientWeights)
+{
+	Array3<double> grid(4, 5, 3);
+	for (size_t k = 0; k < 3; ++k)
+	{
+		for (size_t j = 0; j < 5; ++j)
+		{
+			for (size_t i = 0; i < 4; ++i)
+			{
+				grid(i, j, k) = static_cast<double>(i * i + 2 * j + k * j);
+			}
+		}
+	}
+
+	Vector3D gridSpacing(0.5, 0.25, 1.0), gridOrigin(-1.0, -0.5, 0.5);
+	LinearArraySampler3<double, double> sampler(
+		grid.ConstAccessor(), gridSpacing, gridOrigin);
+
+	const std::vector<Vector3D> points =
+	{
+		Vector3D(0.1, 0.2, 1.3), Vector3D(-0.7, 0.05, 2.1),
+		Vector3D(0.3, 0.45, 0.9), Vector3D(5.0, -3.0, 7.0)
+	};
+
+	for (const Vector3D& pt : points)
+	{
+		std::array<Point3UI, 8> indices;
+		std::array<double, 8> weights;
+		std::array<Vector3D, 8> gradWeights;
+		sampler.GetCoordinatesWeightsAndGradientWeights(pt, &indices, &weights, &gradWeights);
+
+		std::array<Point3UI, 8> gradIndices;
+		std::array<Vector3D, 8> expectedGradWeights;
+		sampler.GetCoordinatesAndGradientWeights(pt, &gradIndices, &expectedGradWeights);
+
+		double value = 0.0;
+		for (int j = 0; j < 8; ++j)
+		{
+			value += weights[j] * grid(indices[j]);
+			EXPECT_EQ(gradIndices[j], indices[j]);
+			EXPECT_NEAR(expectedGradWeights[j].x, gradWeights[j].x, 1e-9);
+			EXPECT_NEAR(expectedGradWeights[j].y, gradWeights[j].y, 1e-9);
+			EXPECT_NEAR(expectedGradWeights[j].z, gradWeights[j].z, 1e-9);
+		}
+
+		EXPECT_NEAR(sampler(pt), value, 1e-9);
+	}
+}
@@ -46,6 +46,38 @@ TEST(ArrayUtils, CopyRange1)
 	}
 }
 
+TEST(ArrayUtils, Compact1)
+{
+	const size_t n = 10000;
+	Array1<char> shouldRemove(n);
+	Array1<size_t> data(n);
+
+	for (size_t i = 0; i < n; ++i)
+	{
+		shouldRemove[i] = (i % 3 == 0) ? 1 : 0;
+		data[i] = i;
+	}
+
+	Array1<size_t> newIndices;
+	const size_t numberOfKept = ComputeCompactionIndices1(shouldRemove, n, &newIndices);
+	EXPECT_EQ(n - (n + 2) / 3, numberOfKept);
+
+	Compact1(shouldRemove, newIndices, numberOfKept, &data);
+	ASSERT_EQ(numberOfKept, data.size());
+
+	size_t expected = 0;
+	for (size_t i = 0; i < numberOfKept; ++i)
+	{
+		++expected;
+		if (expected % 3 == 0)
+		{
+			++expected;
+		}
+
+		EXPECT_EQ(expected, data[i]);
+	}
+}
+
 TEST(ArrayUtils, CopyRange2)
 {
 	Array2<double> array0({ { 1.0, 2.0 }, { 3.0, 4.0 }, { 5.0, 6.0 } });
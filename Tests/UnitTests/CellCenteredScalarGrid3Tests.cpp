@@ -287,6 +287,26 @@ TEST(CellCenteredScalarGrid3, Fill)
 	}
 }
 
+TEST(CellCenteredScalarGrid3, BatchSample)
+{
+	CellCenteredScalarGrid3 grid(5, 4, 6, 1.0, 2.0, 0.5, 1.0, -1.0, 0.0, 0.0);
+	grid.Fill([](const Vector3D& x) { return x.x * x.y - x.z; });
+
+	Array1<Vector3D> points;
+	for (int i = 0; i < 100; ++i)
+	{
+		points.Append(Vector3D(0.07 * i, 0.11 * i - 1.5, 3.0 - 0.05 * i));
+	}
+
+	Array1<double> results(points.size());
+	grid.BatchSample(points.ConstAccessor(), results.Accessor());
+
+	for (size_t i = 0; i < points.size(); ++i)
+	{
+		EXPECT_DOUBLE_EQ(grid.Sample(points[i]), results[i]);
+	}
+}
+
 TEST(CellCenteredScalarGrid3, GradientAtDataPoint)
 {
 	CellCenteredScalarGrid3 grid(5, 8, 6, 2.0, 3.0, 1.5);
@@ -331,6 +331,29 @@ TEST(CellCenteredVectorGrid3, Fill)
 	}
 }
 
+TEST(CellCenteredVectorGrid3, BatchSample)
+{
+	CellCenteredVectorGrid3 grid(5, 4, 6, 1.0, 2.0, 0.5, 1.0, -1.0, 0.0);
+	grid.Fill([](const Vector3D& x) { return Vector3D(x.y, x.x * x.z, -x.z); });
+
+	Array1<Vector3D> points;
+	for (int i = 0; i < 100; ++i)
+	{
+		points.Append(Vector3D(0.07 * i, 0.11 * i - 1.5, 3.0 - 0.05 * i));
+	}
+
+	Array1<Vector3D> results(points.size());
+	grid.BatchSample(points.ConstAccessor(), results.Accessor());
+
+	for (size_t i = 0; i < points.size(); ++i)
+	{
+		Vector3D expected = grid.Sample(points[i]);
+		EXPECT_DOUBLE_EQ(expected.x, results[i].x);
+		EXPECT_DOUBLE_EQ(expected.y, results[i].y);
+		EXPECT_DOUBLE_EQ(expected.z, results[i].z);
+	}
+}
+
 TEST(CellCenteredVectorGrid3, DivergenceAtDataPoint)
 {
 	CellCenteredVectorGrid3 grid(5, 8, 6);
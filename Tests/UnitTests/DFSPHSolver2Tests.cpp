@@ -0,0 +1,82 @@
+#include "pch.h"
+
+#include <Core/Collider/RigidBodyCollider2.h>
+#include <Core/Emitter/VolumeParticleEmitter2.h>
+#include <Core/Geometry/Box2.h>
+#include <Core/Solver/Particle/DFSPH/DFSPHSolver2.h>
+
+using namespace CubbyFlow;
+
+TEST(DFSPHSolver2, UpdateEmpty)
+{
+	// Empty solver test
+	DFSPHSolver2 solver;
+	Frame frame(0, 0.01);
+	solver.Update(frame++);
+	solver.Update(frame);
+}
+
+TEST(DFSPHSolver2, Parameters)
+{
+	DFSPHSolver2 solver;
+
+	solver.SetMaxDensityErrorRatio(5.0);
+	EXPECT_DOUBLE_EQ(5.0, solver.GetMaxDensityErrorRatio());
+
+	solver.SetMaxDensityErrorRatio(-1.0);
+	EXPECT_DOUBLE_EQ(0.0, solver.GetMaxDensityErrorRatio());
+
+	solver.SetMaxDivergenceErrorRatio(5.0);
+	EXPECT_DOUBLE_EQ(5.0, solver.GetMaxDivergenceErrorRatio());
+
+	solver.SetMaxDivergenceErrorRatio(-1.0);
+	EXPECT_DOUBLE_EQ(0.0, solver.GetMaxDivergenceErrorRatio());
+
+	solver.SetMaxNumberOfIterations(10);
+	EXPECT_DOUBLE_EQ(10, solver.GetMaxNumberOfIterations());
+}
+
+TEST(DFSPHSolver2, RestingBlock)
+{
+	DFSPHSolver2 solver;
+
+	SPHSystemData2Ptr particles = solver.GetSPHSystemData();
+	particles->SetTargetSpacing(0.05);
+	const double targetSpacing = particles->GetTargetSpacing();
+
+	const BoundingBox2D domain(Vector2D(), Vector2D(1, 1));
+	BoundingBox2D sourceBound(Vector2D(), Vector2D(1, 0.5));
+	sourceBound.Expand(-0.5 * targetSpacing);
+
+	const auto emitter = VolumeParticleEmitter2::GetBuilder()
+		.WithSurface(std::make_shared<Box2>(domain))
+		.WithMaxRegion(sourceBound)
+		.WithSpacing(targetSpacing)
+		.MakeShared();
+	emitter->SetJitter(0.0);
+	solver.SetEmitter(emitter);
+
+	Box2Ptr box = std::make_shared<Box2>(domain);
+	box->isNormalFlipped = true;
+	solver.SetCollider(std::make_shared<RigidBodyCollider2>(box));
+
+	for (Frame frame(0, 1.0 / 60.0); frame.index < 20; ++frame)
+	{
+		solver.Update(frame);
+	}
+
+	// The block should neither be compressed by gravity nor blow up
+	const auto x = particles->GetPositions();
+	const auto d = particles->GetDensities();
+	double maxDensity = 0.0;
+	double maxHeight = 0.0;
+
+	for (size_t i = 0; i < particles->GetNumberOfParticles(); ++i)
+	{
+		maxDensity = std::max(maxDensity, d[i]);
+		maxHeight = std::max(maxHeight, x[i].y);
+	}
+
+	EXPECT_LT(maxDensity / particles->GetTargetDensity(), 1.2);
+	EXPECT_LT(maxHeight, 0.6);
+}
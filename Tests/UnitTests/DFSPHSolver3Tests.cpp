@@ -0,0 +1,81 @@
+#include "pch.h"
+
+#include <Core/Collider/RigidBodyCollider3.h>
+#include <Core/Emitter/VolumeParticleEmitter3.h>
+#include <Core/Geometry/Box3.h>
+#include <Core/Solver/Particle/DFSPH/DFSPHSolver3.h>
+
+using namespace CubbyFlow;
+
+TEST(DFSPHSolver3, UpdateEmpty)
+{
+	// Empty solver test
+	DFSPHSolver3 solver;
+	Frame frame(0, 0.01);
+	solver.Update(frame++);
+	solver.Update(frame);
+}
+
+TEST(DFSPHSolver3, Parameters)
+{
+	DFSPHSolver3 solver;
+
+	solver.SetMaxDensityErrorRatio(5.0);
+	EXPECT_DOUBLE_EQ(5.0, solver.GetMaxDensityErrorRatio());
+
+	solver.SetMaxDensityErrorRatio(-1.0);
+	EXPECT_DOUBLE_EQ(0.0, solver.GetMaxDensityErrorRatio());
+
+	solver.SetMaxDivergenceErrorRatio(5.0);
+	EXPECT_DOUBLE_EQ(5.0, solver.GetMaxDivergenceErrorRatio());
+
+	solver.SetMaxDivergenceErrorRatio(-1.0);
+	EXPECT_DOUBLE_EQ(0.0, solver.GetMaxDivergenceErrorRatio());
+
+	solver.SetMaxNumberOfIterations(10);
+	EXPECT_DOUBLE_EQ(10, solver.GetMaxNumberOfIterations());
+}
+
+TEST(DFSPHSolver3, RestingBlock)
+{
+	DFSPHSolver3 solver;
+
+	SPHSystemData3Ptr particles = solver.GetSPHSystemData();
+	const double targetSpacing = particles->GetTargetSpacing();
+
+	const BoundingBox3D domain(Vector3D(), Vector3D(1, 1, 1));
+	BoundingBox3D sourceBound(Vector3D(), Vector3D(1, 0.5, 1));
+	sourceBound.Expand(-0.5 * targetSpacing);
+
+	const auto emitter = VolumeParticleEmitter3::GetBuilder()
+		.WithSurface(std::make_shared<Box3>(domain))
+		.WithMaxRegion(sourceBound)
+		.WithSpacing(targetSpacing)
+		.MakeShared();
+	emitter->SetJitter(0.0);
+	solver.SetEmitter(emitter);
+
+	Box3Ptr box = std::make_shared<Box3>(domain);
+	box->isNormalFlipped = true;
+	solver.SetCollider(std::make_shared<RigidBodyCollider3>(box));
+
+	for (Frame frame(0, 1.0 / 60.0); frame.index < 30; ++frame)
+	{
+		solver.Update(frame);
+	}
+
+	// The block should neither be compressed by gravity nor blow up
+	const auto x = particles->GetPositions();
+	const auto d = particles->GetDensities();
+	double maxDensity = 0.0;
+	double maxHeight = 0.0;
+
+	for (size_t i = 0; i < particles->GetNumberOfParticles(); ++i)
+	{
+		maxDensity = std::max(maxDensity, d[i]);
+		maxHeight = std::max(maxHeight, x[i].y);
+	}
+
+	EXPECT_LT(maxDensity / particles->GetTargetDensity(), 1.2);
+	EXPECT_LT(maxHeight, 0.6);
+}
@@ -0,0 +1,51 @@
+#include "pch.h"
+
+#include <FDMLinearSystemSolverTestHelper3.h>
+
+#include <Core/Solver/FDM/FDMAMGPCGSolver3.h>
+#include <Core/Solver/FDM/FDMICCGSolver3.h>
+
+using namespace CubbyFlow;
+
+TEST(FDMAMGPCGSolver3, SolveLowRes)
+{
+    FDMLinearSystem3 system;
+    FDMLinearSystemSolverTestHelper3::BuildTestLinearSystem(&system, { 3, 3, 3 });
+
+    FDMAMGPCGSolver3 solver(100, 1e-9);
+    solver.Solve(&system);
+
+    EXPECT_GT(solver.GetTolerance(), solver.GetLastResidual());
+}
+
+TEST(FDMAMGPCGSolver3, Solve)
+{
+    FDMLinearSystem3 system;
+    FDMLinearSystemSolverTestHelper3::BuildTestLinearSystem(&system, { 32, 32, 32 });
+
+    FDMAMGPCGSolver3 solver(100, 1e-4);
+
+    EXPECT_TRUE(solver.Solve(&system));
+    EXPECT_LT(1u, solver.GetLastNumberOfLevels());
+}
+
+TEST(FDMAMGPCGSolver3, SolveCompressed)
+{
+    FDMCompressedLinearSystem3 system;
+    FDMLinearSystemSolverTestHelper3::BuildTestCompressedLinearSystem(&system, { 32, 32, 32 });
+    FDMCompressedLinearSystem3 iccgSystem = system;
+
+    FDMAMGPCGSolver3 solver(100, 1e-6);
+    EXPECT_TRUE(solver.SolveCompressed(&system));
+    EXPECT_LT(1u, solver.GetLastNumberOfLevels());
+
+    FDMICCGSolver3 iccgSolver(100, 1e-6);
+    iccgSolver.SolveCompressed(&iccgSystem);
+
+    // The multigrid preconditioner should need fewer iterations than ICCG
+    EXPECT_LT(solver.GetLastNumberOfIterations(), iccgSolver.GetLastNumberOfIterations());
+
+    auto residual = system.x;
+    FDMCompressedBLAS3::Residual(system.A, system.x, system.b, &residual);
+    EXPECT_GT(1e-4, FDMCompressedBLAS3::L2Norm(residual));
+}
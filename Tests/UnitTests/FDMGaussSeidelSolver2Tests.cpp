@@ -104,4 +104,24 @@ TEST(FDMGaussSeidelSolver2, SolveCompressed)
     double norm1 = FDMCompressedBLAS2::L2Norm(buffer);
 
     EXPECT_LT(norm1, norm0);
-}
\ No newline at end of file
+}
+
+TEST(FDMGaussSeidelSolver2, SolveCompressedRedBlack)
+{
+    FDMLinearSystem2 system;
+    FDMLinearSystemSolverTestHelper2::BuildTestLinearSystem(&system, { 128, 128 });
+
+    FDMCompressedLinearSystem2 compSystem;
+    FDMLinearSystemSolverTestHelper2::BuildTestCompressedLinearSystem(&compSystem, { 128, 128 });
+
+    FDMGaussSeidelSolver2 solver(100, 10, 1e-9, 1.0, true);
+    solver.Solve(&system);
+    const unsigned int numberOfIterations = solver.GetLastNumberOfIterations();
+    const double residual = solver.GetLastResidual();
+
+    solver.SolveCompressed(&compSystem);
+
+    ASSERT_EQ(2u, compSystem.colors.size());
+    EXPECT_EQ(numberOfIterations, solver.GetLastNumberOfIterations());
+    EXPECT_NEAR(residual, solver.GetLastResidual(), 1e-9);
+}
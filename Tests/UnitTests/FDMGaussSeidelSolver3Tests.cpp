@@ -108,4 +108,90 @@ TEST(FDMGaussSeidelSolver3, SolveCompressed)
     double norm1 = FDMCompressedBLAS3::L2Norm(buffer);
 
     EXPECT_LT(norm1, norm0);
-}
\ No newline at end of file
+}
+
+TEST(FDMGaussSeidelSolver3, BuildColors)
+{
+    FDMCompressedLinearSystem3 system;
+    FDMLinearSystemSolverTestHelper3::BuildTestCompressedLinearSystem(&system, { 4, 5, 6 });
+
+    system.BuildColors();
+    ASSERT_EQ(2u, system.colors.size());
+    EXPECT_EQ(system.b.size(), system.colors[0].size() + system.colors[1].size());
+
+    const auto rp = system.A.RowPointersBegin();
+    const auto ci = system.A.ColumnIndicesBegin();
+    for (const auto& rows : system.colors)
+    {
+        std::vector<bool> inColor(system.b.size(), false);
+        for (size_t i : rows)
+        {
+            inColor[i] = true;
+        }
+
+        for (size_t i : rows)
+        {
+            for (size_t jj = rp[i]; jj < rp[i + 1]; ++jj)
+            {
+                if (ci[jj] != i)
+                {
+                    EXPECT_FALSE(inColor[ci[jj]]);
+                }
+            }
+        }
+    }
+}
+
+TEST(FDMGaussSeidelSolver3, RelaxMultiColor)
+{
+    FDMLinearSystem3 system;
+    FDMLinearSystemSolverTestHelper3::BuildTestLinearSystem(&system, { 32, 32, 32 });
+
+    FDMCompressedLinearSystem3 compSystem;
+    FDMLinearSystemSolverTestHelper3::BuildTestCompressedLinearSystem(&compSystem, { 32, 32, 32 });
+
+    // Use the same RHS for both systems
+    system.b.ForEachIndex([&](size_t i, size_t j, size_t k)
+    {
+        system.b(i, j, k) = compSystem.b[i + 32 * (j + 32 * k)];
+    });
+    compSystem.BuildColors();
+
+    for (int i = 0; i < 10; ++i)
+    {
+        FDMGaussSeidelSolver3::RelaxRedBlack(system.A, system.b, 1.0, &system.x);
+        FDMGaussSeidelSolver3::RelaxMultiColor(compSystem.A, compSystem.b, compSystem.colors, 1.0, &compSystem.x);
+    }
+
+    // Same convergence as the uncompressed red-black relaxation
+    system.x.ForEachIndex([&](size_t i, size_t j, size_t k)
+    {
+        EXPECT_NEAR(system.x(i, j, k), compSystem.x[i + 32 * (j + 32 * k)], 1e-9);
+    });
+}
+
+TEST(FDMGaussSeidelSolver3, SolveCompressedRedBlack)
+{
+    FDMLinearSystem3 system;
+    FDMLinearSystemSolverTestHelper3::BuildTestLinearSystem(&system, { 32, 32, 32 });
+
+    FDMCompressedLinearSystem3 compSystem;
+    FDMLinearSystemSolverTestHelper3::BuildTestCompressedLinearSystem(&compSystem, { 32, 32, 32 });
+
+    // Use the same RHS for both systems
+    system.b.ForEachIndex([&](size_t i, size_t j, size_t k)
+    {
+        system.b(i, j, k) = compSystem.b[i + 32 * (j + 32 * k)];
+    });
+
+    FDMGaussSeidelSolver3 solver(100, 10, 1e-9, 1.0, true);
+    solver.Solve(&system);
+    const unsigned int numberOfIterations = solver.GetLastNumberOfIterations();
+    const double residual = solver.GetLastResidual();
+
+    solver.SolveCompressed(&compSystem);
+
+    EXPECT_FALSE(compSystem.colors.empty());
+    EXPECT_EQ(numberOfIterations, solver.GetLastNumberOfIterations());
+    EXPECT_NEAR(residual, solver.GetLastResidual(), 1e-9);
+}
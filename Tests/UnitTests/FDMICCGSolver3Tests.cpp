@@ -37,4 +37,42 @@ TEST(FDMICCGSolver3, SolveCompressed)
     solver.SolveCompressed(&system);
 
     EXPECT_GT(solver.GetTolerance(), solver.GetLastResidual());
+}
+
+TEST(FDMICCGSolver3, SolveMultiple)
+{
+    FDMLinearSystem3 system;
+    FDMLinearSystemSolverTestHelper3::BuildTestLinearSystem(&system, { 8, 8, 8 });
+
+    // Second right-hand side from a known solution
+    FDMVector3 y(system.b.size());
+    y.ForEachIndex([&](size_t i, size_t j, size_t k)
+    {
+        y(i, j, k) = static_cast<double>(i + 2 * j) - static_cast<double>(k);
+    });
+
+    FDMVector3 b0(system.b);
+    FDMVector3 b1(system.b.size());
+    FDMBLAS3::MVM(system.A, y, &b1);
+
+    FDMICCGSolver3 solver(100, 1e-9);
+
+    system.b.Set(b0);
+    solver.Solve(&system);
+    FDMVector3 expected0(system.x);
+
+    system.b.Set(b1);
+    solver.Solve(&system);
+    FDMVector3 expected1(system.x);
+
+    FDMVector3 x0(b0.size());
+    FDMVector3 x1(b1.size());
+    EXPECT_TRUE(solver.SolveMultiple(&system, { &b0, &b1 }, { &x0, &x1 }));
+    EXPECT_GT(solver.GetTolerance(), solver.GetLastResidual());
+
+    x0.ForEachIndex([&](size_t i, size_t j, size_t k)
+    {
+        EXPECT_EQ(expected0(i, j, k), x0(i, j, k));
+        EXPECT_EQ(expected1(i, j, k), x1(i, j, k));
+    });
 }
\ No newline at end of file
@@ -304,6 +304,35 @@ TEST(FaceCenteredGrid3, Sample)
 	});
 }
 
+TEST(FaceCenteredGrid3, BatchSample)
+{
+	FaceCenteredGrid3 grid(5, 8, 6, 2.0, 3.0, 1.5, -1.0, 2.0, 0.5);
+	grid.Fill([&](const Vector3D& x)
+	{
+		return Vector3D(std::sin(x.y) + x.z, std::cos(x.z) * x.x, x.x * x.y - 2.0);
+	});
+
+	Array1<Vector3D> points;
+	for (int i = -2; i < 14; ++i)
+	{
+		for (int j = -2; j < 28; ++j)
+		{
+			points.Append(Vector3D(0.77 * i - 1.0, 0.91 * j + 1.3, 0.43 * (i + j) - 0.2));
+		}
+	}
+
+	Array1<Vector3D> results(points.size());
+	grid.BatchSample(points.ConstAccessor(), results.Accessor());
+
+	for (size_t i = 0; i < points.size(); ++i)
+	{
+		Vector3D expected = grid.Sample(points[i]);
+		EXPECT_DOUBLE_EQ(expected.x, results[i].x);
+		EXPECT_DOUBLE_EQ(expected.y, results[i].y);
+		EXPECT_DOUBLE_EQ(expected.z, results[i].z);
+	}
+}
+
 TEST(FaceCenteredGrid3, Builder)
 {
 	{
@@ -1,6 +1,7 @@
 #include "pch.h"
 
 #include <Core/Grid/CellCenteredScalarGrid3.h>
+#include <Core/Grid/CellCenteredVectorGrid3.h>
 #include <Core/Solver/Grid/GridBackwardEulerDiffusionSolver3.h>
 
 using namespace CubbyFlow;
@@ -38,4 +39,44 @@ TEST(GridBackwardEulerDiffusionSolver3, Solve)
 	{
 		EXPECT_NEAR(solution(i, j, k), dst(i, j, k), 1e-6);
 	});
+}
+
+TEST(GridBackwardEulerDiffusionSolver3, SolveMultiple)
+{
+	CellCenteredScalarGrid3 src0(8, 8, 8, 1.0, 1.0, 1.0, 0.0, 0.0, 0.0);
+	CellCenteredScalarGrid3 src1(8, 8, 8, 1.0, 1.0, 1.0, 0.0, 0.0, 0.0);
+	src0.Fill([](const Vector3D& pt) { return pt.x * pt.y; });
+	src1.Fill([](const Vector3D& pt) { return std::sin(pt.z); });
+
+	GridBackwardEulerDiffusionSolver3 diffusionSolver(GridBackwardEulerDiffusionSolver3::BoundaryType::Dirichlet);
+
+	CellCenteredScalarGrid3 expected0(src0), expected1(src1);
+	diffusionSolver.Solve(src0, 0.1, 1.0, &expected0);
+	diffusionSolver.Solve(src1, 0.1, 1.0, &expected1);
+
+	CellCenteredScalarGrid3 dst0(src0), dst1(src1);
+	diffusionSolver.Solve(
+		std::vector<const ScalarGrid3*>{ &src0, &src1 },
+		0.1,
+		1.0,
+		std::vector<ScalarGrid3*>{ &dst0, &dst1 });
+
+	dst0.ForEachDataPointIndex([&](size_t i, size_t j, size_t k)
+	{
+		EXPECT_EQ(expected0(i, j, k), dst0(i, j, k));
+		EXPECT_EQ(expected1(i, j, k), dst1(i, j, k));
+	});
+
+	// Each component of a vector grid is the same as a scalar solve
+	CellCenteredVectorGrid3 vecSrc(8, 8, 8, 1.0, 1.0, 1.0, 0.0, 0.0, 0.0);
+	vecSrc.Fill([](const Vector3D& pt) { return Vector3D(pt.x * pt.y, std::sin(pt.z), 1.0); });
+
+	CellCenteredVectorGrid3 vecDst(vecSrc);
+	diffusionSolver.Solve(vecSrc, 0.1, 1.0, &vecDst);
+
+	vecDst.ForEachDataPointIndex([&](size_t i, size_t j, size_t k)
+	{
+		EXPECT_EQ(expected0(i, j, k), vecDst(i, j, k).x);
+		EXPECT_EQ(expected1(i, j, k), vecDst(i, j, k).y);
+	});
 }
\ No newline at end of file
@@ -84,4 +84,14 @@ TEST(GridFluidSolver2, GravityOnly)
 			EXPECT_NEAR(-0.1, solver.GetVelocity()->GetV(i, j), 1e-8);
 		}
 	});
-}
\ No newline at end of file
+}
+TEST(GridFluidSolver2, CFL)
+{
+	GridFluidSolver2 solver;
+	solver.SetGravity(Vector2D());
+	solver.ResizeGrid(Size2(4, 4), Vector2D(0.25, 0.25), Vector2D());
+
+	// Fast flow in the negative direction counts as much as in the positive one
+	solver.GetVelocity()->Fill(Vector2D(0.5, -2.0));
+	EXPECT_NEAR(0.8, solver.GetCFL(0.1), 1e-12);
+}
@@ -94,4 +94,14 @@ TEST(GridFluidSolver3, GravityOnly)
 	{
 		EXPECT_NEAR(0.0, solver.GetVelocity()->GetW(i, j, k), 1e-8);
 	});
-}
\ No newline at end of file
+}
+TEST(GridFluidSolver3, CFL)
+{
+	GridFluidSolver3 solver;
+	solver.SetGravity(Vector3D());
+	solver.ResizeGrid(Size3(4, 4, 4), Vector3D(0.25, 0.25, 0.25), Vector3D());
+
+	// Fast flow in the negative direction counts as much as in the positive one
+	solver.GetVelocity()->Fill(Vector3D(0.5, -2.0, 1.0));
+	EXPECT_NEAR(0.8, solver.GetCFL(0.1), 1e-12);
+}
@@ -1,5 +1,7 @@
 #include "pch.h"
 
+#include <Core/Collider/RigidBodyCollider3.h>
+#include <Core/Geometry/Sphere3.h>
 #include <Core/Solver/Grid/GridFractionalBoundaryConditionSolver3.h>
 
 using namespace CubbyFlow;
@@ -106,4 +108,63 @@ TEST(GridFractionalBoundaryConditionSolver3, OpenDomain)
 			EXPECT_DOUBLE_EQ(1.0, velocity.GetW(i, j, k));
 		}
 	});
-}
\ No newline at end of file
+}
+TEST(GridFractionalBoundaryConditionSolver3, CachedColliderSDF)
+{
+	Size3 gridSize(32, 32, 32);
+	Vector3D gridSpacing(1.0 / 32.0, 1.0 / 32.0, 1.0 / 32.0);
+	Vector3D gridOrigin(0.0, 0.0, 0.0);
+
+	auto sphere = Sphere3::GetBuilder()
+		.WithCenter(Vector3D(0.0, 0.0, 0.0))
+		.WithRadius(0.2)
+		.WithTranslation(Vector3D(0.5, 0.5, 0.5))
+		.MakeShared();
+	auto collider = std::make_shared<RigidBodyCollider3>(sphere);
+	collider->SetIsUsingSDFCache(true);
+
+	GridFractionalBoundaryConditionSolver3 bndSolver;
+	bndSolver.UpdateCollider(collider, gridSize, gridSpacing, gridOrigin);
+
+	auto localSDF = collider->GetLocalSDF(gridSpacing);
+	ASSERT_NE(nullptr, localSDF);
+
+	auto checkSDF = [&](const CellCenteredScalarGrid3& sdf, const Vector3D& center)
+	{
+		auto pos = sdf.GetDataPosition();
+		sdf.ForEachDataPointIndex([&](size_t i, size_t j, size_t k)
+		{
+			const double expected = pos(i, j, k).DistanceTo(center) - 0.2;
+
+			if (std::fabs(expected) < 0.1)
+			{
+				EXPECT_NEAR(expected, sdf(i, j, k), 1e-2);
+			}
+			else
+			{
+				EXPECT_EQ(expected > 0.0, sdf(i, j, k) > 0.0);
+			}
+		});
+	};
+
+	auto sdf = std::dynamic_pointer_cast<CellCenteredScalarGrid3>(bndSolver.GetColliderSDF());
+	ASSERT_NE(nullptr, sdf);
+	checkSDF(*sdf, Vector3D(0.5, 0.5, 0.5));
+
+	// Rigid motion reuses the local cache and updates the grid incrementally
+	sphere->transform.SetTranslation(Vector3D(0.55, 0.45, 0.5));
+	sphere->transform.SetOrientation(QuaternionD(Vector3D(0, 0, 1), 0.3));
+	bndSolver.UpdateCollider(collider, gridSize, gridSpacing, gridOrigin);
+
+	EXPECT_EQ(localSDF, collider->GetLocalSDF(gridSpacing));
+	checkSDF(*sdf, Vector3D(0.55, 0.45, 0.5));
+
+	GridFractionalBoundaryConditionSolver3 bndSolver2;
+	bndSolver2.UpdateCollider(collider, gridSize, gridSpacing, gridOrigin);
+
+	auto sdf2 = std::dynamic_pointer_cast<CellCenteredScalarGrid3>(bndSolver2.GetColliderSDF());
+	sdf->ForEachDataPointIndex([&](size_t i, size_t j, size_t k)
+	{
+		EXPECT_DOUBLE_EQ((*sdf2)(i, j, k), (*sdf)(i, j, k));
+	});
+}
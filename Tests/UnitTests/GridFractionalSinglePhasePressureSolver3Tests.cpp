@@ -1,6 +1,7 @@
 #include "pch.h"
 
 #include <Core/Grid/CellCenteredScalarGrid3.h>
+#include <Core/Solver/FDM/FDMCGSolver3.h>
 #include <Core/Solver/Grid/GridFractionalSinglePhasePressureSolver3.h>
 
 using namespace CubbyFlow;
@@ -168,4 +169,119 @@ TEST(GridFractionalSinglePhasePressureSolver3, SolveFreeSurfaceCompressed)
             }
         }
     }
-}
\ No newline at end of file
+}
+
+TEST(GridFractionalSinglePhasePressureSolver3, SolveWithWarmStart)
+{
+    const size_t n = 16;
+    const double dx = 1.0 / static_cast<double>(n);
+
+    CellCenteredScalarGrid3 fluidSDF(n, n, n, dx, dx, dx);
+    fluidSDF.Fill([&](const Vector3D& x)
+    {
+        return x.y - 0.5 - 0.1 * (x.x - 0.5);
+    });
+
+    for (bool compressed : { false, true })
+    {
+        auto coldSolver = std::make_shared<FDMCGSolver3>(1000, 1e-9);
+        auto warmSolver = std::make_shared<FDMCGSolver3>(1000, 1e-9);
+
+        GridFractionalSinglePhasePressureSolver3 cold;
+        cold.SetLinearSystemSolver(coldSolver);
+
+        GridFractionalSinglePhasePressureSolver3 warm;
+        warm.SetLinearSystemSolver(warmSolver);
+        warm.SetUseWarmStart(true);
+        EXPECT_TRUE(warm.GetUseWarmStart());
+
+        // Gravity applied to a fluid at rest for a few steps
+        FaceCenteredGrid3 vel(n, n, n, dx, dx, dx);
+        FaceCenteredGrid3 output(n, n, n, dx, dx, dx);
+
+        for (int step = 0; step < 3; ++step)
+        {
+            vel.Fill(Vector3D(0.0, -1.0, 0.0));
+            vel.ForEachVIndex([&](size_t i, size_t j, size_t k)
+            {
+                if (j == 0 || j == n)
+                {
+                    vel.GetV(i, j, k) = 0.0;
+                }
+            });
+
+            cold.Solve(vel, 0.01, &output, ConstantScalarField3(std::numeric_limits<double>::max()),
+                ConstantVectorField3({ 0, 0, 0 }), fluidSDF, compressed);
+            warm.Solve(vel, 0.01, &output, ConstantScalarField3(std::numeric_limits<double>::max()),
+                ConstantVectorField3({ 0, 0, 0 }), fluidSDF, compressed);
+
+            // The flag of the linear system solver is left as it was set
+            EXPECT_FALSE(warmSolver->GetUseInitialGuess());
+
+            if (step > 0)
+            {
+                EXPECT_LT(warmSolver->GetLastNumberOfIterations(), coldSolver->GetLastNumberOfIterations() / 2);
+            }
+
+            const auto& coldPressure = cold.GetPressure();
+            const auto& warmPressure = warm.GetPressure();
+            coldPressure.ForEachIndex([&](size_t i, size_t j, size_t k)
+            {
+                EXPECT_NEAR(coldPressure(i, j, k), warmPressure(i, j, k), 1e-6);
+            });
+        }
+    }
+}
+
+TEST(GridFractionalSinglePhasePressureSolver3, SolveCompressedWithMovingSurface)
+{
+    const size_t n = 16;
+    const double dx = 1.0 / static_cast<double>(n);
+
+    FaceCenteredGrid3 vel(n, n, n, dx, dx, dx);
+    vel.Fill([](const Vector3D& x)
+    {
+        return Vector3D(x.y * (1.0 - x.y), -0.2, x.x * x.z);
+    });
+
+    GridFractionalSinglePhasePressureSolver3 solver;
+    solver.SetLinearSystemSolver(std::make_shared<FDMCGSolver3>(1000, 1e-10));
+
+    // Small moves patch the kept system, and the large move renumbers it
+    const std::vector<double> heights = { 0.5, 0.52, 0.49, 0.53, 0.8, 0.78, 0.3 };
+
+    for (double height : heights)
+    {
+        CellCenteredScalarGrid3 fluidSDF(n, n, n, dx, dx, dx);
+        fluidSDF.Fill([&](const Vector3D& x)
+        {
+            return x.y - height - 0.1 * (x.x - 0.5);
+        });
+
+        FaceCenteredGrid3 output(n, n, n, dx, dx, dx);
+        solver.Solve(vel, 1.0, &output,
+            ConstantScalarField3(std::numeric_limits<double>::max()),
+            ConstantVectorField3({ 0, 0, 0 }), fluidSDF, true);
+
+        // Reference which builds the system from scratch
+        GridFractionalSinglePhasePressureSolver3 reference;
+        reference.SetLinearSystemSolver(std::make_shared<FDMCGSolver3>(1000, 1e-10));
+
+        FaceCenteredGrid3 refOutput(n, n, n, dx, dx, dx);
+        reference.Solve(vel, 1.0, &refOutput,
+            ConstantScalarField3(std::numeric_limits<double>::max()),
+            ConstantVectorField3({ 0, 0, 0 }), fluidSDF, true);
+
+        const auto& pressure = solver.GetPressure();
+        const auto& refPressure = reference.GetPressure();
+        refPressure.ForEachIndex([&](size_t i, size_t j, size_t k)
+        {
+            EXPECT_NEAR(refPressure(i, j, k), pressure(i, j, k), 1e-6);
+        });
+
+        refOutput.ForEachVIndex([&](size_t i, size_t j, size_t k)
+        {
+            EXPECT_NEAR(refOutput.GetV(i, j, k), output.GetV(i, j, k), 1e-6);
+        });
+    }
+}
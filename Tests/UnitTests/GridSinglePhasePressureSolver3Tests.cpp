@@ -1,6 +1,7 @@
 #include "pch.h"
 
 #include <Core/Grid/CellCenteredScalarGrid3.h>
+#include <Core/Solver/FDM/FDMCGSolver3.h>
 #include <Core/Solver/Grid/GridSinglePhasePressureSolver3.h>
 
 using namespace CubbyFlow;
@@ -422,4 +423,66 @@ TEST(GridSinglePhasePressureSolver3, SolveFreeSurfaceWithBoundary)
 			}
 		}
 	}
-}
\ No newline at end of file
+}
+
+TEST(GridSinglePhasePressureSolver3, SolveWithWarmStart)
+{
+	const size_t n = 16;
+	const double dx = 1.0 / static_cast<double>(n);
+
+	CellCenteredScalarGrid3 fluidSDF(n, n, n, dx, dx, dx);
+	fluidSDF.Fill([&](const Vector3D& x)
+	{
+		return x.y - 0.5 - 0.1 * (x.x - 0.5);
+	});
+
+	for (bool compressed : { false, true })
+	{
+		auto coldSolver = std::make_shared<FDMCGSolver3>(1000, 1e-9);
+		auto warmSolver = std::make_shared<FDMCGSolver3>(1000, 1e-9);
+
+		GridSinglePhasePressureSolver3 cold;
+		cold.SetLinearSystemSolver(coldSolver);
+
+		GridSinglePhasePressureSolver3 warm;
+		warm.SetLinearSystemSolver(warmSolver);
+		warm.SetUseWarmStart(true);
+		EXPECT_TRUE(warm.GetUseWarmStart());
+
+		// Gravity applied to a fluid at rest for a few steps
+		FaceCenteredGrid3 vel(n, n, n, dx, dx, dx);
+		FaceCenteredGrid3 output(n, n, n, dx, dx, dx);
+
+		for (int step = 0; step < 3; ++step)
+		{
+			vel.Fill(Vector3D(0.0, -1.0, 0.0));
+			vel.ForEachVIndex([&](size_t i, size_t j, size_t k)
+			{
+				if (j == 0 || j == n)
+				{
+					vel.GetV(i, j, k) = 0.0;
+				}
+			});
+
+			cold.Solve(vel, 0.01, &output, ConstantScalarField3(std::numeric_limits<double>::max()),
+				ConstantVectorField3({ 0, 0, 0 }), fluidSDF, compressed);
+			warm.Solve(vel, 0.01, &output, ConstantScalarField3(std::numeric_limits<double>::max()),
+				ConstantVectorField3({ 0, 0, 0 }), fluidSDF, compressed);
+
+			// The flag of the linear system solver is left as it was set
+			EXPECT_FALSE(warmSolver->GetUseInitialGuess());
+
+			if (step > 0)
+			{
+				EXPECT_LT(warmSolver->GetLastNumberOfIterations(), coldSolver->GetLastNumberOfIterations() / 2);
+			}
+
+			const auto& coldPressure = cold.GetPressure();
+			const auto& warmPressure = warm.GetPressure();
+			coldPressure.ForEachIndex([&](size_t i, size_t j, size_t k)
+			{
+				EXPECT_NEAR(coldPressure(i, j, k), warmPressure(i, j, k), 1e-6);
+			});
+		}
+	}
+}
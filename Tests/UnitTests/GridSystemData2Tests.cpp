@@ -161,4 +161,35 @@ TEST(GridSystemData2, Serialize)
 	{
 		EXPECT_EQ(velocity->GetV(i, j), velocity2->GetV(i, j));
 	});
+}
+
+TEST(GridSystemData2, BackBuffers)
+{
+	GridSystemData2 grids({ 8, 16 }, { 1.0, 2.0 }, { -5.0, 4.5 });
+
+	size_t scalarIdx = grids.AddAdvectableScalarData(std::make_shared<VertexCenteredScalarGrid2::Builder>());
+	size_t vectorIdx = grids.AddAdvectableVectorData(std::make_shared<CellCenteredVectorGrid2::Builder>());
+
+	auto scalar = grids.GetAdvectableScalarDataAt(scalarIdx);
+	auto scalar1 = grids.GetAdvectableScalarDataBackBufferAt(scalarIdx);
+	EXPECT_TRUE(scalar != scalar1);
+	EXPECT_TRUE(std::dynamic_pointer_cast<VertexCenteredScalarGrid2>(scalar1) != nullptr);
+	EXPECT_TRUE(scalar->HasSameShape(*scalar1));
+	EXPECT_EQ(scalar1, grids.GetAdvectableScalarDataBackBufferAt(scalarIdx));
+
+	auto vector = grids.GetAdvectableVectorDataAt(vectorIdx);
+	auto vector1 = grids.GetAdvectableVectorDataBackBufferAt(vectorIdx);
+	EXPECT_TRUE(vector != vector1);
+	EXPECT_TRUE(vector->HasSameShape(*vector1));
+
+	auto velocity = grids.GetVelocity();
+	auto velocity1 = grids.GetVelocityBackBuffer();
+	EXPECT_TRUE(velocity != velocity1);
+	EXPECT_TRUE(velocity->HasSameShape(*velocity1));
+	EXPECT_EQ(velocity1, grids.GetVelocityBackBuffer());
+
+	grids.Resize({ 4, 4 }, { 1.0, 1.0 }, { 0.0, 0.0 });
+
+	EXPECT_TRUE(grids.GetAdvectableScalarDataAt(scalarIdx)->HasSameShape(*grids.GetAdvectableScalarDataBackBufferAt(scalarIdx)));
+	EXPECT_TRUE(grids.GetVelocity()->HasSameShape(*grids.GetVelocityBackBuffer()));
 }
\ No newline at end of file
@@ -178,4 +178,46 @@ TEST(GridSystemData3, Serialize)
 	{
 		EXPECT_EQ(velocity->GetW(i, j, k), velocity2->GetW(i, j, k));
 	});
-}
\ No newline at end of file
+}
+
+TEST(GridSystemData3, BackBuffers)
+{
+	GridSystemData3 grids({ 8, 16, 12 }, { 1.0, 2.0, 3.0 }, { -5.0, 4.5, 10.0 });
+
+	size_t scalarIdx = grids.AddAdvectableScalarData(std::make_shared<VertexCenteredScalarGrid3::Builder>());
+	size_t vectorIdx = grids.AddAdvectableVectorData(std::make_shared<CellCenteredVectorGrid3::Builder>());
+
+	auto scalar = grids.GetAdvectableScalarDataAt(scalarIdx);
+	auto scalar1 = grids.GetAdvectableScalarDataBackBufferAt(scalarIdx);
+	EXPECT_TRUE(scalar != scalar1);
+	EXPECT_TRUE(std::dynamic_pointer_cast<VertexCenteredScalarGrid3>(scalar1) != nullptr);
+	EXPECT_TRUE(scalar->HasSameShape(*scalar1));
+	EXPECT_EQ(scalar1, grids.GetAdvectableScalarDataBackBufferAt(scalarIdx));
+
+	auto vector = grids.GetAdvectableVectorDataAt(vectorIdx);
+	auto vector1 = grids.GetAdvectableVectorDataBackBufferAt(vectorIdx);
+	EXPECT_TRUE(vector != vector1);
+	EXPECT_TRUE(std::dynamic_pointer_cast<CellCenteredVectorGrid3>(vector1) != nullptr);
+	EXPECT_TRUE(vector->HasSameShape(*vector1));
+	EXPECT_EQ(vector1, grids.GetAdvectableVectorDataBackBufferAt(vectorIdx));
+
+	auto velocity = grids.GetVelocity();
+	auto velocity1 = grids.GetVelocityBackBuffer();
+	EXPECT_TRUE(velocity != velocity1);
+	EXPECT_TRUE(velocity->HasSameShape(*velocity1));
+	EXPECT_EQ(velocity1, grids.GetVelocityBackBuffer());
+
+	// Swapping keeps both buffers alive with the same shape
+	scalar->Fill(1.0);
+	scalar1->Fill(2.0);
+	scalar->Swap(scalar1.get());
+	EXPECT_EQ(2.0, (*scalar)(1, 2, 3));
+	EXPECT_EQ(1.0, (*scalar1)(1, 2, 3));
+
+	grids.Resize({ 4, 4, 4 }, { 1.0, 1.0, 1.0 }, { 0.0, 0.0, 0.0 });
+
+	auto scalar2 = grids.GetAdvectableScalarDataBackBufferAt(scalarIdx);
+	EXPECT_EQ(Size3(4, 4, 4), scalar2->Resolution());
+	EXPECT_TRUE(grids.GetAdvectableScalarDataAt(scalarIdx)->HasSameShape(*scalar2));
+	EXPECT_TRUE(grids.GetVelocity()->HasSameShape(*grids.GetVelocityBackBuffer()));
+}
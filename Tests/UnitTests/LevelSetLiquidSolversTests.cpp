@@ -1,5 +1,6 @@
 #include "pch.h"
 
+#include <Core/Emitter/VolumeGridEmitter3.h>
 #include <Core/Geometry/Sphere2.h>
 #include <Core/Geometry/Sphere3.h>
 #include <Core/Size/Size2.h>
@@ -10,6 +11,7 @@
 #include <Core/Surface/ImplicitSurfaceSet2.h>
 #include <Core/Surface/ImplicitSurface3.h>
 #include <Core/Surface/ImplicitSurfaceSet3.h>
+#include <Core/Surface/SurfaceToImplicit3.h>
 
 using namespace CubbyFlow;
 
@@ -67,4 +69,121 @@ TEST(LevelSetLiquidSolver3, ComputeVolume)
 	const double ans = 4.0 / 3.0 * Cubic(radius) * PI_DOUBLE;
 
 	EXPECT_NEAR(ans, volume, 0.001);
-}
\ No newline at end of file
+}
+TEST(LevelSetLiquidSolver3, NarrowBand)
+{
+	auto setUp = [](LevelSetLiquidSolver3* solver)
+	{
+		auto data = solver->GetGridSystemData();
+		double dx = 1.0 / 32.0;
+		data->Resize(Size3(32, 32, 32), Vector3D(dx, dx, dx), Vector3D());
+
+		const Vector3D center(0.5, 0.6, 0.5);
+		auto sdf = solver->GetSignedDistanceField();
+		sdf->Fill([&](const Vector3D& x)
+		{
+			return (x - center).Length() - 0.2;
+		});
+	};
+
+	LevelSetLiquidSolver3 fullSolver;
+	setUp(&fullSolver);
+
+	LevelSetLiquidSolver3 bandSolver;
+	bandSolver.SetNarrowBandWidth(5);
+	setUp(&bandSolver);
+
+	EXPECT_EQ(5u, bandSolver.GetNarrowBandWidth());
+
+	Frame frame(0, 1.0 / 60.0);
+	for (; frame.index < 5; ++frame)
+	{
+		fullSolver.Update(frame);
+		bandSolver.Update(frame);
+	}
+
+	auto fullSDF = fullSolver.GetSignedDistanceField();
+	auto bandSDF = bandSolver.GetSignedDistanceField();
+	const double dx = bandSDF->GridSpacing().x;
+	const double bandDist = 5.0 * dx;
+
+	// Only the cells around the surface are processed
+	EXPECT_GT(bandSolver.GetNumberOfNarrowBandCells(), 0u);
+	EXPECT_LT(bandSolver.GetNumberOfNarrowBandCells(), 32u * 32u * 32u / 2u);
+
+	EXPECT_NEAR(fullSolver.ComputeVolume(), bandSolver.ComputeVolume(), 0.001);
+
+	bandSDF->ForEachDataPointIndex([&](size_t i, size_t j, size_t k)
+	{
+		const double phi = (*bandSDF)(i, j, k);
+
+		// Far field is clamped
+		EXPECT_LE(std::abs(phi), bandDist + 1e-9);
+
+		// Same surface near the interface
+		if (std::abs((*fullSDF)(i, j, k)) < dx)
+		{
+			EXPECT_NEAR((*fullSDF)(i, j, k), phi, 0.5 * dx);
+		}
+	});
+}
+
+TEST(LevelSetLiquidSolver3, NarrowBandWithEmitter)
+{
+	auto setUp = [](LevelSetLiquidSolver3* solver)
+	{
+		auto data = solver->GetGridSystemData();
+		double dx = 1.0 / 32.0;
+		data->Resize(Size3(32, 32, 32), Vector3D(dx, dx, dx), Vector3D());
+		solver->SetIsGlobalCompensationEnabled(true);
+
+		const Vector3D center(0.3, 0.6, 0.5);
+		auto sdf = solver->GetSignedDistanceField();
+		sdf->Fill([&](const Vector3D& x)
+		{
+			return (x - center).Length() - 0.15;
+		});
+
+		// The emitter adds a second sphere far from the first one
+		auto emitter = std::make_shared<VolumeGridEmitter3>(
+			std::make_shared<SurfaceToImplicit3>(
+				std::make_shared<Sphere3>(Vector3D(0.7, 0.6, 0.5), 0.15)));
+		emitter->AddSignedDistanceTarget(sdf);
+		solver->SetEmitter(emitter);
+	};
+
+	LevelSetLiquidSolver3 fullSolver;
+	setUp(&fullSolver);
+
+	LevelSetLiquidSolver3 bandSolver;
+	bandSolver.SetNarrowBandWidth(5);
+	setUp(&bandSolver);
+
+	Frame frame(0, 1.0 / 60.0);
+	for (; frame.index < 3; ++frame)
+	{
+		fullSolver.Update(frame);
+		bandSolver.Update(frame);
+	}
+
+	auto fullSDF = fullSolver.GetSignedDistanceField();
+	auto bandSDF = bandSolver.GetSignedDistanceField();
+	const double dx = bandSDF->GridSpacing().x;
+	const double bandDist = 5.0 * dx;
+
+	EXPECT_NEAR(fullSolver.ComputeVolume(), bandSolver.ComputeVolume(), 0.001);
+
+	bandSDF->ForEachDataPointIndex([&](size_t i, size_t j, size_t k)
+	{
+		const double phi = (*bandSDF)(i, j, k);
+
+		// Far field is clamped, also inside of the emitted sphere
+		EXPECT_LE(std::abs(phi), bandDist + 1e-9);
+
+		// Same surface near both spheres
+		if (std::abs((*fullSDF)(i, j, k)) < dx)
+		{
+			EXPECT_NEAR((*fullSDF)(i, j, k), phi, 0.5 * dx);
+		}
+	});
+}
@@ -6,6 +6,7 @@
 #include <Core/Solver/LevelSet/ENOLevelSetSolver3.h>
 #include <Core/Solver/LevelSet/FMMLevelSetSolver2.h>
 #include <Core/Solver/LevelSet/FMMLevelSetSolver3.h>
+#include <Core/Solver/LevelSet/FSMLevelSetSolver3.h>
 #include <Core/Solver/LevelSet/UpwindLevelSetSolver2.h>
 #include <Core/Solver/LevelSet/UpwindLevelSetSolver3.h>
 
@@ -297,4 +298,155 @@ TEST(FMMLevelSetSolver3, Extrapolate)
 			}
 		}
 	}
-}
\ No newline at end of file
+}
+
+TEST(FSMLevelSetSolver3, Reinitialize)
+{
+	CellCenteredScalarGrid3 sdf(40, 30, 50), temp(40, 30, 50), fmmTemp(40, 30, 50);
+
+	sdf.Fill([](const Vector3D& x)
+	{
+		return (x - Vector3D(20, 20, 20)).Length() - 8.0;
+	});
+
+	FSMLevelSetSolver3 solver;
+	solver.Reinitialize(sdf, 5.0, &temp);
+
+	FMMLevelSetSolver3 fmmSolver;
+	fmmSolver.Reinitialize(sdf, 5.0, &fmmTemp);
+
+	double fsmError = 0.0;
+	double fmmError = 0.0;
+
+	for (size_t k = 0; k < 50; ++k)
+	{
+		for (size_t j = 0; j < 30; ++j)
+		{
+			for (size_t i = 0; i < 40; ++i)
+			{
+				EXPECT_NEAR(sdf(i, j, k), temp(i, j, k), 0.9)
+					<< i << ", " << j << ", " << k;
+
+				if (std::abs(sdf(i, j, k)) < 5.0)
+				{
+					fsmError = std::max(fsmError, std::abs(sdf(i, j, k) - temp(i, j, k)));
+					fmmError = std::max(fmmError, std::abs(sdf(i, j, k) - fmmTemp(i, j, k)));
+				}
+			}
+		}
+	}
+
+	// Same discretization as FMM, so the accuracy should be comparable.
+	EXPECT_LE(fsmError, fmmError + 0.1);
+	EXPECT_LE(solver.GetLastNumberOfIterations(), solver.GetMaxNumberOfIterations());
+}
+
+TEST(FSMLevelSetSolver3, ReinitializeNarrowBand)
+{
+	CellCenteredScalarGrid3 sdf(40, 30, 50), temp(40, 30, 50);
+
+	sdf.Fill([](const Vector3D& x)
+	{
+		return 2.0 * ((x - Vector3D(20, 15, 25)).Length() - 8.0);
+	});
+
+	FSMLevelSetSolver3 solver;
+	solver.Reinitialize(sdf, 3.0, &temp);
+
+	for (size_t k = 0; k < 50; ++k)
+	{
+		for (size_t j = 0; j < 30; ++j)
+		{
+			for (size_t i = 0; i < 40; ++i)
+			{
+				const double expected = 0.5 * sdf(i, j, k);
+
+				if (std::abs(expected) < 2.5)
+				{
+					// Distorted input is restored to a distance field in the band.
+					EXPECT_NEAR(expected, temp(i, j, k), 0.9)
+						<< i << ", " << j << ", " << k;
+				}
+				else if (std::abs(expected) > 4.5)
+				{
+					// Cells far outside of the band are left untouched.
+					EXPECT_DOUBLE_EQ(sdf(i, j, k), temp(i, j, k))
+						<< i << ", " << j << ", " << k;
+				}
+			}
+		}
+	}
+}
+
+TEST(FSMLevelSetSolver3, Extrapolate)
+{
+	CellCenteredScalarGrid3 sdf(40, 30, 50), temp(40, 30, 50);
+	CellCenteredScalarGrid3 field(40, 30, 50);
+
+	sdf.Fill([](const Vector3D& x)
+	{
+		return (x - Vector3D(20, 20, 20)).Length() - 8.0;
+	});
+	field.Fill(5.0);
+
+	FSMLevelSetSolver3 solver;
+	solver.Extrapolate(field, sdf, 5.0, &temp);
+
+	for (size_t k = 0; k < 50; ++k)
+	{
+		for (size_t j = 0; j < 30; ++j)
+		{
+			for (size_t i = 0; i < 40; ++i)
+			{
+				EXPECT_DOUBLE_EQ(5.0, temp(i, j, k))
+					<< i << ", " << j << ", " << k;
+			}
+		}
+	}
+}
+
+TEST(FSMLevelSetSolver3, ExtrapolateMatchesFMM)
+{
+	CellCenteredScalarGrid3 sdf(40, 30, 50);
+	CellCenteredScalarGrid3 field(40, 30, 50), temp(40, 30, 50), fmmTemp(40, 30, 50);
+
+	sdf.Fill([](const Vector3D& x)
+	{
+		return (x - Vector3D(20, 20, 20)).Length() - 8.0;
+	});
+	field.Fill([](const Vector3D& x)
+	{
+		return (x - Vector3D(20, 20, 20)).Length() < 8.0 ? x.x + 2.0 * x.y - x.z : 0.0;
+	});
+
+	FSMLevelSetSolver3 solver;
+	solver.Extrapolate(field, sdf, 5.0, &temp);
+
+	FMMLevelSetSolver3 fmmSolver;
+	fmmSolver.Extrapolate(field, sdf, 5.0, &fmmTemp);
+
+	double fsmError = 0.0;
+	double fmmError = 0.0;
+
+	for (size_t k = 0; k < 50; ++k)
+	{
+		for (size_t j = 0; j < 30; ++j)
+		{
+			for (size_t i = 0; i < 40; ++i)
+			{
+				if (sdf(i, j, k) > 0.0 && sdf(i, j, k) < 4.0)
+				{
+					// Exact extrapolation is constant along the surface normal.
+					const Vector3D x = sdf.GetDataPosition()(i, j, k);
+					const Vector3D p = Vector3D(20, 20, 20) + 8.0 * (x - Vector3D(20, 20, 20)).Normalized();
+					const double expected = p.x + 2.0 * p.y - p.z;
+
+					fsmError = std::max(fsmError, std::abs(expected - temp(i, j, k)));
+					fmmError = std::max(fmmError, std::abs(expected - fmmTemp(i, j, k)));
+				}
+			}
+		}
+	}
+
+	EXPECT_LE(fsmError, fmmError + 0.1);
+}
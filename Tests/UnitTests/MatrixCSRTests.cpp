@@ -538,6 +538,157 @@ TEST(MatrixCSR, Builders)
 	}
 }
 
+TEST(MatrixCSR, ParallelBuild)
+{
+	// Tridiagonal matrix with a dense last row
+	const size_t n = 100;
+	MatrixCSRD matAppended;
+
+	for (size_t i = 0; i < n; ++i)
+	{
+		std::vector<double> row;
+		std::vector<size_t> colIdx;
+
+		for (size_t j = 0; j < n; ++j)
+		{
+			if (i + 1 == n || (j + 1 >= i && j <= i + 1))
+			{
+				row.push_back(static_cast<double>(i * n + j));
+				colIdx.push_back(j);
+			}
+		}
+
+		matAppended.AddRow(row, colIdx);
+	}
+
+	auto rowSize = [&](size_t i) -> size_t
+	{
+		if (i + 1 == n)
+		{
+			return n;
+		}
+
+		return (i == 0) ? 2 : 3;
+	};
+
+	// Writes the columns in descending order to exercise the sorting
+	auto rowFill = [&](size_t i, MatrixCSRD::NonZeroIterator nonZeros, MatrixCSRD::IndexIterator columnIndices)
+	{
+		const size_t count = rowSize(i);
+		const size_t first = (i + 1 == n || i == 0) ? 0 : i - 1;
+
+		for (size_t jj = 0; jj < count; ++jj)
+		{
+			const size_t j = first + count - 1 - jj;
+			nonZeros[jj] = static_cast<double>(i * n + j);
+			columnIndices[jj] = j;
+		}
+	};
+
+	const MatrixCSRD matBuilt(n, n, rowSize, rowFill);
+
+	EXPECT_EQ(n, matBuilt.Rows());
+	EXPECT_EQ(n, matBuilt.Cols());
+	EXPECT_EQ(matAppended.NumberOfNonZeros(), matBuilt.NumberOfNonZeros());
+	EXPECT_TRUE(matAppended.IsEqual(matBuilt));
+
+	for (size_t i = 0; i <= n; ++i)
+	{
+		EXPECT_EQ(matAppended.RowPointer(i), matBuilt.RowPointer(i));
+	}
+
+	for (size_t i = 0; i < matBuilt.NumberOfNonZeros(); ++i)
+	{
+		EXPECT_EQ(matAppended.ColumnIndex(i), matBuilt.ColumnIndex(i));
+		EXPECT_EQ(matAppended.NonZero(i), matBuilt.NonZero(i));
+	}
+
+	MatrixCSRD matEmpty;
+	matEmpty.Build(3, 4, [](size_t) { return size_t(0); },
+		[](size_t, MatrixCSRD::NonZeroIterator, MatrixCSRD::IndexIterator) {});
+
+	EXPECT_EQ(3u, matEmpty.Rows());
+	EXPECT_EQ(4u, matEmpty.Cols());
+	EXPECT_EQ(0u, matEmpty.NumberOfNonZeros());
+	EXPECT_EQ(0.0, matEmpty(2, 3));
+}
+
+TEST(MatrixCSR, ParallelForEachRowBlock)
+{
+	// Rows with very different lengths
+	const size_t n = 257;
+	MatrixCSRD mat(n, n,
+		[](size_t i) { return (i % 64 == 0) ? n : size_t(1); },
+		[](size_t i, MatrixCSRD::NonZeroIterator nonZeros, MatrixCSRD::IndexIterator columnIndices)
+	{
+		if (i % 64 == 0)
+		{
+			for (size_t j = 0; j < n; ++j)
+			{
+				nonZeros[j] = 1.0;
+				columnIndices[j] = j;
+			}
+		}
+		else
+		{
+			nonZeros[0] = 2.0;
+			columnIndices[0] = i;
+		}
+	});
+
+	std::vector<int> visited(n, 0);
+	mat.ParallelForEachRowBlock([&](size_t rowBegin, size_t rowEnd)
+	{
+		EXPECT_LT(rowBegin, rowEnd);
+
+		for (size_t i = rowBegin; i < rowEnd; ++i)
+		{
+			++visited[i];
+		}
+	});
+
+	for (size_t i = 0; i < n; ++i)
+	{
+		EXPECT_EQ(1, visited[i]);
+	}
+
+	// Row-blocked product should match the expression-based one
+	VectorND x(n);
+	for (size_t i = 0; i < n; ++i)
+	{
+		x[i] = static_cast<double>(i) - 100.0;
+	}
+
+	const VectorND ans = mat * x;
+	VectorND result(n);
+
+	mat.ParallelForEachRowBlock([&](size_t rowBegin, size_t rowEnd)
+	{
+		for (size_t i = rowBegin; i < rowEnd; ++i)
+		{
+			double sum = 0.0;
+
+			for (size_t jj = mat.RowPointer(i); jj < mat.RowPointer(i + 1); ++jj)
+			{
+				sum += mat.NonZero(jj) * x[mat.ColumnIndex(jj)];
+			}
+
+			result[i] = sum;
+		}
+	});
+
+	for (size_t i = 0; i < n; ++i)
+	{
+		EXPECT_DOUBLE_EQ(ans[i], result[i]);
+	}
+
+	const MatrixCSRD matEmpty;
+	matEmpty.ParallelForEachRowBlock([&](size_t, size_t)
+	{
+		ADD_FAILURE();
+	});
+}
+
 TEST(MatrixCSR, OperatorOverloadings)
 {
 	const MatrixCSRD matA = { { 1.0, 2.0, 3.0 }, { 4.0, 5.0, 6.0 } };
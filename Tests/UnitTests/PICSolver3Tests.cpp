@@ -1,6 +1,8 @@
 #include "pch.h"
 
+#include <Core/Geometry/Box3.h>
 #include <Core/Solver/Hybrid/PIC/PICSolver3.h>
+#include <Core/Surface/SurfaceToImplicit3.h>
 
 using namespace CubbyFlow;
 
@@ -12,4 +14,31 @@ TEST(PICSolver3, UpdateEmpty)
 	{
 		solver.Update(frame);
 	}
-}
\ No newline at end of file
+}
+
+TEST(PICSolver3, RemoveParticles)
+{
+	PICSolver3 solver({ 8, 8, 8 }, { 0.125, 0.125, 0.125 }, { 0, 0, 0 });
+	solver.SetClosedDomainBoundaryFlag(DIRECTION_ALL & ~DIRECTION_DOWN);
+	solver.SetIsRemovingParticlesOutOfDomain(true);
+	EXPECT_TRUE(solver.GetIsRemovingParticlesOutOfDomain());
+
+	auto killVolume = std::make_shared<SurfaceToImplicit3>(
+		std::make_shared<Box3>(Vector3D(0.75, 0.5, 0.0), Vector3D(1.0, 1.0, 1.0)));
+	solver.SetKillVolume(killVolume);
+	EXPECT_EQ(killVolume, solver.GetKillVolume());
+
+	// Particles falling through the open bottom, inside the kill volume, and
+	// inside the domain
+	auto particles = solver.GetParticleSystemData();
+	particles->AddParticles(Array1<Vector3D>({
+		Vector3D(0.5, 0.001, 0.5),
+		Vector3D(0.9, 0.9, 0.5),
+		Vector3D(0.25, 0.75, 0.5) }));
+
+	solver.Update(Frame(0, 1.0 / 60.0));
+	solver.Update(Frame(1, 1.0 / 60.0));
+
+	ASSERT_EQ(1u, particles->GetNumberOfParticles());
+	EXPECT_NEAR(0.25, particles->GetPositions()[0].x, 1e-3);
+}
@@ -4,6 +4,10 @@
 #include <Core/Array/Array3.h>
 #include <Core/Utils/Parallel.h>
 
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <limits>
 #include <numeric>
 #include <random>
 
@@ -182,6 +186,61 @@ TEST(Parallel, RangeFor3D)
 	});
 }
 
+TEST(Parallel, For3DTiles)
+{
+	size_t oldTileSizeX, oldTileSizeY, oldTileSizeZ;
+	GetParallelForTileSize(&oldTileSizeX, &oldTileSizeY, &oldTileSizeZ);
+
+	// Tile sizes that do not divide the flat domain evenly
+	SetParallelForTileSize(7, 3, 0);
+
+	size_t tileSizeX, tileSizeY, tileSizeZ;
+	GetParallelForTileSize(&tileSizeX, &tileSizeY, &tileSizeZ);
+	EXPECT_EQ(7u, tileSizeX);
+	EXPECT_EQ(3u, tileSizeY);
+	EXPECT_EQ(1u, tileSizeZ);
+
+	Array3<int> visits(33, 17, 2, 0);
+
+	ParallelFor(
+		ZERO_SIZE, visits.Width(),
+		ZERO_SIZE, visits.Height(),
+		ZERO_SIZE, visits.Depth(),
+		[&](size_t i, size_t j, size_t k)
+	{
+		++visits(i, j, k);
+	});
+
+	ParallelRangeFor(
+		ZERO_SIZE, visits.Width(),
+		ZERO_SIZE, visits.Height(),
+		ZERO_SIZE, visits.Depth(),
+		[&](size_t iBegin, size_t iEnd, size_t jBegin, size_t jEnd, size_t kBegin, size_t kEnd)
+	{
+		EXPECT_LE(iEnd - iBegin, 7u);
+		EXPECT_LE(jEnd - jBegin, 3u);
+		EXPECT_EQ(1u, kEnd - kBegin);
+
+		for (size_t k = kBegin; k < kEnd; ++k)
+		{
+			for (size_t j = jBegin; j < jEnd; ++j)
+			{
+				for (size_t i = iBegin; i < iEnd; ++i)
+				{
+					++visits(i, j, k);
+				}
+			}
+		}
+	});
+
+	visits.ForEach([](int v)
+	{
+		EXPECT_EQ(2, v);
+	});
+
+	SetParallelForTileSize(oldTileSizeX, oldTileSizeY, oldTileSizeZ);
+}
+
 TEST(Parallel, Sort)
 {
 	size_t N = std::max(20u, (3 * NUM_CORES) / 2);
@@ -234,6 +293,20 @@ TEST(Parallel, Sort)
 	}
 }
 
+TEST(Parallel, Async)
+{
+	// Every tasking backend returns a valid future that holds the result
+	auto value = Internal::Async([]() { return 42; });
+	ASSERT_TRUE(value.valid());
+	EXPECT_EQ(42, value.get());
+
+	int result = 0;
+	auto task = Internal::Async([&result]() { result = 7; });
+	ASSERT_TRUE(task.valid());
+	task.wait();
+	EXPECT_EQ(7, result);
+}
+
 TEST(Parallel, Reduce)
 {
 	size_t N = std::max(20u, (3 * NUM_CORES) / 2);
@@ -262,4 +335,261 @@ TEST(Parallel, Reduce)
 
 	int expected = std::accumulate(a.begin(), a.end(), 0);
 	EXPECT_EQ(expected, sum);
-}
\ No newline at end of file
+}
+
+TEST(Parallel, CountingSort)
+{
+	const size_t numberOfKeys = 7;
+	size_t N = std::max(200u, 50 * NUM_CORES);
+	std::vector<size_t> keys(N);
+
+	std::mt19937 rng;
+	std::uniform_int_distribution<size_t> d(0, numberOfKeys - 1);
+
+	for (size_t i = 0; i < N; ++i)
+	{
+		keys[i] = d(rng);
+	}
+
+	// Key 3 is left empty
+	std::replace(keys.begin(), keys.end(), static_cast<size_t>(3), static_cast<size_t>(4));
+
+	std::vector<size_t> offsets(numberOfKeys + 1);
+	std::vector<size_t> sortedIndices(N);
+
+	ParallelCountingSort(keys.begin(), keys.end(), numberOfKeys, offsets.begin(), sortedIndices.begin());
+
+	EXPECT_EQ(0u, offsets[0]);
+	EXPECT_EQ(N, offsets[numberOfKeys]);
+	EXPECT_EQ(offsets[3], offsets[4]);
+
+	for (size_t k = 0; k < numberOfKeys; ++k)
+	{
+		EXPECT_EQ(static_cast<size_t>(std::count(keys.begin(), keys.end(), k)), offsets[k + 1] - offsets[k]);
+
+		for (size_t j = offsets[k]; j < offsets[k + 1]; ++j)
+		{
+			EXPECT_EQ(k, keys[sortedIndices[j]]);
+
+			// Stable within each key
+			if (j > offsets[k])
+			{
+				EXPECT_LT(sortedIndices[j - 1], sortedIndices[j]);
+			}
+		}
+	}
+
+	std::vector<size_t> serialOffsets(numberOfKeys + 1);
+	std::vector<size_t> serialSortedIndices(N);
+
+	ParallelCountingSort(keys.begin(), keys.end(), numberOfKeys,
+		serialOffsets.begin(), serialSortedIndices.begin(), ExecutionPolicy::Serial);
+
+	EXPECT_EQ(offsets, serialOffsets);
+	EXPECT_EQ(sortedIndices, serialSortedIndices);
+}
+
+TEST(Parallel, RadixSort)
+{
+	size_t N = std::max(5000u, 300 * NUM_CORES);
+	std::vector<size_t> a(N);
+	std::vector<uint32_t> b(N);
+
+	std::mt19937 rng;
+	std::uniform_int_distribution<size_t> d(0, std::numeric_limits<size_t>::max());
+
+	for (size_t i = 0; i < N; ++i)
+	{
+		a[i] = d(rng);
+		b[i] = static_cast<uint32_t>(a[i] % 1000);
+	}
+
+	std::vector<size_t> expectedA = a;
+	std::vector<uint32_t> expectedB = b;
+	std::sort(expectedA.begin(), expectedA.end());
+	std::sort(expectedB.begin(), expectedB.end());
+
+	ParallelRadixSort(a.begin(), a.end());
+	EXPECT_EQ(expectedA, a);
+
+	// Keys below 2^16 only take two passes
+	ParallelRadixSort(b.begin(), b.end(), ExecutionPolicy::Serial);
+	EXPECT_EQ(expectedB, b);
+
+	// Unsigned integers take the radix sort in ParallelSort
+	std::shuffle(a.begin(), a.end(), rng);
+	ParallelSort(a.begin(), a.end());
+	EXPECT_EQ(expectedA, a);
+}
+
+TEST(Parallel, SortByKey)
+{
+	size_t N = std::max(5000u, 300 * NUM_CORES);
+	std::vector<uint32_t> keys(N);
+	std::vector<size_t> values(N);
+
+	std::mt19937 rng;
+	std::uniform_int_distribution<uint32_t> d(0, 70000);
+
+	for (size_t i = 0; i < N; ++i)
+	{
+		keys[i] = d(rng);
+		values[i] = i;
+	}
+
+	const std::vector<uint32_t> originalKeys = keys;
+
+	ParallelSortByKey(keys.begin(), keys.end(), values.begin());
+
+	for (size_t i = 0; i < N; ++i)
+	{
+		EXPECT_EQ(originalKeys[values[i]], keys[i]);
+
+		if (i > 0)
+		{
+			EXPECT_LE(keys[i - 1], keys[i]);
+
+			// Stable for the same keys
+			if (keys[i - 1] == keys[i])
+			{
+				EXPECT_LT(values[i - 1], values[i]);
+			}
+		}
+	}
+}
+
+TEST(Parallel, Scan)
+{
+	size_t N = std::max(5000u, 2000 * NUM_CORES);
+	std::vector<int> a(N);
+
+	std::mt19937 rng;
+	std::uniform_int_distribution<> d(0, 100);
+
+	for (size_t i = 0; i < N; ++i)
+	{
+		a[i] = d(rng);
+	}
+
+	std::vector<int> expectedInclusive(N);
+	std::partial_sum(a.begin(), a.end(), expectedInclusive.begin());
+
+	std::vector<int> inclusive(N);
+	int sum = ParallelInclusiveScan(a.begin(), a.end(), inclusive.begin(), 0, std::plus<int>());
+	EXPECT_EQ(expectedInclusive, inclusive);
+	EXPECT_EQ(expectedInclusive.back(), sum);
+
+	// In place
+	std::vector<int> exclusive = a;
+	sum = ParallelExclusiveScan(exclusive.begin(), exclusive.end(), exclusive.begin(), 0, std::plus<int>());
+	EXPECT_EQ(expectedInclusive.back(), sum);
+	EXPECT_EQ(0, exclusive[0]);
+
+	for (size_t i = 1; i < N; ++i)
+	{
+		EXPECT_EQ(expectedInclusive[i - 1], exclusive[i]);
+	}
+
+	std::vector<int> serial(N);
+	ParallelInclusiveScan(a.begin(), a.end(), serial.begin(), 0, std::plus<int>(), ExecutionPolicy::Serial);
+	EXPECT_EQ(expectedInclusive, serial);
+
+	// Any associative operator
+	std::vector<int> maxScan(N);
+	ParallelInclusiveScan(a.begin(), a.end(), maxScan.begin(), 0, [](int x, int y)
+	{
+		return std::max(x, y);
+	});
+
+	int expectedMax = 0;
+	for (size_t i = 0; i < N; ++i)
+	{
+		expectedMax = std::max(expectedMax, a[i]);
+		EXPECT_EQ(expectedMax, maxScan[i]);
+	}
+
+	std::vector<int> empty;
+	EXPECT_EQ(7, ParallelExclusiveScan(empty.begin(), empty.end(), empty.begin(), 7, std::plus<int>()));
+}
+
+TEST(Parallel, CompactAndPartition)
+{
+	size_t N = std::max(5000u, 2000 * NUM_CORES);
+	std::vector<int> a(N);
+
+	std::mt19937 rng;
+	std::uniform_int_distribution<> d(0, 100);
+
+	for (size_t i = 0; i < N; ++i)
+	{
+		a[i] = d(rng);
+	}
+
+	auto isEven = [](int x)
+	{
+		return x % 2 == 0;
+	};
+
+	std::vector<int> expected;
+	std::copy_if(a.begin(), a.end(), std::back_inserter(expected), isEven);
+
+	std::vector<int> compacted(N);
+	const size_t numberOfEven = ParallelCompact(a.begin(), a.end(), compacted.begin(), isEven);
+	EXPECT_EQ(expected.size(), numberOfEven);
+	compacted.resize(numberOfEven);
+	EXPECT_EQ(expected, compacted);
+
+	std::vector<int> expectedPartition = a;
+	std::stable_partition(expectedPartition.begin(), expectedPartition.end(), isEven);
+
+	std::vector<int> partitioned = a;
+	EXPECT_EQ(numberOfEven, ParallelPartition(partitioned.begin(), partitioned.end(), isEven));
+	EXPECT_EQ(expectedPartition, partitioned);
+
+	partitioned = a;
+	EXPECT_EQ(numberOfEven, ParallelPartition(partitioned.begin(), partitioned.end(), isEven, ExecutionPolicy::Serial));
+	EXPECT_EQ(expectedPartition, partitioned);
+}
+
+TEST(Parallel, Executor)
+{
+	const unsigned int globalNumThreads = GetMaxNumberOfThreads();
+	EXPECT_EQ(nullptr, ParallelExecutor::GetCurrent());
+
+	ParallelExecutor executor(3);
+	EXPECT_EQ(3u, executor.GetNumberOfThreads());
+	EXPECT_EQ(1u, ParallelExecutor(0).GetNumberOfThreads());
+
+	executor.Execute([&]()
+	{
+		EXPECT_EQ(&executor, ParallelExecutor::GetCurrent());
+		EXPECT_EQ(3u, GetMaxNumberOfThreads());
+
+		// The worker threads inherit the executor
+		const unsigned int maxNumThreads = ParallelReduce(ZERO_SIZE, ZERO_SIZE + 1000, 0u,
+			[](size_t begin, size_t end, unsigned int init)
+		{
+			for (size_t i = begin; i < end; ++i)
+			{
+				init = std::max(init, GetMaxNumberOfThreads());
+			}
+
+			return init;
+		}, [](unsigned int a, unsigned int b)
+		{
+			return std::max(a, b);
+		});
+		EXPECT_EQ(3u, maxNumThreads);
+
+		ParallelExecutor inner(2);
+		inner.Execute([]()
+		{
+			EXPECT_EQ(2u, GetMaxNumberOfThreads());
+		});
+
+		EXPECT_EQ(3u, GetMaxNumberOfThreads());
+	});
+
+	EXPECT_EQ(nullptr, ParallelExecutor::GetCurrent());
+	EXPECT_EQ(globalNumThreads, GetMaxNumberOfThreads());
+}
@@ -256,6 +256,92 @@ TEST(ParticleSystemData3, BuildNeighborLists)
 	}
 }
 
+TEST(ParticleSystemData3, RemoveParticles)
+{
+	ParticleSystemData3 particleSystem;
+	const size_t scalarIdx = particleSystem.AddScalarData();
+	const size_t vectorIdx = particleSystem.AddVectorData();
+
+	ParticleSystemData3::VectorData positions;
+	for (size_t i = 0; i < 100; ++i)
+	{
+		positions.Append(Vector3D(0.01 * i, 0.0, 0.0));
+	}
+	particleSystem.AddParticles(positions);
+
+	auto scalars = particleSystem.ScalarDataAt(scalarIdx);
+	auto vectors = particleSystem.VectorDataAt(vectorIdx);
+	for (size_t i = 0; i < 100; ++i)
+	{
+		scalars[i] = static_cast<double>(i);
+		vectors[i] = Vector3D(0.0, static_cast<double>(i), 0.0);
+	}
+
+	const double radius = 0.025;
+	particleSystem.BuildNeighborSearcher(radius);
+	particleSystem.BuildNeighborLists(radius);
+
+	// Remove every other particle
+	Array1<char> shouldRemove(100);
+	for (size_t i = 0; i < 100; ++i)
+	{
+		shouldRemove[i] = (i % 2 == 1) ? 1 : 0;
+	}
+
+	EXPECT_EQ(50u, particleSystem.RemoveParticles(shouldRemove.ConstAccessor()));
+	ASSERT_EQ(50u, particleSystem.GetNumberOfParticles());
+
+	auto newPositions = particleSystem.GetPositions();
+	scalars = particleSystem.ScalarDataAt(scalarIdx);
+	vectors = particleSystem.VectorDataAt(vectorIdx);
+	for (size_t i = 0; i < 50; ++i)
+	{
+		EXPECT_DOUBLE_EQ(0.02 * i, newPositions[i].x);
+		EXPECT_DOUBLE_EQ(2.0 * i, scalars[i]);
+		EXPECT_DOUBLE_EQ(2.0 * i, vectors[i].y);
+	}
+
+	// Neighbor lists only keep the remaining neighbors with the new indices
+	const auto& neighborLists = particleSystem.GetNeighborLists();
+	ASSERT_EQ(50u, neighborLists.size());
+	for (size_t i = 0; i < 50; ++i)
+	{
+		std::vector<size_t> neighbors = neighborLists[i];
+		std::sort(neighbors.begin(), neighbors.end());
+
+		std::vector<size_t> expected;
+		if (i > 0)
+		{
+			expected.push_back(i - 1);
+		}
+		if (i + 1 < 50)
+		{
+			expected.push_back(i + 1);
+		}
+
+		EXPECT_EQ(expected, neighbors);
+	}
+
+	// The searcher is rebuilt with the remaining particles
+	std::vector<size_t> found;
+	particleSystem.GetNeighborSearcher()->ForEachNearbyPoint(Vector3D(0.5, 0.0, 0.0), 0.015, [&](size_t j, const Vector3D&)
+	{
+		found.push_back(j);
+	});
+	EXPECT_EQ(std::vector<size_t>{ 25 }, found);
+
+	// Predicate version
+	EXPECT_EQ(25u, particleSystem.RemoveParticles([&](size_t i)
+	{
+		return newPositions[i].x >= 0.5;
+	}));
+	EXPECT_EQ(25u, particleSystem.GetNumberOfParticles());
+	EXPECT_EQ(0u, particleSystem.RemoveParticles([](size_t)
+	{
+		return false;
+	}));
+}
+
 TEST(ParticleSystemData3, Serialization)
 {
 	ParticleSystemData3 particleSystem;
@@ -1,7 +1,9 @@
 #include "pch.h"
 
+#include <Core/Geometry/Plane3.h>
 #include <Core/Solver/Particle/ParticleSystemSolver2.h>
 #include <Core/Solver/Particle/ParticleSystemSolver3.h>
+#include <Core/Surface/SurfaceToImplicit3.h>
 
 using namespace CubbyFlow;
 
@@ -123,4 +125,32 @@ TEST(ParticleSystemSolver3, Update)
 		EXPECT_NE(0, data->GetVelocities()[i].y);
 		EXPECT_DOUBLE_EQ(0.0, data->GetVelocities()[i].z);
 	}
-}
\ No newline at end of file
+}
+
+TEST(ParticleSystemSolver3, KillVolume)
+{
+	ParticleSystemSolver3 solver;
+	solver.SetGravity(Vector3D(0, -10, 0));
+
+	// Everything below y = 0 is removed
+	auto killVolume = std::make_shared<SurfaceToImplicit3>(
+		std::make_shared<Plane3>(Vector3D(0, 1, 0), Vector3D(0, 0, 0)));
+	solver.SetKillVolume(killVolume);
+	EXPECT_EQ(killVolume, solver.GetKillVolume());
+
+	ParticleSystemData3Ptr data = solver.GetParticleSystemData();
+	ParticleSystemData3::VectorData positions;
+	positions.Append(Vector3D(0, 1, 0));
+	positions.Append(Vector3D(1, 1e-4, 0));
+	positions.Append(Vector3D(2, 1, 0));
+	data->AddParticles(positions.Accessor());
+
+	for (Frame frame(0, 1.0 / 60.0); frame.index < 3; ++frame)
+	{
+		solver.Update(frame);
+	}
+
+	ASSERT_EQ(2u, data->GetNumberOfParticles());
+	EXPECT_DOUBLE_EQ(0.0, data->GetPositions()[0].x);
+	EXPECT_DOUBLE_EQ(2.0, data->GetPositions()[1].x);
+}
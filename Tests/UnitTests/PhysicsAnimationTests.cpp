@@ -0,0 +1,160 @@
+#include "pch.h"
+
+#include <Core/Animation/PhysicsAnimation.h>
+#include <Core/Utils/Timer.h>
+
+#include <cmath>
+#include <limits>
+
+using namespace CubbyFlow;
+
+namespace
+{
+	class CustomPhysicsAnimation final : public PhysicsAnimation
+	{
+	public:
+		double targetTimeInterval = 1.0 / 600.0;
+		double stepDelayInSeconds = 0.0;
+		double estimationDelayInSeconds = 0.0;
+		size_t numberOfSteps = 0;
+		unsigned int numberOfThreadsInLastStep = 0;
+
+	protected:
+		void OnAdvanceTimeStep(double timeIntervalInSeconds) override
+		{
+			EXPECT_GT(timeIntervalInSeconds, 0.0);
+
+			Wait(stepDelayInSeconds);
+			++numberOfSteps;
+			numberOfThreadsInLastStep = GetMaxNumberOfThreads();
+		}
+
+		unsigned int GetNumberOfSubTimeSteps(double timeIntervalInSeconds) const override
+		{
+			Wait(estimationDelayInSeconds);
+
+			return static_cast<unsigned int>(std::ceil(timeIntervalInSeconds / targetTimeInterval - 1e-9));
+		}
+
+	private:
+		static void Wait(double seconds)
+		{
+			Timer timer;
+			while (timer.DurationInSeconds() < seconds)
+			{
+				// Busy wait to emulate the cost
+			}
+		}
+	};
+}
+
+TEST(PhysicsAnimation, FixedSubTimeStepStatistics)
+{
+	CustomPhysicsAnimation anim;
+	anim.SetIsUsingFixedSubTimeSteps(true);
+	anim.SetNumberOfFixedSubTimeSteps(3);
+
+	for (Frame frame(0, 1.0 / 60.0); frame.index < 4; ++frame)
+	{
+		anim.Update(frame);
+	}
+
+	const SubTimeStepStatistics& stats = anim.GetSubTimeStepStatistics();
+	EXPECT_EQ(4u, stats.numberOfFrames);
+	EXPECT_EQ(12u, stats.numberOfSubTimeSteps);
+	EXPECT_EQ(3u, stats.numberOfSubTimeStepsInLastFrame);
+	EXPECT_EQ(3u, stats.maxNumberOfSubTimeStepsPerFrame);
+	EXPECT_EQ(0u, stats.numberOfEstimations);
+	EXPECT_EQ(12u, anim.numberOfSteps);
+
+	anim.ResetSubTimeStepStatistics();
+	EXPECT_EQ(0u, anim.GetSubTimeStepStatistics().numberOfFrames);
+	EXPECT_EQ(0u, anim.GetSubTimeStepStatistics().numberOfSubTimeSteps);
+}
+
+TEST(PhysicsAnimation, AdaptiveSubTimeSteps)
+{
+	CustomPhysicsAnimation anim;
+	anim.SetIsUsingFixedSubTimeSteps(false);
+
+	// Estimation is cheap, so it is evaluated for every sub-timestep.
+	anim.Update(Frame(0, 1.0 / 60.0));
+
+	const SubTimeStepStatistics& stats = anim.GetSubTimeStepStatistics();
+	EXPECT_EQ(10u, stats.numberOfSubTimeSteps);
+	EXPECT_EQ(10u, stats.numberOfEstimations);
+	EXPECT_NEAR(0.0, anim.GetCurrentTimeInSeconds(), 1e-12);
+
+	// Calm motion requires fewer sub-timesteps, but the sub-timestep grows by
+	// at most twice per sub-timestep.
+	anim.targetTimeInterval = 1.0 / 120.0;
+	anim.Update(Frame(1, 1.0 / 60.0));
+
+	EXPECT_EQ(13u, stats.numberOfSubTimeSteps);
+	EXPECT_EQ(3u, stats.numberOfSubTimeStepsInLastFrame);
+	EXPECT_EQ(10u, stats.maxNumberOfSubTimeStepsPerFrame);
+	EXPECT_NEAR(1.0 / 60.0, anim.GetCurrentTimeInSeconds(), 1e-12);
+
+	anim.Update(Frame(2, 1.0 / 60.0));
+
+	EXPECT_EQ(15u, stats.numberOfSubTimeSteps);
+	EXPECT_EQ(2u, stats.numberOfSubTimeStepsInLastFrame);
+	EXPECT_NEAR(2.0 / 60.0, anim.GetCurrentTimeInSeconds(), 1e-12);
+}
+
+TEST(PhysicsAnimation, AdaptiveSubTimeStepGrowth)
+{
+	CustomPhysicsAnimation anim;
+	anim.SetIsUsingFixedSubTimeSteps(false);
+	EXPECT_DOUBLE_EQ(2.0, anim.GetMaxSubTimeStepGrowth());
+
+	anim.SetMaxSubTimeStepGrowth(0.5);
+	EXPECT_DOUBLE_EQ(1.0, anim.GetMaxSubTimeStepGrowth());
+
+	// Without a growth limit the estimation is taken as is.
+	anim.SetMaxSubTimeStepGrowth(std::numeric_limits<double>::max());
+	anim.Update(Frame(0, 1.0 / 60.0));
+
+	anim.targetTimeInterval = 1.0 / 120.0;
+	anim.Update(Frame(1, 1.0 / 60.0));
+
+	const SubTimeStepStatistics& stats = anim.GetSubTimeStepStatistics();
+	EXPECT_EQ(12u, stats.numberOfSubTimeSteps);
+	EXPECT_EQ(2u, stats.numberOfSubTimeStepsInLastFrame);
+}
+
+TEST(PhysicsAnimation, AdaptiveSubTimeStepsReestimateEveryStep)
+{
+	CustomPhysicsAnimation anim;
+	anim.SetIsUsingFixedSubTimeSteps(false);
+	anim.stepDelayInSeconds = 1e-4;
+	anim.estimationDelayInSeconds = 1e-3;
+
+	anim.Update(Frame(0, 1.0 / 60.0));
+
+	// Even an expensive estimation is evaluated before every sub-timestep, so
+	// the result does not depend on the timings.
+	const SubTimeStepStatistics& stats = anim.GetSubTimeStepStatistics();
+	EXPECT_EQ(10u, stats.numberOfSubTimeSteps);
+	EXPECT_EQ(10u, stats.numberOfEstimations);
+	EXPECT_LT(0.0, stats.estimationTimeInSeconds);
+	EXPECT_LT(0.0, stats.stepTimeInSeconds);
+	EXPECT_NEAR(0.0, anim.GetCurrentTimeInSeconds(), 1e-12);
+}
+
+TEST(PhysicsAnimation, Executor)
+{
+	CustomPhysicsAnimation anim;
+	EXPECT_EQ(nullptr, anim.GetExecutor());
+
+	anim.AdvanceSingleFrame();
+	EXPECT_EQ(GetMaxNumberOfThreads(), anim.numberOfThreadsInLastStep);
+
+	const auto executor = std::make_shared<ParallelExecutor>(3);
+	anim.SetExecutor(executor);
+	EXPECT_EQ(executor, anim.GetExecutor());
+
+	anim.AdvanceSingleFrame();
+	EXPECT_EQ(3u, anim.numberOfThreadsInLastStep);
+	EXPECT_EQ(nullptr, ParallelExecutor::GetCurrent());
+}
@@ -69,4 +69,129 @@ TEST(PointHashGridSearcher2, Build)
 	EXPECT_EQ(4, searcher.GetHashKeyFromBucketIndex(Point2I(0, 1)));
 	EXPECT_EQ(8, searcher.GetHashKeyFromBucketIndex(Point2I(0, 2)));
 	EXPECT_EQ(3, searcher.GetHashKeyFromBucketIndex(Point2I(-1, 0)));
-}
\ No newline at end of file
+}
+
+TEST(PointHashGridSearcher2, BucketStarts)
+{
+	Array1<Vector2D> points =
+	{
+		Vector2D(3, 4),
+		Vector2D(1, 5),
+		Vector2D(-3, 0)
+	};
+
+	PointHashGridSearcher2 searcher(4, 4, std::sqrt(10));
+	EXPECT_TRUE(searcher.GetBucketStarts().empty());
+	EXPECT_TRUE(searcher.GetSortedIndices().empty());
+
+	searcher.Build(points.Accessor());
+
+	const auto& bucketStarts = searcher.GetBucketStarts();
+	const auto& sortedIndices = searcher.GetSortedIndices();
+	const auto buckets = searcher.GetBuckets();
+	ASSERT_EQ(16u + 1, bucketStarts.size());
+	EXPECT_EQ(points.size(), bucketStarts.back());
+	EXPECT_EQ(points.size(), sortedIndices.size());
+
+	for (size_t key = 0; key < buckets.size(); ++key)
+	{
+		const std::vector<size_t> bucket(sortedIndices.begin() + bucketStarts[key], sortedIndices.begin() + bucketStarts[key + 1]);
+		EXPECT_EQ(buckets[key], bucket);
+	}
+}
+
+TEST(PointHashGridSearcher2, Add)
+{
+	Array1<Vector2D> points;
+	for (size_t i = 0; i < 200; ++i)
+	{
+		points.Append(Vector2D(std::sin(1.3 * i), std::cos(0.7 * i)));
+	}
+
+	Array1<Vector2D> builtPoints(150);
+	for (size_t i = 0; i < builtPoints.size(); ++i)
+	{
+		builtPoints[i] = points[i];
+	}
+
+	PointHashGridSearcher2 searcher(Size2(4, 4), 0.5);
+	searcher.Build(builtPoints.Accessor());
+
+	for (size_t i = builtPoints.size(); i < points.size(); ++i)
+	{
+		searcher.Add(points[i]);
+	}
+
+	const Vector2D origin(0.1, -0.2);
+	const double radius = 0.25;
+
+	std::vector<bool> isFound(points.size(), false);
+	searcher.ForEachNearbyPoint(origin, radius, [&](size_t i, const Vector2D& pt)
+	{
+		EXPECT_EQ(points[i], pt);
+		EXPECT_FALSE(isFound[i]);
+		isFound[i] = true;
+	});
+
+	for (size_t i = 0; i < points.size(); ++i)
+	{
+		EXPECT_EQ(points[i].DistanceTo(origin) <= radius, isFound[i]) << i;
+	}
+
+	// Each point is in the bucket of its position, in insertion order
+	const auto buckets = searcher.GetBuckets();
+	EXPECT_EQ(16u, buckets.size());
+
+	size_t numberOfPoints = 0;
+	for (size_t key = 0; key < buckets.size(); ++key)
+	{
+		for (size_t j = 0; j < buckets[key].size(); ++j)
+		{
+			const size_t i = buckets[key][j];
+			EXPECT_EQ(key, searcher.GetHashKeyFromBucketIndex(searcher.GetBucketIndex(points[i])));
+
+			if (j > 0)
+			{
+				EXPECT_LT(buckets[key][j - 1], i);
+			}
+		}
+
+		numberOfPoints += buckets[key].size();
+	}
+
+	EXPECT_EQ(points.size(), numberOfPoints);
+}
+
+TEST(PointHashGridSearcher2, Serialization)
+{
+	Array1<Vector2D> points =
+	{
+		Vector2D(0, 1),
+		Vector2D(2, 5),
+		Vector2D(-1, 3)
+	};
+
+	Array1<Vector2D> builtPoints = { points[0], points[1] };
+
+	PointHashGridSearcher2 searcher(4, 4, std::sqrt(10));
+	searcher.Build(builtPoints.Accessor());
+	searcher.Add(points[2]);
+
+	std::vector<uint8_t> buffer;
+	searcher.Serialize(&buffer);
+
+	PointHashGridSearcher2 searcher2(1, 1, 1.0);
+	searcher2.Deserialize(buffer);
+
+	int cnt = 0;
+	searcher2.ForEachNearbyPoint(
+		Vector2D(0, 0), std::sqrt(10.0),
+		[&](size_t i, const Vector2D& pt)
+	{
+		EXPECT_TRUE(i == 0 || i == 2);
+		EXPECT_EQ(points[i], pt);
+		++cnt;
+	});
+
+	EXPECT_EQ(2, cnt);
+}
@@ -2,6 +2,7 @@
 
 #include <Core/Collider/RigidBodyCollider3.h>
 #include <Core/Geometry/Plane3.h>
+#include <Core/Geometry/Sphere3.h>
 
 using namespace CubbyFlow;
 
@@ -115,4 +116,57 @@ TEST(RigidBodyCollider3, VelocityAt)
 	EXPECT_DOUBLE_EQ(-35.0, result.x);
 	EXPECT_DOUBLE_EQ(27.0, result.y);
 	EXPECT_DOUBLE_EQ(-2.0, result.z);
-}
\ No newline at end of file
+}
+TEST(RigidBodyCollider3, LocalSDF)
+{
+	// Unbounded surfaces are not cached
+	{
+		RigidBodyCollider3 collider(std::make_shared<Plane3>(Vector3D(0, 1, 0), Vector3D(0, 0, 0)));
+		collider.SetIsUsingSDFCache(true);
+
+		EXPECT_EQ(nullptr, collider.GetLocalSDF(Vector3D(0.1, 0.1, 0.1)));
+	}
+
+	{
+		auto sphere = std::make_shared<Sphere3>(Vector3D(0, 0, 0), 1.0);
+		sphere->transform = Transform3(Vector3D(3, 0, 0), QuaternionD(Vector3D(0, 1, 0), 0.5));
+		RigidBodyCollider3 collider(sphere);
+
+		EXPECT_EQ(nullptr, collider.GetLocalSDF(Vector3D(0.1, 0.1, 0.1)));
+
+		collider.SetIsUsingSDFCache(true);
+		auto sdf = collider.GetLocalSDF(Vector3D(0.1, 0.1, 0.1));
+		ASSERT_NE(nullptr, sdf);
+		EXPECT_EQ(sdf, collider.GetLocalSDF(Vector3D(0.1, 0.1, 0.1)));
+		EXPECT_NEAR(-0.5, sdf->Sample(Vector3D(0.5, 0, 0)), 1e-2);
+		EXPECT_NEAR(0.2, sdf->Sample(Vector3D(0, 1.2, 0)), 1e-2);
+		EXPECT_LT(0.0, collider.GetLocalSDFFarValue(Vector3D(10, 0, 0)));
+
+		// Moving the surface keeps the cache
+		sphere->transform.SetTranslation(Vector3D(0, 0, 0));
+		EXPECT_EQ(sdf, collider.GetLocalSDF(Vector3D(0.1, 0.1, 0.1)));
+
+		// Different spacing rebuilds the cache
+		EXPECT_NE(sdf, collider.GetLocalSDF(Vector3D(0.2, 0.2, 0.2)));
+	}
+
+	// The far field of a container is inside the collider
+	{
+		auto sphere = std::make_shared<Sphere3>(Vector3D(0, 0, 0), 1.0);
+		sphere->isNormalFlipped = true;
+		RigidBodyCollider3 collider(sphere);
+		collider.SetIsUsingSDFCache(true);
+
+		ASSERT_NE(nullptr, collider.GetLocalSDF(Vector3D(0.1, 0.1, 0.1)));
+		EXPECT_GT(0.0, collider.GetLocalSDFFarValue(Vector3D(10, 0, 0)));
+	}
+
+	// A spacing too fine to cache does not disable the cache for others
+	{
+		RigidBodyCollider3 collider(std::make_shared<Sphere3>(Vector3D(0, 0, 0), 1.0));
+		collider.SetIsUsingSDFCache(true);
+
+		EXPECT_EQ(nullptr, collider.GetLocalSDF(Vector3D(1e-4, 1e-4, 1e-4)));
+		EXPECT_NE(nullptr, collider.GetLocalSDF(Vector3D(0.1, 0.1, 0.1)));
+	}
+}
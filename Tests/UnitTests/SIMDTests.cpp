@@ -0,0 +1,83 @@
+#include "pch.h"
+
+#include <Core/Math/Quaternion.h>
+#include <Core/Math/SIMD.h>
+#include <Core/Matrix/Matrix3x3.h>
+#include <Core/Vector/Vector3.h>
+
+#include <random>
+
+using namespace CubbyFlow;
+
+namespace
+{
+	// Reference results computed in the same order as the scalar code
+	Vector3D ScalarMul(const Matrix3x3D& m, const Vector3D& v)
+	{
+		return Vector3D(
+			v.x * m(0, 0) + v.y * m(0, 1) + v.z * m(0, 2),
+			v.x * m(1, 0) + v.y * m(1, 1) + v.z * m(1, 2),
+			v.x * m(2, 0) + v.y * m(2, 1) + v.z * m(2, 2));
+	}
+}
+
+TEST(SIMD, VectorKernels)
+{
+	std::mt19937 rng(0);
+	std::uniform_real_distribution<> d(-10.0, 10.0);
+
+	for (int n = 0; n < 1000; ++n)
+	{
+		const Vector3D a(d(rng), d(rng), d(rng));
+		const Vector3D b(d(rng), d(rng), d(rng));
+
+		EXPECT_EQ(a.x * b.x + a.y * b.y + a.z * b.z, a.Dot(b));
+		EXPECT_EQ(a.x * b.x + a.y * b.y + a.z * b.z, SIMDDot3(&a.x, &b.x));
+	}
+}
+
+TEST(SIMD, MatrixKernels)
+{
+	std::mt19937 rng(0);
+	std::uniform_real_distribution<> d(-10.0, 10.0);
+
+	for (int n = 0; n < 1000; ++n)
+	{
+		const Matrix3x3D a(d(rng), d(rng), d(rng), d(rng), d(rng), d(rng), d(rng), d(rng), d(rng));
+		const Matrix3x3D b(d(rng), d(rng), d(rng), d(rng), d(rng), d(rng), d(rng), d(rng), d(rng));
+		const Vector3D v(d(rng), d(rng), d(rng));
+
+		const Vector3D av = a * v;
+		const Vector3D avAns = ScalarMul(a, v);
+		EXPECT_EQ(avAns.x, av.x);
+		EXPECT_EQ(avAns.y, av.y);
+		EXPECT_EQ(avAns.z, av.z);
+
+		const Matrix3x3D ab = a * b;
+		for (size_t i = 0; i < 3; ++i)
+		{
+			for (size_t j = 0; j < 3; ++j)
+			{
+				EXPECT_EQ(a(i, 0) * b(0, j) + a(i, 1) * b(1, j) + a(i, 2) * b(2, j), ab(i, j));
+			}
+		}
+	}
+}
+
+TEST(SIMD, QuaternionRotate)
+{
+	std::mt19937 rng(0);
+	std::uniform_real_distribution<> d(-1.0, 1.0);
+
+	for (int n = 0; n < 1000; ++n)
+	{
+		const QuaternionD q = QuaternionD(d(rng), d(rng), d(rng), d(rng)).Normalized();
+		const Vector3D v(d(rng), d(rng), d(rng));
+
+		const Vector3D rotated = q * v;
+		const Vector3D ans = ScalarMul(q.Matrix3(), v);
+		EXPECT_EQ(ans.x, rotated.x);
+		EXPECT_EQ(ans.y, rotated.y);
+		EXPECT_EQ(ans.z, rotated.z);
+	}
+}
@@ -2,6 +2,8 @@
 
 #include <Core/SPH/SPHSystemData2.h>
 
+#include <algorithm>
+
 using namespace CubbyFlow;
 
 TEST(SPHSystemData2, Parameters)
@@ -139,4 +141,69 @@ TEST(SPHSystemData2, Serialization)
 			EXPECT_EQ(neighbors[j], neighbors2[j]);
 		}
 	}
+}
+
+TEST(SPHSystemData2, NeighborListSkin)
+{
+	SPHSystemData2 data;
+	data.SetTargetSpacing(0.1);
+	const double kernelRadius = data.GetKernelRadius();
+
+	ParticleSystemData2::VectorData positions;
+	for (size_t j = 0; j < 12; ++j)
+	{
+		for (size_t i = 0; i < 12; ++i)
+		{
+			positions.Append(0.1 * Vector2D(static_cast<double>(i), static_cast<double>(j)));
+		}
+	}
+	data.AddParticles(positions);
+
+	data.SetNeighborListSkin(-1.0);
+	EXPECT_DOUBLE_EQ(0.0, data.GetNeighborListSkin());
+
+	// Without a skin the lists are rebuilt on every update
+	EXPECT_TRUE(data.UpdateNeighborLists());
+	EXPECT_TRUE(data.UpdateNeighborLists());
+
+	data.SetNeighborListSkin(0.5);
+	EXPECT_DOUBLE_EQ(0.5, data.GetNeighborListSkin());
+	EXPECT_TRUE(data.UpdateNeighborLists());
+	EXPECT_FALSE(data.UpdateNeighborLists());
+
+	// Move every particle less than half the skin
+	for (size_t i = 0; i < positions.size(); ++i)
+	{
+		const double sx = (i % 2 == 0) ? 1.0 : -1.0;
+		const double sy = (i % 3 == 0) ? 1.0 : -1.0;
+		positions[i] += 0.15 * kernelRadius * Vector2D(sx, sy);
+		data.GetPositions()[i] = positions[i];
+	}
+
+	EXPECT_FALSE(data.UpdateNeighborLists());
+	data.UpdateDensities();
+
+	SPHSystemData2 reference;
+	reference.SetTargetSpacing(0.1);
+	reference.AddParticles(positions);
+	reference.BuildNeighborSearcher();
+	reference.BuildNeighborLists();
+	reference.UpdateDensities();
+
+	const auto& lists = data.GetNeighborLists();
+	const auto& referenceLists = reference.GetNeighborLists();
+	for (size_t i = 0; i < positions.size(); ++i)
+	{
+		EXPECT_NEAR(reference.GetDensities()[i], data.GetDensities()[i], 1e-9 * reference.GetDensities()[i]);
+
+		for (size_t j : referenceLists[i])
+		{
+			EXPECT_NE(lists[i].end(), std::find(lists[i].begin(), lists[i].end(), j));
+		}
+	}
+
+	// Moving a particle further than half the skin triggers a rebuild
+	data.GetPositions()[0] += Vector2D(0.3 * kernelRadius, 0.0);
+	EXPECT_TRUE(data.UpdateNeighborLists());
+	EXPECT_FALSE(data.UpdateNeighborLists());
 }
\ No newline at end of file
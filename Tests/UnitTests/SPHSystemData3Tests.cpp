@@ -2,6 +2,8 @@
 
 #include <Core/SPH/SPHSystemData3.h>
 
+#include <algorithm>
+
 using namespace CubbyFlow;
 
 TEST(SPHSystemData3, Parameters)
@@ -140,4 +142,73 @@ TEST(SPHSystemData3, Serialization)
 			EXPECT_EQ(neighbors[j], neighbors2[j]);
 		}
 	}
+}
+
+TEST(SPHSystemData3, NeighborListSkin)
+{
+	SPHSystemData3 data;
+	data.SetTargetSpacing(0.1);
+	const double kernelRadius = data.GetKernelRadius();
+
+	ParticleSystemData3::VectorData positions;
+	for (size_t k = 0; k < 6; ++k)
+	{
+		for (size_t j = 0; j < 6; ++j)
+		{
+			for (size_t i = 0; i < 6; ++i)
+			{
+				positions.Append(0.1 * Vector3D(static_cast<double>(i), static_cast<double>(j), static_cast<double>(k)));
+			}
+		}
+	}
+	data.AddParticles(positions);
+
+	data.SetNeighborListSkin(-1.0);
+	EXPECT_DOUBLE_EQ(0.0, data.GetNeighborListSkin());
+
+	// Without a skin the lists are rebuilt on every update
+	EXPECT_TRUE(data.UpdateNeighborLists());
+	EXPECT_TRUE(data.UpdateNeighborLists());
+
+	data.SetNeighborListSkin(0.5);
+	EXPECT_DOUBLE_EQ(0.5, data.GetNeighborListSkin());
+	EXPECT_TRUE(data.UpdateNeighborLists());
+	EXPECT_FALSE(data.UpdateNeighborLists());
+
+	// Move every particle less than half the skin
+	for (size_t i = 0; i < positions.size(); ++i)
+	{
+		const double sx = (i % 2 == 0) ? 1.0 : -1.0;
+		const double sy = (i % 3 == 0) ? 1.0 : -1.0;
+		const double sz = (i % 5 == 0) ? 1.0 : -1.0;
+		positions[i] += 0.1 * kernelRadius * Vector3D(sx, sy, sz);
+		data.GetPositions()[i] = positions[i];
+	}
+
+	EXPECT_FALSE(data.UpdateNeighborLists());
+	data.UpdateDensities();
+
+	SPHSystemData3 reference;
+	reference.SetTargetSpacing(0.1);
+	reference.AddParticles(positions);
+	reference.BuildNeighborSearcher();
+	reference.BuildNeighborLists();
+	reference.UpdateDensities();
+
+	const auto& lists = data.GetNeighborLists();
+	const auto& referenceLists = reference.GetNeighborLists();
+	for (size_t i = 0; i < positions.size(); ++i)
+	{
+		EXPECT_NEAR(reference.GetDensities()[i], data.GetDensities()[i], 1e-9 * reference.GetDensities()[i]);
+
+		for (size_t j : referenceLists[i])
+		{
+			EXPECT_NE(lists[i].end(), std::find(lists[i].begin(), lists[i].end(), j));
+		}
+	}
+
+	// Moving a particle further than half the skin triggers a rebuild
+	data.GetPositions()[0] += Vector3D(0.3 * kernelRadius, 0.0, 0.0);
+	EXPECT_TRUE(data.UpdateNeighborLists());
+	EXPECT_FALSE(data.UpdateNeighborLists());
 }
\ No newline at end of file
@@ -2,6 +2,10 @@
 
 #include <Core/Math/SVD.h>
 
+#include <algorithm>
+#include <array>
+#include <vector>
+
 using namespace CubbyFlow;
 
 TEST(SVD, Float)
@@ -36,4 +40,66 @@ TEST(SVD, Double)
 
 	MatrixMxND aApprox = u * w2 * v.Transposed();
 	EXPECT_TRUE(a.IsSimilar(aApprox, 1e-12));
-}
\ No newline at end of file
+}
+TEST(SVD, SymmetricEigenDecomposition)
+{
+	const Matrix3x3D b(
+		1.0, 2.0, -0.5,
+		0.3, -1.0, 4.0,
+		2.0, 0.1, 0.7);
+	const std::vector<Matrix3x3D> mats =
+	{
+		// Covariance-like matrix
+		b * b.Transposed(),
+		// Indefinite matrix
+		Matrix3x3D(4.0, 1.0, -2.0, 1.0, -3.0, 0.5, -2.0, 0.5, 1.0),
+		// Already diagonal
+		Matrix3x3D::MakeScaleMatrix(3.0, -1.0, 2.0),
+		// Repeated eigenvalues
+		Matrix3x3D(2.0, 1.0, 1.0, 1.0, 2.0, 1.0, 1.0, 1.0, 2.0),
+		// Nearly degenerate
+		Matrix3x3D(1.0, 1e-9, 0.0, 1e-9, 1.0, 1e-12, 0.0, 1e-12, 1e-6),
+		// Zero
+		Matrix3x3D::MakeZero()
+	};
+
+	for (const auto& a : mats)
+	{
+		Vector3D d;
+		Matrix3x3D v;
+		SymmetricEigenDecomposition(a, d, v);
+
+		const Matrix3x3D aApprox = v * Matrix3x3D::MakeScaleMatrix(d) * v.Transposed();
+		EXPECT_TRUE(a.IsSimilar(aApprox, 1e-12));
+		EXPECT_TRUE((v * v.Transposed()).IsSimilar(Matrix3x3D::MakeIdentity(), 1e-12));
+	}
+
+	// Eigenvalues of a covariance matrix match its singular values
+	const Matrix3x3D cov = mats[0];
+	Vector3D d;
+	Matrix3x3D v;
+	SymmetricEigenDecomposition(cov, d, v);
+
+	Matrix3x3D u, w;
+	Vector3D s;
+	SVD(cov, u, s, w);
+
+	std::array<double, 3> eigenValues = { d.x, d.y, d.z };
+	std::array<double, 3> singularValues = { s.x, s.y, s.z };
+	std::sort(eigenValues.begin(), eigenValues.end());
+	std::sort(singularValues.begin(), singularValues.end());
+
+	for (size_t i = 0; i < 3; ++i)
+	{
+		EXPECT_NEAR(singularValues[i], eigenValues[i], 1e-12);
+	}
+
+	// Single precision
+	const Matrix3x3F af(2.0f, -1.0f, 0.0f, -1.0f, 2.0f, -1.0f, 0.0f, -1.0f, 2.0f);
+	Vector3F df;
+	Matrix3x3F vf;
+	SymmetricEigenDecomposition(af, df, vf);
+
+	const Matrix3x3F afApprox = vf * Matrix3x3F::MakeScaleMatrix(df) * vf.Transposed();
+	EXPECT_TRUE(af.IsSimilar(afApprox, 1e-5));
+}
@@ -0,0 +1,97 @@
+#include "pch.h"
+
+#include <Core/Field/CustomScalarField3.h>
+#include <Core/Field/CustomVectorField3.h>
+#include <Core/Grid/CellCenteredScalarGrid3.h>
+#include <Core/Grid/CellCenteredVectorGrid3.h>
+#include <Core/Grid/VertexCenteredScalarGrid3.h>
+#include <Core/SemiLagrangian/CubicSemiLagrangian3.h>
+
+using namespace CubbyFlow;
+
+namespace
+{
+	void TestMultipleScalarGrids(AdvectionSolver3* solver)
+	{
+		CustomVectorField3 flow([](const Vector3D& pt)
+		{
+			return Vector3D(-pt.y, pt.x, 0.5 * pt.z);
+		});
+		CustomScalarField3 boundarySDF([](const Vector3D& pt)
+		{
+			return (pt - Vector3D(0.5, 0.5, 0.5)).Length() - 0.1;
+		});
+
+		// Two grids with the same layout and one with a different layout
+		CellCenteredScalarGrid3 src0({ 16, 16, 16 }, { 1.0 / 16.0, 1.0 / 16.0, 1.0 / 16.0 });
+		CellCenteredScalarGrid3 src1({ 16, 16, 16 }, { 1.0 / 16.0, 1.0 / 16.0, 1.0 / 16.0 });
+		VertexCenteredScalarGrid3 src2({ 16, 16, 16 }, { 1.0 / 16.0, 1.0 / 16.0, 1.0 / 16.0 });
+		src0.Fill([](const Vector3D& pt) { return pt.x * pt.y; });
+		src1.Fill([](const Vector3D& pt) { return std::sin(pt.z) + pt.x; });
+		src2.Fill([](const Vector3D& pt) { return pt.LengthSquared(); });
+
+		std::vector<ScalarGrid3Ptr> sources = { src0.Clone(), src1.Clone(), src2.Clone() };
+		std::vector<ScalarGrid3Ptr> expected = { src0.Clone(), src1.Clone(), src2.Clone() };
+		std::vector<ScalarGrid3Ptr> actual = { src0.Clone(), src1.Clone(), src2.Clone() };
+
+		for (size_t n = 0; n < sources.size(); ++n)
+		{
+			solver->Advect(*sources[n], flow, 0.1, expected[n].get(), boundarySDF);
+		}
+
+		solver->Advect(
+			{ sources[0].get(), sources[1].get(), sources[2].get() },
+			flow,
+			0.1,
+			{ actual[0].get(), actual[1].get(), actual[2].get() },
+			boundarySDF);
+
+		for (size_t n = 0; n < sources.size(); ++n)
+		{
+			actual[n]->ForEachDataPointIndex([&](size_t i, size_t j, size_t k)
+			{
+				EXPECT_EQ((*expected[n])(i, j, k), (*actual[n])(i, j, k));
+			});
+		}
+	}
+}
+
+TEST(SemiLagrangian3, AdvectMultipleScalarGrids)
+{
+	SemiLagrangian3 solver;
+	TestMultipleScalarGrids(&solver);
+
+	CubicSemiLagrangian3 cubicSolver;
+	TestMultipleScalarGrids(&cubicSolver);
+}
+
+TEST(SemiLagrangian3, AdvectMultipleCollocatedVectorGrids)
+{
+	CustomVectorField3 flow([](const Vector3D& pt)
+	{
+		return Vector3D(-pt.y, pt.x, 0.0);
+	});
+
+	CellCenteredVectorGrid3 src0({ 16, 16, 16 }, { 1.0 / 16.0, 1.0 / 16.0, 1.0 / 16.0 });
+	CellCenteredVectorGrid3 src1({ 16, 16, 16 }, { 1.0 / 16.0, 1.0 / 16.0, 1.0 / 16.0 });
+	src0.Fill([](const Vector3D& pt) { return Vector3D(pt.x, pt.y * pt.z, 1.0); });
+	src1.Fill([](const Vector3D& pt) { return Vector3D(pt.z, -pt.x, pt.y); });
+
+	CellCenteredVectorGrid3 expected0(src0), expected1(src1);
+	CellCenteredVectorGrid3 actual0(src0), actual1(src1);
+
+	CubicSemiLagrangian3 solver;
+	solver.Advect(src0, flow, 0.1, &expected0);
+	solver.Advect(src1, flow, 0.1, &expected1);
+	solver.Advect(
+		std::vector<const CollocatedVectorGrid3*>{ &src0, &src1 },
+		flow,
+		0.1,
+		std::vector<CollocatedVectorGrid3*>{ &actual0, &actual1 });
+
+	actual0.ForEachDataPointIndex([&](size_t i, size_t j, size_t k)
+	{
+		EXPECT_EQ(expected0(i, j, k), actual0(i, j, k));
+		EXPECT_EQ(expected1(i, j, k), actual1(i, j, k));
+	});
+}
@@ -86,6 +86,107 @@ TEST(VolumeParticleEmitter3, Emit)
 	EXPECT_LT(69u, particles->GetNumberOfParticles());
 }
 
+TEST(VolumeParticleEmitter3, EmitContinuousWithExistingParticles)
+{
+	auto sphere = std::make_shared<SurfaceToImplicit3>(
+		std::make_shared<Sphere3>(Vector3D(1.0, 1.0, 1.0), 0.8));
+
+	auto createEmitter = [&]()
+	{
+		return VolumeParticleEmitter3::GetBuilder()
+			.WithImplicitSurface(sphere)
+			.WithMaxRegion(BoundingBox3D({ 0.0, 0.0, 0.0 }, { 2.0, 2.0, 2.0 }))
+			.WithSpacing(0.1)
+			.WithJitter(0.5)
+			.WithIsOneShot(false)
+			.WithAllowOverlapping(false)
+			.WithRandomSeed(7)
+			.MakeShared();
+	};
+
+	// Existing particles both near and far from the emitter
+	Array1<Vector3D> existing;
+	for (int i = 0; i < 20; ++i)
+	{
+		existing.Append(Vector3D(0.6 + 0.04 * i, 1.0, 1.0));
+		existing.Append(Vector3D(10.0 + i, 10.0, 10.0));
+	}
+
+	auto particles1 = std::make_shared<ParticleSystemData3>();
+	auto particles2 = std::make_shared<ParticleSystemData3>();
+	particles1->AddParticles(existing);
+	particles2->AddParticles(existing);
+
+	auto emitter1 = createEmitter();
+	auto emitter2 = createEmitter();
+	emitter1->SetTarget(particles1);
+	emitter2->SetTarget(particles2);
+
+	for (Frame frame(0, 1.0 / 60.0); frame.index < 2; ++frame)
+	{
+		emitter1->Update(frame.TimeInSeconds(), frame.timeIntervalInSeconds);
+		emitter2->Update(frame.TimeInSeconds(), frame.timeIntervalInSeconds);
+	}
+
+	// Same seed gives the same particles
+	auto pos1 = particles1->GetPositions();
+	auto pos2 = particles2->GetPositions();
+	ASSERT_EQ(particles1->GetNumberOfParticles(), particles2->GetNumberOfParticles());
+	EXPECT_LT(existing.size(), particles1->GetNumberOfParticles());
+
+	for (size_t i = 0; i < particles1->GetNumberOfParticles(); ++i)
+	{
+		EXPECT_EQ(pos1[i], pos2[i]);
+	}
+
+	// No emitted particle overlaps with any other particle
+	for (size_t i = existing.size(); i < particles1->GetNumberOfParticles(); ++i)
+	{
+		for (size_t k = 0; k < i; ++k)
+		{
+			EXPECT_LT(0.1, pos1[i].DistanceTo(pos1[k]));
+		}
+	}
+}
+
+TEST(VolumeParticleEmitter3, EmitContinuousAfterParticlesMoved)
+{
+	auto sphere = std::make_shared<SurfaceToImplicit3>(
+		std::make_shared<Sphere3>(Vector3D(1.0, 1.0, 1.0), 0.5));
+
+	auto emitter = VolumeParticleEmitter3::GetBuilder()
+		.WithImplicitSurface(sphere)
+		.WithMaxRegion(BoundingBox3D({ 0.0, 0.0, 0.0 }, { 2.0, 2.0, 2.0 }))
+		.WithSpacing(0.1)
+		.WithIsOneShot(false)
+		.WithAllowOverlapping(false)
+		.MakeShared();
+
+	auto particles = std::make_shared<ParticleSystemData3>();
+	emitter->SetTarget(particles);
+
+	Frame frame(0, 1.0 / 60.0);
+	emitter->Update(frame.TimeInSeconds(), frame.timeIntervalInSeconds);
+	const size_t numberOfFirstParticles = particles->GetNumberOfParticles();
+	EXPECT_LT(0u, numberOfFirstParticles);
+
+	// Nothing is emitted while the emitted particles stay in place
+	++frame;
+	emitter->Update(frame.TimeInSeconds(), frame.timeIntervalInSeconds);
+	EXPECT_EQ(numberOfFirstParticles, particles->GetNumberOfParticles());
+
+	// Moving the particles away frees the emitter volume again
+	auto pos = particles->GetPositions();
+	for (size_t i = 0; i < pos.size(); ++i)
+	{
+		pos[i] += Vector3D(10.0, 0.0, 0.0);
+	}
+
+	++frame;
+	emitter->Update(frame.TimeInSeconds(), frame.timeIntervalInSeconds);
+	EXPECT_EQ(2 * numberOfFirstParticles, particles->GetNumberOfParticles());
+}
+
 TEST(VolumeParticleEmitter3, Builder)
 {
 	auto sphere = std::make_shared<Sphere3>(Vector3D(1.0, 2.0, 4.0), 3.0);